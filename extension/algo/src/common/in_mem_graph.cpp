@@ -1,5 +1,7 @@
 #include "common/in_mem_graph.h"
 
+#include <algorithm>
+
 namespace kuzu {
 namespace algo_extension {
 
@@ -25,5 +27,20 @@ void InMemGraph::insertNbr(const common::offset_t to, const weight_t weight) {
     numEdges++;
 }
 
+void InMemNodeOrder::initDegreeOrder(const InMemGraph& graph) {
+    newToOld.resize(graph.numNodes);
+    oldToNew.resize(graph.numNodes);
+    for (auto nodeId = 0u; nodeId < graph.numNodes; ++nodeId) {
+        newToOld[nodeId] = nodeId;
+    }
+    std::stable_sort(newToOld.begin(), newToOld.end(),
+        [&](common::offset_t a, common::offset_t b) {
+            return graph.getDegree(a) > graph.getDegree(b);
+        });
+    for (auto newId = 0u; newId < graph.numNodes; ++newId) {
+        oldToNew[newToOld[newId]] = newId;
+    }
+}
+
 } // namespace algo_extension
 } // namespace kuzu
@@ -0,0 +1,404 @@
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/random_engine.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/betweenness_centrality_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::processor;
+using namespace kuzu::common;
+using namespace kuzu::binder;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Betweenness centrality with Brandes' algorithm ("A Faster Algorithm for Betweenness Centrality").
+// For every source s, a BFS from s counts the number of shortest paths sigma(v) from s to every
+// node v. The dependency of s on v is then accumulated level by level from the deepest BFS level:
+//   delta(v) = sum over successors w of v: sigma(v) / sigma(w) * (1 + delta(w))
+// and the centrality of v is the sum of delta(v) over all sources. Both phases run level by level
+// as parallel frontier computations.
+// If only k of the n nodes are used as sources, the centrality is estimated by scaling the sums by
+// n / k (Brandes and Pich, "Centrality Estimation in Large Networks").
+
+namespace kuzu {
+namespace algo_extension {
+
+struct BetweennessOptionalParams final : public OptionalParams {
+    OptionalParam<SamplingSize> samplingSize;
+    OptionalParam<SamplingSeed> samplingSeed;
+    OptionalParam<Directed> directed;
+
+    explicit BetweennessOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    BetweennessOptionalParams(OptionalParam<SamplingSize> samplingSize,
+        OptionalParam<SamplingSeed> samplingSeed, OptionalParam<Directed> directed)
+        : samplingSize{std::move(samplingSize)}, samplingSeed{std::move(samplingSeed)},
+          directed{std::move(directed)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        samplingSize.evaluateParam(context);
+        samplingSeed.evaluateParam(context);
+        directed.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<BetweennessOptionalParams>(samplingSize, samplingSeed, directed);
+    }
+};
+
+BetweennessOptionalParams::BetweennessOptionalParams(const expression_vector& optionalParams) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == SamplingSize::NAME) {
+            samplingSize = function::OptionalParam<SamplingSize>(optionalParam);
+        } else if (paramName == SamplingSeed::NAME) {
+            samplingSeed = function::OptionalParam<SamplingSeed>(optionalParam);
+        } else if (paramName == Directed::NAME) {
+            directed = function::OptionalParam<Directed>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct BetweennessBindData final : public GDSBindData {
+    BetweennessBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<BetweennessOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BetweennessBindData>(*this);
+    }
+};
+
+static void addCAS(std::atomic<double>& origin, double valToAdd) {
+    auto expected = origin.load(std::memory_order_relaxed);
+    auto desired = expected + valToAdd;
+    while (!origin.compare_exchange_strong(expected, desired)) {
+        desired = expected + valToAdd;
+    }
+}
+
+// A double value for every node, initialized to 0.
+class NodeValues {
+public:
+    NodeValues(const table_id_map_t<offset_t>& maxOffsetMap, MemoryManager* mm) {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            valueMap.allocate(tableID, maxOffset, mm);
+            auto values = valueMap.getData(tableID);
+            for (auto i = 0u; i < maxOffset; ++i) {
+                values[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::atomic<double>* getData(table_id_t tableID) const { return valueMap.getData(tableID); }
+
+private:
+    GDSDenseObjectManager<std::atomic<double>> valueMap;
+};
+
+struct BrandesState {
+    // Number of shortest paths from the current source to every node.
+    NodeValues numPaths;
+    // Dependency of the current source on every node.
+    NodeValues dependencies;
+    // Sum of the dependencies of all sources processed so far.
+    NodeValues centralities;
+
+    // Values of the bound and nbr tables of the current frontier computation.
+    std::atomic<double>* boundNumPaths = nullptr;
+    std::atomic<double>* nbrNumPaths = nullptr;
+    std::atomic<double>* boundDependencies = nullptr;
+    std::atomic<double>* nbrDependencies = nullptr;
+
+    BrandesState(const table_id_map_t<offset_t>& maxOffsetMap, MemoryManager* mm)
+        : numPaths{maxOffsetMap, mm}, dependencies{maxOffsetMap, mm},
+          centralities{maxOffsetMap, mm} {}
+};
+
+class BrandesAuxiliaryState : public GDSAuxiliaryState {
+public:
+    explicit BrandesAuxiliaryState(BrandesState& state) : state{state} {}
+
+    void initSource(nodeID_t sourceNodeID) override {
+        state.numPaths.getData(sourceNodeID.tableID)[sourceNodeID.offset].store(1);
+    }
+
+    void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
+        state.boundNumPaths = state.numPaths.getData(fromTableID);
+        state.nbrNumPaths = state.numPaths.getData(toTableID);
+        state.boundDependencies = state.dependencies.getData(fromTableID);
+        state.nbrDependencies = state.dependencies.getData(toTableID);
+    }
+
+    void switchToDense(ExecutionContext*, Graph*) override {}
+
+private:
+    BrandesState& state;
+};
+
+// Visits the next BFS level and adds the number of shortest paths to every node of the current
+// level to the number of shortest paths to its successors on the next level.
+class BrandesForwardEdgeCompute : public SPEdgeCompute {
+public:
+    BrandesForwardEdgeCompute(SPFrontierPair* frontierPair, BrandesState& state)
+        : SPEdgeCompute{frontierPair}, state{state} {}
+
+    std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, NbrScanState::Chunk& chunk,
+        bool) override {
+        std::vector<nodeID_t> activeNodes;
+        auto numPaths = state.boundNumPaths[boundNodeID.offset].load(std::memory_order_relaxed);
+        chunk.forEach([&](auto neighbors, auto, auto i) {
+            auto nbrNodeID = neighbors[i];
+            auto iter = frontierPair->getNextFrontierValue(nbrNodeID.offset);
+            if (iter == FRONTIER_UNVISITED) {
+                activeNodes.push_back(nbrNodeID);
+            } else if (iter != frontierPair->getCurrentIter()) {
+                // The nbr is on an earlier level.
+                return;
+            }
+            addCAS(state.nbrNumPaths[nbrNodeID.offset], numPaths);
+        });
+        return activeNodes;
+    }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<BrandesForwardEdgeCompute>(frontierPair, state);
+    }
+
+private:
+    BrandesState& state;
+};
+
+// Accumulates the dependency of the source on every node of a BFS level from its successors on the
+// next level. Every node only updates its own dependency.
+class BrandesBackwardEdgeCompute : public SPEdgeCompute {
+public:
+    BrandesBackwardEdgeCompute(SPFrontierPair* frontierPair, BrandesState& state)
+        : SPEdgeCompute{frontierPair}, state{state} {}
+
+    std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, NbrScanState::Chunk& chunk,
+        bool) override {
+        auto numPaths = state.boundNumPaths[boundNodeID.offset].load(std::memory_order_relaxed);
+        double dependency = 0;
+        chunk.forEach([&](auto neighbors, auto, auto i) {
+            auto nbrOffset = neighbors[i].offset;
+            if (frontierPair->getNextFrontierValue(nbrOffset) != frontierPair->getCurrentIter()) {
+                return;
+            }
+            auto nbrNumPaths = state.nbrNumPaths[nbrOffset].load(std::memory_order_relaxed);
+            auto nbrDependency = state.nbrDependencies[nbrOffset].load(std::memory_order_relaxed);
+            dependency += numPaths / nbrNumPaths * (1 + nbrDependency);
+        });
+        if (dependency != 0) {
+            addCAS(state.boundDependencies[boundNodeID.offset], dependency);
+        }
+        return {};
+    }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<BrandesBackwardEdgeCompute>(frontierPair, state);
+    }
+
+private:
+    BrandesState& state;
+};
+
+// Adds the dependencies of the current source to the centralities and resets the per source values.
+class AccumulateDependenciesVertexCompute : public GDSVertexCompute {
+public:
+    AccumulateDependenciesVertexCompute(BrandesState& state, nodeID_t sourceNodeID,
+        NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, state{state}, sourceNodeID{sourceNodeID} {}
+
+    void beginOnTableInternal(table_id_t) override {}
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        auto numPaths = state.numPaths.getData(tableID);
+        auto dependencies = state.dependencies.getData(tableID);
+        auto centralities = state.centralities.getData(tableID);
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (tableID != sourceNodeID.tableID || i != sourceNodeID.offset) {
+                addCAS(centralities[i], dependencies[i].load(std::memory_order_relaxed));
+            }
+            numPaths[i].store(0, std::memory_order_relaxed);
+            dependencies[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<AccumulateDependenciesVertexCompute>(state, sourceNodeID,
+            nodeMask);
+    }
+
+private:
+    BrandesState& state;
+    nodeID_t sourceNodeID;
+};
+
+class BetweennessResultVertexCompute : public GDSResultVertexCompute {
+public:
+    BetweennessResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        BrandesState& state, double scale)
+        : GDSResultVertexCompute{mm, sharedState}, state{state}, scale{scale} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        centralityVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t) override {}
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        auto centralities = state.centralities.getData(tableID);
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            centralityVector->setValue<double>(0,
+                centralities[i].load(std::memory_order_relaxed) * scale);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<BetweennessResultVertexCompute>(mm, sharedState, state, scale);
+    }
+
+private:
+    BrandesState& state;
+    double scale;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> centralityVector;
+};
+
+static std::vector<nodeID_t> getNodeIDs(const table_id_map_t<offset_t>& maxOffsetMap,
+    NodeOffsetMaskMap* nodeMask) {
+    std::vector<nodeID_t> nodeIDs;
+    for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+        if (nodeMask != nullptr) {
+            nodeMask->pin(tableID);
+        }
+        for (auto offset = 0u; offset < maxOffset; ++offset) {
+            if (nodeMask == nullptr || !nodeMask->hasPinnedMask() || nodeMask->valid(offset)) {
+                nodeIDs.push_back(nodeID_t{offset, tableID});
+            }
+        }
+    }
+    return nodeIDs;
+}
+
+// Moves a uniform random sample of the nodes to the front with a partial Fisher-Yates shuffle.
+static void sampleNodeIDs(std::vector<nodeID_t>& nodeIDs, uint64_t samplingSize, int64_t seed) {
+    RandomEngine randomEngine(seed, 0 /* stream */);
+    for (auto i = 0u; i < samplingSize; ++i) {
+        auto j = i + randomEngine.nextRandomInteger(nodeIDs.size() - i);
+        std::swap(nodeIDs[i], nodeIDs[j]);
+    }
+    nodeIDs.resize(samplingSize);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto nodeMask = sharedState->getGraphNodeMaskMap();
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction);
+    auto bindData = input.bindData->constPtrCast<BetweennessBindData>();
+    auto& config = bindData->optionalParams->constCast<BetweennessOptionalParams>();
+    auto mm = MemoryManager::Get(*clientContext);
+
+    auto sourceNodeIDs = getNodeIDs(maxOffsetMap, nodeMask);
+    auto numNodes = sourceNodeIDs.size();
+    auto samplingSize = static_cast<uint64_t>(config.samplingSize.getParamVal());
+    double scale = 1;
+    if (samplingSize > 0 && samplingSize < numNodes) {
+        sampleNodeIDs(sourceNodeIDs, samplingSize, config.samplingSeed.getParamVal());
+        scale = static_cast<double>(numNodes) / samplingSize;
+    }
+    auto direction = ExtendDirection::FWD;
+    if (!config.directed.getParamVal()) {
+        direction = ExtendDirection::BOTH;
+        // Every path is found from both of its endpoints.
+        scale /= 2;
+    }
+
+    BrandesState state(maxOffsetMap, mm);
+    auto progressBar = ProgressBar::Get(*clientContext);
+    for (auto i = 0u; i < sourceNodeIDs.size(); ++i) {
+        auto sourceNodeID = sourceNodeIDs[i];
+        auto frontierPair = std::make_shared<SPFrontierPair>(
+            DenseFrontier::getUninitializedFrontier(input.context, graph));
+        auto computeState = GDSComputeState(frontierPair,
+            std::make_unique<BrandesForwardEdgeCompute>(frontierPair.get(), state),
+            std::make_unique<BrandesAuxiliaryState>(state));
+        computeState.initSource(sourceNodeID);
+        // Nodes are visited on the iteration of their BFS level.
+        GDSUtils::runRecursiveJoinEdgeCompute(input.context, computeState, graph, direction,
+            FRONTIER_UNVISITED - 1, nullptr /* outputNodeMask */, {} /* propertiesToScan */);
+        // The last iteration did not reach any node, so the deepest level is one below it. Nodes
+        // on the deepest level have no successors and the dependency of the source is not needed.
+        computeState.edgeCompute =
+            std::make_unique<BrandesBackwardEdgeCompute>(frontierPair.get(), state);
+        for (auto level = frontierPair->getCurrentIter() - 2; level > 0; --level) {
+            // Run a single iteration over the nodes of the level.
+            frontierPair->setCurrentIter(static_cast<iteration_t>(level));
+            frontierPair->setActiveNodesForNextIter();
+            GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph, direction,
+                level + 1);
+        }
+        auto accumulateVC = AccumulateDependenciesVertexCompute(state, sourceNodeID, nodeMask);
+        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, accumulateVC);
+        auto progress = static_cast<double>(i + 1) / sourceNodeIDs.size();
+        progressBar->updateProgress(input.context->queryID, progress);
+    }
+    auto outputVC = std::make_unique<BetweennessResultVertexCompute>(mm, sharedState, state, scale);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *outputVC);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char CENTRALITY_COLUMN_NAME[] = "centrality";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(
+        input->binder->createVariable(CENTRALITY_COLUMN_NAME, LogicalType::DOUBLE()));
+    return std::make_unique<BetweennessBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::make_unique<BetweennessOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set BetweennessCentralityFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(BetweennessCentralityFunction::name,
+        std::vector<LogicalTypeID>{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
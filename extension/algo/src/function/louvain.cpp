@@ -42,21 +42,24 @@ constexpr offset_t UNASSIGNED_COMM = numeric_limits<offset_t>::max();
 
 struct LouvainOptionalParams final : public MaxIterationOptionalParams {
     OptionalParam<MaxPhases> maxPhases;
+    OptionalParam<NodeOrder> nodeOrder;
 
     explicit LouvainOptionalParams(const expression_vector& optionalParams);
 
     // For copy only
     LouvainOptionalParams(OptionalParam<MaxIterations> maxIterations,
-        OptionalParam<MaxPhases> maxPhases)
-        : MaxIterationOptionalParams{maxIterations}, maxPhases{std::move(maxPhases)} {}
+        OptionalParam<MaxPhases> maxPhases, OptionalParam<NodeOrder> nodeOrder)
+        : MaxIterationOptionalParams{maxIterations}, maxPhases{std::move(maxPhases)},
+          nodeOrder{std::move(nodeOrder)} {}
 
     void evaluateParams(main::ClientContext* context) override {
         MaxIterationOptionalParams::evaluateParams(context);
         maxPhases.evaluateParam(context);
+        nodeOrder.evaluateParam(context);
     }
 
     std::unique_ptr<function::OptionalParams> copy() override {
-        return std::make_unique<LouvainOptionalParams>(maxIterations, maxPhases);
+        return std::make_unique<LouvainOptionalParams>(maxIterations, maxPhases, nodeOrder);
     }
 };
 
@@ -66,6 +69,8 @@ LouvainOptionalParams::LouvainOptionalParams(const expression_vector& optionalPa
         auto paramName = StringUtils::getLower(optionalParam->getAlias());
         if (paramName == MaxPhases::NAME) {
             maxPhases = function::OptionalParam<MaxPhases>(optionalParam);
+        } else if (paramName == NodeOrder::NAME) {
+            nodeOrder = function::OptionalParam<NodeOrder>(optionalParam);
         } else if (paramName == MaxIterations::NAME) {
             continue;
         } else {
@@ -463,8 +468,10 @@ private:
 
 class WriteResultsVC final : public GDSResultVertexCompute {
 public:
-    WriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState, FinalResults& louvainState)
-        : GDSResultVertexCompute{mm, sharedState}, finalResults{louvainState} {
+    WriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState, FinalResults& louvainState,
+        const InMemNodeOrder* nodeOrder)
+        : GDSResultVertexCompute{mm, sharedState}, finalResults{louvainState},
+          nodeOrder{nodeOrder} {
         nodeIDVector = createVector(LogicalType::INTERNAL_ID());
         componentIDVector = createVector(LogicalType::UINT64());
     }
@@ -476,23 +483,29 @@ public:
         for (auto i = startOffset; i < endOffset; ++i) {
             const auto nodeID = nodeID_t{i, tableID};
             nodeIDVector->setValue<nodeID_t>(0, nodeID);
-            componentIDVector->setValue<uint64_t>(0, finalResults.communities[i]);
+            // Communities are assigned to the relabeled nodes if the graph was reordered.
+            const auto nodeId = nodeOrder == nullptr ? i : nodeOrder->getNewOffset(i);
+            componentIDVector->setValue<uint64_t>(0, finalResults.communities[nodeId]);
             localFT->append(vectors);
         }
     }
 
     unique_ptr<VertexCompute> copy() override {
-        return std::make_unique<WriteResultsVC>(mm, sharedState, finalResults);
+        return std::make_unique<WriteResultsVC>(mm, sharedState, finalResults, nodeOrder);
     }
 
 private:
     FinalResults& finalResults;
+    const InMemNodeOrder* nodeOrder;
     unique_ptr<ValueVector> nodeIDVector;
     unique_ptr<ValueVector> componentIDVector;
 };
 
-void initInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
-    PhaseState& state) {
+// Calls initNode(nodeId) for every node in sequence, followed by insertNbr(nodeId, nbrId) for
+// each of its neighbors.
+template<typename InitNode, typename InsertNbr>
+static void scanGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
+    InitNode initNode, InsertNbr insertNbr) {
     const auto nbrTables = graph->getRelInfos(tableId);
     const auto nbrInfo = nbrTables[0];
     KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
@@ -501,23 +514,52 @@ void initInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph*
         nbrInfo.dstTableID, {}, false /*randomLookup*/);
 
     for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
-        state.initNextNode(nodeId);
+        initNode(nodeId);
         const nodeID_t nextNodeId = {nodeId, tableId};
         for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
             chunk.forEach([&](auto neighbors, auto, auto i) {
                 auto nbrId = neighbors[i].offset;
-                state.insertNbr(nodeId, nbrId);
+                insertNbr(nodeId, nbrId);
             });
         }
         for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
             chunk.forEach([&](auto neighbors, auto, auto i) {
                 auto nbrId = neighbors[i].offset;
                 if (nbrId != nodeId) {
-                    state.insertNbr(nodeId, nbrId);
+                    insertNbr(nodeId, nbrId);
                 }
             });
         }
     }
+}
+
+void initInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
+    PhaseState& state) {
+    scanGraph(
+        tableId, numNodes, graph, [&](offset_t nodeId) { state.initNextNode(nodeId); },
+        [&](offset_t nodeId, offset_t nbrId) { state.insertNbr(nodeId, nbrId); });
+    state.finalize();
+}
+
+// Creates the initial in-memory graph with its nodes relabeled by `nodeOrder`.
+void initReorderedInMemoryGraph(const table_id_t tableId, const offset_t numNodes, Graph* graph,
+    PhaseState& state, InMemNodeOrder& nodeOrder, MemoryManager* mm) {
+    InMemGraph origGraph(numNodes, mm);
+    scanGraph(
+        tableId, numNodes, graph, [&](offset_t) { origGraph.initNextNode(); },
+        [&](offset_t, offset_t nbrId) { origGraph.insertNbr(nbrId); });
+    origGraph.initNextNode();
+    nodeOrder.initDegreeOrder(origGraph);
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        state.initNextNode(nodeId);
+        const auto origNodeId = nodeOrder.getOldOffset(nodeId);
+        const auto beginCSROffset = origGraph.csrOffsets[origNodeId];
+        const auto endCSROffset = origGraph.csrOffsets[origNodeId + 1];
+        for (auto offset = beginCSROffset; offset < endCSROffset; ++offset) {
+            const auto origNbrId = origGraph.csrEdges[offset].neighbor;
+            state.insertNbr(nodeId, nodeOrder.getNewOffset(origNbrId));
+        }
+    }
     state.finalize();
 }
 
@@ -592,7 +634,13 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
     PhaseState state(origNumNodes, mm, input.context);
 
     // Create the initial in-memory graph.
-    initInMemoryGraph(tableID, origNumNodes, graph, state);
+    std::unique_ptr<InMemNodeOrder> nodeOrder;
+    if (config.nodeOrder.getParamVal() == NodeOrder::DEGREE_ORDER) {
+        nodeOrder = std::make_unique<InMemNodeOrder>(mm);
+        initReorderedInMemoryGraph(tableID, origNumNodes, graph, state, *nodeOrder, mm);
+    } else {
+        initInMemoryGraph(tableID, origNumNodes, graph, state);
+    }
 
     // Each phases attempts to decrease the number of communities by merging nodes into supernodes.
     for (auto phase = 0u; phase < config.maxPhases.getParamVal(); ++phase) {
@@ -660,7 +708,8 @@ static common::offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&)
         aggregateCommunities(newCommCount, state, mm, input.context);
     }
 
-    const auto parallelCompute = make_unique<WriteResultsVC>(mm, sharedState, finalResults);
+    const auto parallelCompute =
+        make_unique<WriteResultsVC>(mm, sharedState, finalResults, nodeOrder.get());
     GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *parallelCompute);
 
     sharedState->factorizedTablePool.mergeLocalTables();
@@ -0,0 +1,414 @@
+#include <algorithm>
+
+#include "binder/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "function/algo_function.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+using namespace kuzu::graph;
+using namespace kuzu::function;
+
+// Triangle counting over the undirected simple graph underlying the projected graph, i.e. rel
+// directions, self-loops and parallel rels are ignored.
+// Every edge is oriented from the endpoint with the lower degree to the one with the higher degree,
+// with ties broken by offset. Every triangle {u, v, w} with u < v < w in this order is then found
+// exactly once, as a node w in the intersection of the sorted out-neighbors of u and v. Orienting
+// the edges bounds the out-degree of every node by O(sqrt(m)), so high degree nodes do not blow up
+// the cost of the intersections (Schank and Wagner, "Finding, Counting and Listing all Triangles
+// in Large Graphs").
+
+namespace kuzu {
+namespace algo_extension {
+
+struct TriangleCountState {
+    // Number of distinct neighbors of each node.
+    ObjectArray<offset_t> degrees;
+    // Out-neighbors of each node in the oriented graph, sorted by offset.
+    InMemGraph orientedGraph;
+    // Number of triangles each node belongs to.
+    AtomicObjectArray<uint64_t> triangleCounts;
+    std::atomic<uint64_t> totalTriangleCount = 0;
+
+    TriangleCountState(offset_t numNodes, MemoryManager* mm)
+        : degrees{numNodes, mm, true /* initializeToZero */}, orientedGraph{numNodes, mm},
+          triangleCounts{numNodes, mm, true /* initializeToZero */} {}
+    DELETE_BOTH_COPY(TriangleCountState);
+
+    // Whether the edge between the two nodes is oriented from `from` to `to`.
+    bool isOriented(offset_t from, offset_t to) const {
+        auto fromDegree = degrees.get(from);
+        auto toDegree = degrees.get(to);
+        return fromDegree < toDegree || (fromDegree == toDegree && from < to);
+    }
+};
+
+static void initInMemoryGraph(table_id_t tableID, offset_t numNodes, Graph* graph,
+    NodeOffsetMaskMap* nodeMask, TriangleCountState& state, MemoryManager* mm) {
+    if (nodeMask != nullptr) {
+        nodeMask->pin(tableID);
+    }
+    auto isValid = [&](offset_t offset) {
+        return nodeMask == nullptr || !nodeMask->hasPinnedMask() || nodeMask->valid(offset);
+    };
+    std::vector<std::unique_ptr<NbrScanState>> scanStates;
+    for (auto& relInfo : graph->getRelInfos(tableID)) {
+        KU_ASSERT(relInfo.srcTableID == relInfo.dstTableID);
+        // Set randomLookup to false to enable caching during graph materialization.
+        scanStates.push_back(graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+            relInfo.dstTableID, {}, false /*randomLookup*/));
+    }
+    // Collect the distinct neighbors of every node, which also gives the degrees used to orient
+    // the edges.
+    InMemGraph undirectedGraph(numNodes, mm);
+    std::vector<offset_t> nbrs;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        undirectedGraph.initNextNode();
+        if (!isValid(nodeId)) {
+            continue;
+        }
+        nbrs.clear();
+        auto collectNbrs = [&](auto neighbors, auto, auto i) {
+            auto nbrId = neighbors[i].offset;
+            if (nbrId != nodeId && isValid(nbrId)) {
+                nbrs.push_back(nbrId);
+            }
+        };
+        const nodeID_t nextNodeId = {nodeId, tableID};
+        for (auto& scanState : scanStates) {
+            for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
+                chunk.forEach(collectNbrs);
+            }
+            for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
+                chunk.forEach(collectNbrs);
+            }
+        }
+        std::sort(nbrs.begin(), nbrs.end());
+        nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+        for (auto nbrId : nbrs) {
+            undirectedGraph.insertNbr(nbrId);
+        }
+        state.degrees.set(nodeId, nbrs.size());
+    }
+    undirectedGraph.initNextNode();
+    // Keep only the out-neighbors of every node. They stay sorted by offset.
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        state.orientedGraph.initNextNode();
+        const auto beginCSROffset = undirectedGraph.csrOffsets[nodeId];
+        const auto endCSROffset = undirectedGraph.csrOffsets[nodeId + 1];
+        for (auto offset = beginCSROffset; offset < endCSROffset; ++offset) {
+            auto nbrId = undirectedGraph.csrEdges[offset].neighbor;
+            if (state.isOriented(nodeId, nbrId)) {
+                state.orientedGraph.insertNbr(nbrId);
+            }
+        }
+    }
+    state.orientedGraph.initNextNode();
+}
+
+class CountTrianglesVC final : public InMemParallelCompute {
+public:
+    explicit CountTrianglesVC(TriangleCountState& state) : state{state} {}
+    ~CountTrianglesVC() override = default;
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        const auto& graph = state.orientedGraph;
+        uint64_t numTrianglesLocal = 0;
+        for (auto u = startOffset; u < endOffset; ++u) {
+            const auto uBegin = graph.csrOffsets[u];
+            const auto uEnd = graph.csrOffsets[u + 1];
+            uint64_t numTrianglesOfU = 0;
+            for (auto uPos = uBegin; uPos < uEnd; ++uPos) {
+                const auto v = graph.csrEdges[uPos].neighbor;
+                // Intersect the sorted out-neighbors of u and v.
+                auto i = uBegin;
+                auto j = graph.csrOffsets[v];
+                const auto vEnd = graph.csrOffsets[v + 1];
+                uint64_t numTrianglesOfEdge = 0;
+                while (i < uEnd && j < vEnd) {
+                    const auto uNbr = graph.csrEdges[i].neighbor;
+                    const auto vNbr = graph.csrEdges[j].neighbor;
+                    if (uNbr < vNbr) {
+                        i++;
+                    } else if (vNbr < uNbr) {
+                        j++;
+                    } else {
+                        state.triangleCounts.fetchAdd(uNbr, 1, std::memory_order_relaxed);
+                        numTrianglesOfEdge++;
+                        i++;
+                        j++;
+                    }
+                }
+                if (numTrianglesOfEdge > 0) {
+                    state.triangleCounts.fetchAdd(v, numTrianglesOfEdge,
+                        std::memory_order_relaxed);
+                    numTrianglesOfU += numTrianglesOfEdge;
+                }
+            }
+            if (numTrianglesOfU > 0) {
+                state.triangleCounts.fetchAdd(u, numTrianglesOfU, std::memory_order_relaxed);
+                numTrianglesLocal += numTrianglesOfU;
+            }
+        }
+        state.totalTriangleCount.fetch_add(numTrianglesLocal);
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CountTrianglesVC>(state);
+    }
+
+private:
+    TriangleCountState& state;
+};
+
+// Fraction of the pairs of distinct neighbors of a node that are connected by an edge.
+static double getClusteringCoefficient(TriangleCountState& state, offset_t nodeId) {
+    const auto degree = state.degrees.get(nodeId);
+    if (degree < 2) {
+        return 0;
+    }
+    const auto numTriangles = state.triangleCounts.get(nodeId, std::memory_order_relaxed);
+    return 2.0 * numTriangles / (static_cast<double>(degree) * (degree - 1));
+}
+
+class SumClusteringCoefficientsVC final : public InMemParallelCompute {
+public:
+    SumClusteringCoefficientsVC(TriangleCountState& state, std::atomic<double>& sum)
+        : state{state}, sum{sum} {}
+    ~SumClusteringCoefficientsVC() override = default;
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        double sumLocal = 0;
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            sumLocal += getClusteringCoefficient(state, nodeId);
+        }
+        auto expected = sum.load();
+        while (!sum.compare_exchange_weak(expected, expected + sumLocal)) {}
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<SumClusteringCoefficientsVC>(state, sum);
+    }
+
+private:
+    TriangleCountState& state;
+    std::atomic<double>& sum;
+};
+
+class TriangleCountResultsVC final : public GDSResultVertexCompute {
+public:
+    TriangleCountResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        TriangleCountState& state)
+        : GDSResultVertexCompute{mm, sharedState}, state{state} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        triangleCountVector = createVector(LogicalType::INT64());
+        totalTriangleCountVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        const auto totalTriangleCount = state.totalTriangleCount.load();
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            triangleCountVector->setValue<int64_t>(0,
+                state.triangleCounts.get(i, std::memory_order_relaxed));
+            totalTriangleCountVector->setValue<int64_t>(0, totalTriangleCount);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<TriangleCountResultsVC>(mm, sharedState, state);
+    }
+
+private:
+    TriangleCountState& state;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> triangleCountVector;
+    std::unique_ptr<ValueVector> totalTriangleCountVector;
+};
+
+class ClusteringCoefficientResultsVC final : public GDSResultVertexCompute {
+public:
+    ClusteringCoefficientResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        TriangleCountState& state, double averageCoefficient)
+        : GDSResultVertexCompute{mm, sharedState}, state{state},
+          averageCoefficient{averageCoefficient} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        coefficientVector = createVector(LogicalType::DOUBLE());
+        averageCoefficientVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            coefficientVector->setValue<double>(0, getClusteringCoefficient(state, i));
+            averageCoefficientVector->setValue<double>(0, averageCoefficient);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<ClusteringCoefficientResultsVC>(mm, sharedState, state,
+            averageCoefficient);
+    }
+
+private:
+    TriangleCountState& state;
+    double averageCoefficient;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> coefficientVector;
+    std::unique_ptr<ValueVector> averageCoefficientVector;
+};
+
+static void countTriangles(const TableFuncInput& input, TriangleCountState& state) {
+    const auto clientContext = input.context->clientContext;
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    const auto graph = sharedState->graph.get();
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto numNodes = state.degrees.getSize();
+    initInMemoryGraph(tableID, numNodes, graph, sharedState->getGraphNodeMaskMap(), state,
+        MemoryManager::Get(*clientContext));
+    CountTrianglesVC countTrianglesVC(state);
+    InMemGDSUtils::runParallelCompute(countTrianglesVC, numNodes, input.context);
+}
+
+static offset_t getNumNodes(const TableFuncInput& input) {
+    const auto transaction = transaction::Transaction::Get(*input.context->clientContext);
+    const auto graph = input.sharedState->ptrCast<GDSFuncSharedState>()->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    return graph->getMaxOffset(transaction, graph->getNodeTableIDs()[0]);
+}
+
+static offset_t triangleCountTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*input.context->clientContext);
+    TriangleCountState state(getNumNodes(input), mm);
+    countTriangles(input, state);
+    auto vertexCompute = std::make_unique<TriangleCountResultsVC>(mm, sharedState, state);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, sharedState->graph.get(),
+        *vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static offset_t clusteringCoefficientTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*input.context->clientContext);
+    const auto numNodes = getNumNodes(input);
+    TriangleCountState state(numNodes, mm);
+    countTriangles(input, state);
+    // Nodes excluded by the projection have a coefficient of 0 and are not averaged over.
+    auto numValidNodes = numNodes;
+    auto nodeMask = sharedState->getGraphNodeMaskMap();
+    if (nodeMask != nullptr && nodeMask->hasPinnedMask()) {
+        numValidNodes = nodeMask->getPinnedMask()->getNumMaskedNodes();
+    }
+    std::atomic<double> sumCoefficients = 0;
+    SumClusteringCoefficientsVC sumCoefficientsVC(state, sumCoefficients);
+    InMemGDSUtils::runParallelCompute(sumCoefficientsVC, numNodes, input.context);
+    const auto averageCoefficient =
+        numValidNodes == 0 ? 0 : sumCoefficients.load() / static_cast<double>(numValidNodes);
+    auto vertexCompute = std::make_unique<ClusteringCoefficientResultsVC>(mm, sharedState,
+        state, averageCoefficient);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, sharedState->graph.get(),
+        *vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static NativeGraphEntry bindGraphEntry(main::ClientContext* context,
+    const TableFuncBindInput* input, const std::string& functionName) {
+    const auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException(functionName + " only supports operations on one node table.");
+    }
+    return graphEntry;
+}
+
+static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+static constexpr char TOTAL_TRIANGLE_COUNT_COLUMN_NAME[] = "total_triangle_count";
+
+static std::unique_ptr<TableFuncBindData> triangleCountBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphEntry = bindGraphEntry(context, input, "Triangle count");
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(
+        input->binder->createVariable(TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+    columns.push_back(
+        input->binder->createVariable(TOTAL_TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
+        expression_vector{nodeOutput});
+}
+
+static constexpr char LOCAL_CLUSTERING_COEFFICIENT_COLUMN_NAME[] = "local_clustering_coefficient";
+static constexpr char AVERAGE_CLUSTERING_COEFFICIENT_COLUMN_NAME[] =
+    "average_clustering_coefficient";
+
+static std::unique_ptr<TableFuncBindData> clusteringCoefficientBindFunc(
+    main::ClientContext* context, const TableFuncBindInput* input) {
+    auto graphEntry = bindGraphEntry(context, input, "Local clustering coefficient");
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(LOCAL_CLUSTERING_COEFFICIENT_COLUMN_NAME,
+        LogicalType::DOUBLE()));
+    columns.push_back(input->binder->createVariable(AVERAGE_CLUSTERING_COEFFICIENT_COLUMN_NAME,
+        LogicalType::DOUBLE()));
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
+        expression_vector{nodeOutput});
+}
+
+static std::unique_ptr<TableFunction> getTableFunction(const char* name,
+    table_func_bind_t bindFunc, table_func_t tableFunc) {
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    return func;
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getTableFunction(name, triangleCountBindFunc, triangleCountTableFunc));
+    return result;
+}
+
+function_set LocalClusteringCoefficientFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getTableFunction(name, clusteringCoefficientBindFunc,
+        clusteringCoefficientTableFunc));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace kuzu
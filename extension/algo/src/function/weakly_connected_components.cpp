@@ -4,6 +4,7 @@
 #include "function/config/connected_components_config.h"
 #include "function/config/max_iterations_config.h"
 #include "function/gds/gds_utils.h"
+#include "function/incremental.h"
 #include "function/table/bind_input.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
@@ -104,6 +105,142 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     return bindData;
 }
 
+// Union-find over the component labels merged by an update. Labels that were never merged are
+// their own representative and are not stored. The smallest label of a component represents it.
+class ComponentLabelUnionFind {
+public:
+    int64_t find(int64_t label) const {
+        auto it = parents.find(label);
+        while (it != parents.end() && it->second != label) {
+            label = it->second;
+            it = parents.find(label);
+        }
+        return label;
+    }
+
+    void merge(int64_t label1, int64_t label2) {
+        auto root1 = find(label1);
+        auto root2 = find(label2);
+        if (root1 == root2) {
+            return;
+        }
+        if (root1 < root2) {
+            parents[root2] = root1;
+        } else {
+            parents[root1] = root2;
+        }
+    }
+
+    // Points every merged label directly at its representative, so that lookups while writing the
+    // result are a single probe.
+    void flatten() {
+        for (auto& [label, parent] : parents) {
+            parent = find(parent);
+        }
+    }
+
+private:
+    std::unordered_map<int64_t, int64_t> parents;
+};
+
+class IncrementalWCCResultVertexCompute final : public GDSResultVertexCompute {
+public:
+    IncrementalWCCResultVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        PreviousResults<int64_t>& labels, const ComponentLabelUnionFind& unionFind)
+        : GDSResultVertexCompute{mm, sharedState}, labels{labels}, unionFind{unionFind} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        groupIDVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t tableID) override { labels.pinTable(tableID); }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i) || !labels.hasValue(i)) {
+                continue;
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            groupIDVector->setValue<int64_t>(0, unionFind.find(labels.getValue(i)));
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<IncrementalWCCResultVertexCompute>(mm, sharedState, labels,
+            unionFind);
+    }
+
+private:
+    PreviousResults<int64_t>& labels;
+    const ComponentLabelUnionFind& unionFind;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> groupIDVector;
+};
+
+// Maintains the previous group ids under rel and node insertions. Insertions can only merge
+// components, and every merge goes through a rel of a touched node, so only the rels of touched
+// nodes are scanned. Deletions may split components and need a full WCC run.
+static offset_t incrementalTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto& incrementalInput =
+        input.bindData->constPtrCast<IncrementalBindData>()->incrementalInput;
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext));
+    auto mm = MemoryManager::Get(*clientContext);
+    auto labels = PreviousResults<int64_t>(maxOffsetMap, mm);
+    auto touchedNodes = TouchedNodes();
+    auto scanVC = PreviousResultsScanVertexCompute<int64_t>(labels, incrementalInput.touchedSince,
+        touchedNodes, sharedState->getGraphNodeMaskMap());
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, scanVC,
+        incrementalInput.getPropertiesToScan());
+    // Nodes without a previous group id start in a component of their own, labelled above all
+    // previous group ids so that the labels cannot collide.
+    int64_t nextLabel = 0;
+    for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+        labels.pinTable(tableID);
+        for (auto i = 0u; i < maxOffset; ++i) {
+            if (labels.hasValue(i)) {
+                nextLabel = std::max(nextLabel, labels.getValue(i) + 1);
+            }
+        }
+    }
+    auto touchedNodeIDs = touchedNodes.getSortedNodeIDs();
+    for (auto nodeID : touchedNodeIDs) {
+        if (!labels.hasValue(nodeID)) {
+            labels.setValue(nodeID, nextLabel++);
+        }
+    }
+    auto unionFind = ComponentLabelUnionFind();
+    auto scanner = NodeNbrScanner(graph, ExtendDirection::BOTH, {});
+    for (auto nodeID : touchedNodeIDs) {
+        auto label = labels.getValue(nodeID);
+        scanner.scan(nodeID, ExtendDirection::BOTH, [&](nodeID_t nbrNodeID) {
+            if (labels.hasValue(nbrNodeID)) {
+                unionFind.merge(label, labels.getValue(nbrNodeID));
+            }
+        });
+    }
+    unionFind.flatten();
+    auto vertexCompute = IncrementalWCCResultVertexCompute(mm, sharedState, labels, unionFind);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vertexCompute);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> incrementalBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    auto incrementalInput = IncrementalInput::bind(*input, graphEntry, LogicalTypeID::INT64);
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(GROUP_ID_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<IncrementalBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::move(incrementalInput), nullptr /* optionalParams */);
+}
+
 function_set WeaklyConnectedComponentsFunction::getFunctionSet() {
     function_set result;
     auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
@@ -118,5 +255,21 @@ function_set WeaklyConnectedComponentsFunction::getFunctionSet() {
     return result;
 }
 
+function_set IncrementalWeaklyConnectedComponentsFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::ANY, LogicalTypeID::STRING, LogicalTypeID::STRING,
+            LogicalTypeID::ANY});
+    func->bindFunc = incrementalBindFunc;
+    func->tableFunc = incrementalTableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
 } // namespace algo_extension
 } // namespace kuzu
@@ -40,6 +40,34 @@ struct InMemGraph {
 
     // Inserts a neighbor of the last initialized node.
     void insertNbr(const common::offset_t to, const weight_t weight = DEFAULT_WEIGHT);
+
+    common::offset_t getDegree(const common::offset_t nodeId) const {
+        return csrOffsets[nodeId + 1] - csrOffsets[nodeId];
+    }
+};
+
+// Relabeling of the nodes of an in-memory graph. Algorithms index their per-node state by node
+// offset, so giving nodes that are accessed together nearby offsets improves cache locality. An
+// algorithm runs on the relabeled graph and maps its results back to the original offsets.
+class InMemNodeOrder {
+public:
+    explicit InMemNodeOrder(storage::MemoryManager* mm) : newToOld(mm), oldToNew(mm) {}
+    DELETE_BOTH_COPY(InMemNodeOrder);
+
+    // Orders the nodes by descending degree, breaking ties by offset. High degree nodes are the
+    // neighbors of most edges, so their state is packed into a few cache lines that stay hot.
+    void initDegreeOrder(const InMemGraph& graph);
+
+    common::offset_t getNewOffset(const common::offset_t oldOffset) const {
+        return oldToNew[oldOffset];
+    }
+    common::offset_t getOldOffset(const common::offset_t newOffset) const {
+        return newToOld[newOffset];
+    }
+
+private:
+    function::ku_vector_t<common::offset_t> newToOld;
+    function::ku_vector_t<common::offset_t> oldToNew;
 };
 
 } // namespace algo_extension
@@ -53,6 +53,30 @@ struct PageRankAliasFunction {
     static constexpr const char* name = "PR";
 };
 
+struct IncrementalWeaklyConnectedComponentsFunction {
+    static constexpr const char* name = "INCREMENTAL_WEAKLY_CONNECTED_COMPONENTS";
+
+    static function::function_set getFunctionSet();
+};
+
+struct IncrementalWeaklyConnectedComponentsAliasFunction {
+    using alias = IncrementalWeaklyConnectedComponentsFunction;
+
+    static constexpr const char* name = "INCREMENTAL_WCC";
+};
+
+struct IncrementalPageRankFunction {
+    static constexpr const char* name = "INCREMENTAL_PAGE_RANK";
+
+    static function::function_set getFunctionSet();
+};
+
+struct IncrementalPageRankAliasFunction {
+    using alias = IncrementalPageRankFunction;
+
+    static constexpr const char* name = "INCREMENTAL_PR";
+};
+
 struct KCoreDecompositionFunction {
     static constexpr const char* name = "K_CORE_DECOMPOSITION";
 
@@ -71,6 +95,24 @@ struct LouvainFunction {
     static function::function_set getFunctionSet();
 };
 
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LocalClusteringCoefficientFunction {
+    static constexpr const char* name = "LOCAL_CLUSTERING_COEFFICIENT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct BetweennessCentralityFunction {
+    static constexpr const char* name = "BETWEENNESS_CENTRALITY";
+
+    static function::function_set getFunctionSet();
+};
+
 struct SpanningForest {
     static constexpr const char* name = "SPANNING_FOREST";
 
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace function {
+
+struct SamplingSize {
+    // Number of source nodes sampled to approximate the centrality. If 0 or at least the number of
+    // nodes, the centrality is computed exactly from every node.
+    static constexpr const char* NAME = "samplingsize";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+
+    static void validate(int64_t samplingSize) {
+        if (samplingSize < 0) {
+            throw common::BinderException{"Sampling size must be a non-negative integer."};
+        }
+    }
+};
+
+struct SamplingSeed {
+    // Seed of the random selection of the sampled source nodes.
+    static constexpr const char* NAME = "samplingseed";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+};
+
+struct Directed {
+    // If true, shortest paths follow the direction of rels. Otherwise, rels are traversed in both
+    // directions and every path is counted once rather than once per endpoint.
+    static constexpr const char* NAME = "directed";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::BOOL;
+    static constexpr bool DEFAULT_VALUE = false;
+};
+
+} // namespace function
+} // namespace kuzu
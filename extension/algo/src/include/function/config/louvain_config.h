@@ -3,6 +3,7 @@
 #include <string>
 
 #include "common/exception/binder.h"
+#include "common/string_format.h"
 #include "common/types/types.h"
 #include "function/gds/gds.h"
 
@@ -22,6 +23,25 @@ struct MaxPhases {
     }
 };
 
+// The order in which nodes are relabeled before running the algorithm. Relabeling improves cache
+// locality on large graphs, but nodes are also processed in a different order, which may change the
+// communities found.
+struct NodeOrder {
+    static constexpr const char* NAME = "nodeorder";
+    static constexpr const char* INPUT_ORDER = "none";
+    static constexpr const char* DEGREE_ORDER = "degree";
+    static constexpr const char* DEFAULT_VALUE = INPUT_ORDER;
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+
+    static void validate(std::string nodeOrder) {
+        if (nodeOrder != INPUT_ORDER && nodeOrder != DEGREE_ORDER) {
+            throw common::BinderException(
+                common::stringFormat("Node order argument expects {} or {}. Got: {}",
+                    INPUT_ORDER, DEGREE_ORDER, nodeOrder));
+        }
+    }
+};
+
 struct LouvainConfig final : public GDSConfig {
     uint64_t maxIterations = 20;
     uint64_t maxPhases = MaxPhases::DEFAULT_VALUE;
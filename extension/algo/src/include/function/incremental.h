@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/gds/gds.h"
+#include "function/gds/gds_object_manager.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "graph/node_nbr_scanner.h"
+
+namespace kuzu {
+namespace algo_extension {
+
+// Positional arguments shared by the incremental algorithms:
+//   (graph, previous_property, touched_property, touched_since)
+// The result of the previous run is read from a node property. The caller marks every node whose
+// rels changed since that run (both endpoints of a new rel) by setting its touched property, e.g.
+// to a batch number or a timestamp, to at least touchedSince. Nodes without a previous result are
+// always treated as touched.
+struct IncrementalInput {
+    std::string previousPropertyName;
+    std::string touchedPropertyName;
+    int64_t touchedSince = 0;
+
+    std::vector<std::string> getPropertiesToScan() const {
+        return {previousPropertyName, touchedPropertyName};
+    }
+
+    static IncrementalInput bind(const function::TableFuncBindInput& input,
+        const graph::NativeGraphEntry& graphEntry, common::LogicalTypeID previousTypeID) {
+        IncrementalInput result;
+        result.previousPropertyName = input.getLiteralVal<std::string>(1);
+        result.touchedPropertyName = input.getLiteralVal<std::string>(2);
+        auto touchedSince = input.getValue(3);
+        for (auto entry : graphEntry.getNodeEntries()) {
+            auto previousTypeIDInTable = getPropertyTypeID(*entry, result.previousPropertyName);
+            if (previousTypeIDInTable != previousTypeID) {
+                throw common::BinderException{common::stringFormat(
+                    "Previous result property {} of table {} must be of type {}.",
+                    result.previousPropertyName, entry->getName(),
+                    common::LogicalTypeUtils::toString(previousTypeID))};
+            }
+            auto touchedTypeID = getPropertyTypeID(*entry, result.touchedPropertyName);
+            if (touchedTypeID != common::LogicalTypeID::INT64 &&
+                touchedTypeID != common::LogicalTypeID::TIMESTAMP) {
+                throw common::BinderException{common::stringFormat(
+                    "Touched property {} of table {} must be of type INT64 or TIMESTAMP.",
+                    result.touchedPropertyName, entry->getName())};
+            }
+            if (touchedSince.getDataType().getLogicalTypeID() != touchedTypeID) {
+                throw common::BinderException{common::stringFormat(
+                    "Touched since value must be of type {}. Got {}.",
+                    common::LogicalTypeUtils::toString(touchedTypeID),
+                    touchedSince.getDataType().toString())};
+            }
+        }
+        // TIMESTAMP is physically an INT64 number of microseconds.
+        result.touchedSince = touchedSince.getValue<int64_t>();
+        return result;
+    }
+
+private:
+    static common::LogicalTypeID getPropertyTypeID(const catalog::TableCatalogEntry& entry,
+        const std::string& propertyName) {
+        if (!entry.containsProperty(propertyName)) {
+            throw common::BinderException{common::stringFormat("Table {} has no property {}.",
+                entry.getName(), propertyName)};
+        }
+        return entry.getProperty(propertyName).getType().getLogicalTypeID();
+    }
+};
+
+struct IncrementalBindData final : public function::GDSBindData {
+    IncrementalInput incrementalInput;
+
+    IncrementalBindData(binder::expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<binder::Expression> nodeOutput, IncrementalInput incrementalInput,
+        std::unique_ptr<function::OptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry),
+              binder::expression_vector{nodeOutput}},
+          incrementalInput{std::move(incrementalInput)} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<IncrementalBindData>(*this);
+    }
+};
+
+// Previous result of each node. A node has no previous result if it was created after the
+// previous run or its result property is NULL.
+template<typename T>
+class PreviousResults {
+public:
+    PreviousResults(const common::table_id_map_t<common::offset_t>& maxOffsetMap,
+        storage::MemoryManager* mm) {
+        for (const auto& [tableID, maxOffset] : maxOffsetMap) {
+            valuesMap.allocate(tableID, maxOffset, mm);
+            hasValuesMap.allocate(tableID, maxOffset, mm);
+            pinTable(tableID);
+            std::fill_n(hasValues, maxOffset, 0);
+        }
+    }
+
+    void pinTable(common::table_id_t tableID) {
+        values = valuesMap.getData(tableID);
+        hasValues = hasValuesMap.getData(tableID);
+    }
+
+    bool hasValue(common::offset_t offset) const { return hasValues[offset]; }
+    T getValue(common::offset_t offset) const { return values[offset]; }
+    void setValue(common::offset_t offset, T value) {
+        values[offset] = value;
+        hasValues[offset] = 1;
+    }
+
+    // Random access for the sequential parts of the incremental algorithms, which move between
+    // tables with every node.
+    bool hasValue(common::nodeID_t nodeID) const {
+        return hasValuesMap.getData(nodeID.tableID)[nodeID.offset];
+    }
+    T getValue(common::nodeID_t nodeID) const {
+        return valuesMap.getData(nodeID.tableID)[nodeID.offset];
+    }
+    void setValue(common::nodeID_t nodeID, T value) {
+        valuesMap.getData(nodeID.tableID)[nodeID.offset] = value;
+        hasValuesMap.getData(nodeID.tableID)[nodeID.offset] = 1;
+    }
+
+private:
+    T* values = nullptr;
+    uint8_t* hasValues = nullptr;
+    function::GDSDenseObjectManager<T> valuesMap;
+    function::GDSDenseObjectManager<uint8_t> hasValuesMap;
+};
+
+class TouchedNodes {
+public:
+    void append(const std::vector<common::nodeID_t>& nodeIDs) {
+        std::unique_lock lck{mtx};
+        touchedNodeIDs.insert(touchedNodeIDs.end(), nodeIDs.begin(), nodeIDs.end());
+    }
+
+    // Sorted so that the sequential work on the touched nodes is deterministic.
+    std::vector<common::nodeID_t> getSortedNodeIDs() {
+        std::sort(touchedNodeIDs.begin(), touchedNodeIDs.end());
+        return touchedNodeIDs;
+    }
+
+private:
+    std::mutex mtx;
+    std::vector<common::nodeID_t> touchedNodeIDs;
+};
+
+// Reads the previous result and the touched property of every node, and collects the nodes to
+// recompute.
+template<typename T>
+class PreviousResultsScanVertexCompute final : public function::GDSVertexCompute {
+public:
+    PreviousResultsScanVertexCompute(PreviousResults<T>& previousResults, int64_t touchedSince,
+        TouchedNodes& touchedNodes, common::NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, previousResults{previousResults},
+          touchedSince{touchedSince}, touchedNodes{touchedNodes} {}
+
+    void beginOnTableInternal(common::table_id_t tableID) override {
+        previousResults.pinTable(tableID);
+    }
+
+    void vertexCompute(const graph::VertexScanState::Chunk& chunk) override {
+        auto nodeIDs = chunk.getNodeIDs();
+        auto previous = chunk.getProperties<T>(0);
+        auto touched = chunk.getProperties<int64_t>(1);
+        std::vector<common::nodeID_t> localTouchedNodeIDs;
+        for (auto i = 0u; i < chunk.size(); ++i) {
+            auto offset = nodeIDs[i].offset;
+            if (skip(offset)) {
+                continue;
+            }
+            if (chunk.isNull(0, i)) {
+                localTouchedNodeIDs.push_back(nodeIDs[i]);
+                continue;
+            }
+            previousResults.setValue(offset, previous[i]);
+            if (!chunk.isNull(1, i) && touched[i] >= touchedSince) {
+                localTouchedNodeIDs.push_back(nodeIDs[i]);
+            }
+        }
+        if (!localTouchedNodeIDs.empty()) {
+            touchedNodes.append(localTouchedNodeIDs);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<PreviousResultsScanVertexCompute<T>>(previousResults,
+            touchedSince, touchedNodes, nodeMask);
+    }
+
+private:
+    PreviousResults<T>& previousResults;
+    int64_t touchedSince;
+    TouchedNodes& touchedNodes;
+};
+
+} // namespace algo_extension
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
 #include "binder/expression/lambda_expression.h"
+#include "binder/expression/parameter_expression.h"
 #include "binder/expression_visitor.h"
 #include "binder/query/return_with_clause/bound_return_clause.h"
 #include "binder/query/return_with_clause/bound_with_clause.h"
@@ -301,6 +302,10 @@ std::shared_ptr<Expression> Binder::bindSkipLimitExpression(const ParsedExpressi
         throw BinderException(
             "The number of rows to skip/limit must be a parameter/literal expression.");
     }
+    if (boundExpression->expressionType == ExpressionType::PARAMETER) {
+        // The number is folded into the physical plan when it is mapped.
+        boundExpression->constCast<ParameterExpression>().markValueUsed();
+    }
     return boundExpression;
 }
 
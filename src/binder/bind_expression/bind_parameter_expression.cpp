@@ -14,7 +14,10 @@ std::shared_ptr<Expression> ExpressionBinder::bindParameterExpression(
     auto& parsedParameterExpression = parsedExpression.constCast<ParsedParameterExpression>();
     auto parameterName = parsedParameterExpression.getParameterName();
     if (knownParameters.contains(parameterName)) {
-        return make_shared<ParameterExpression>(parameterName, *knownParameters.at(parameterName));
+        auto expression =
+            make_shared<ParameterExpression>(parameterName, *knownParameters.at(parameterName));
+        boundParameters.push_back(expression);
+        return expression;
     }
     // LCOV_EXCL_START
     throw BinderException(
@@ -1,15 +1,21 @@
 #include "binder/expression/expression_util.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "binder/binder.h"
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/node_rel_expression.h"
 #include "binder/expression/parameter_expression.h"
+#include "binder/expression/scalar_function_expression.h"
 #include "common/exception/binder.h"
 #include "common/exception/runtime.h"
 #include "common/type_utils.h"
 #include "common/types/value/nested.h"
+#include "function/arithmetic/vector_arithmetic_functions.h"
+#include "function/built_in_function_utils.h"
+#include "function/list/vector_list_functions.h"
+#include "function/string/vector_string_functions.h"
 
 using namespace kuzu::common;
 
@@ -439,6 +445,81 @@ bool ExpressionUtil::canEvaluateAsLiteral(const Expression& expr) {
     }
 }
 
+static bool isSafeDivisor(const Expression& expr) {
+    if (expr.expressionType != ExpressionType::LITERAL) {
+        return false;
+    }
+    auto value = expr.constCast<LiteralExpression>().getValue();
+    if (value.isNull() || value == Value::createDefaultValue(value.getDataType())) {
+        return false;
+    }
+    // Dividing the smallest integer by -1 overflows.
+    return value.toString() != "-1";
+}
+
+// Arithmetic can overflow, so only functions that are defined for every input are assumed not to
+// throw. Division and modulo are if their divisor is a safe constant, casts if they only widen and
+// regular expressions if their pattern is a valid constant.
+static bool canFunctionThrow(const ScalarFunctionExpression& expr) {
+    static const std::unordered_set<std::string> totalFunctions{function::LowerFunction::name,
+        function::UpperFunction::name, function::ContainsFunction::name,
+        function::StartsWithFunction::name, function::EndsWithFunction::name,
+        function::SizeFunction::name, function::ListContainsFunction::name};
+    auto& name = expr.getFunction().name;
+    if (totalFunctions.contains(name)) {
+        return false;
+    }
+    if (name == function::DivideFunction::name || name == function::ModuloFunction::name) {
+        return !isSafeDivisor(*expr.getChild(1));
+    }
+    if (name.starts_with("CAST")) {
+        auto sourceTypeID = expr.getChild(0)->getDataType().getLogicalTypeID();
+        auto targetTypeID = expr.getDataType().getLogicalTypeID();
+        // Implicit casts only widen, so they are defined for every input value.
+        return sourceTypeID != LogicalTypeID::ANY && targetTypeID != LogicalTypeID::STRING &&
+               function::BuiltInFunctionsUtils::getCastCost(sourceTypeID, targetTypeID) ==
+                   UNDEFINED_CAST_COST;
+    }
+    if (name.starts_with("REGEXP")) {
+        return expr.getChild(1)->expressionType != ExpressionType::LITERAL;
+    }
+    return true;
+}
+
+bool ExpressionUtil::canEvaluateWithoutError(const Expression& expr) {
+    switch (expr.expressionType) {
+    case ExpressionType::PROPERTY:
+    case ExpressionType::VARIABLE:
+    case ExpressionType::LITERAL:
+    case ExpressionType::PARAMETER:
+        return true;
+    case ExpressionType::FUNCTION: {
+        if (canFunctionThrow(expr.constCast<ScalarFunctionExpression>())) {
+            return false;
+        }
+        for (auto& child : expr.getChildren()) {
+            if (!canEvaluateWithoutError(*child)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    default:
+        break;
+    }
+    if (!ExpressionTypeUtil::isBoolean(expr.expressionType) &&
+        !ExpressionTypeUtil::isComparison(expr.expressionType) &&
+        !ExpressionTypeUtil::isNullOperator(expr.expressionType)) {
+        return false;
+    }
+    for (auto& child : expr.getChildren()) {
+        if (!canEvaluateWithoutError(*child)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Value ExpressionUtil::evaluateAsLiteralValue(const Expression& expr) {
     KU_ASSERT(canEvaluateAsLiteral(expr));
     auto value = Value::createDefaultValue(expr.dataType);
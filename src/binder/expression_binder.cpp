@@ -150,5 +150,14 @@ void ExpressionBinder::addParameter(const std::string& name, std::shared_ptr<Val
     knownParameters[name] = value;
 }
 
+bool ExpressionBinder::isParameterValueUsed() const {
+    for (auto& parameter : boundParameters) {
+        if (parameter->isValueUsed()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace binder
 } // namespace kuzu
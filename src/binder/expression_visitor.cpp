@@ -9,6 +9,7 @@
 #include "binder/expression/subquery_expression.h"
 #include "common/exception/not_implemented.h"
 #include "function/arithmetic/vector_arithmetic_functions.h"
+#include "function/date/vector_date_functions.h"
 #include "function/sequence/sequence_functions.h"
 #include "function/uuid/vector_uuid_functions.h"
 
@@ -200,6 +201,25 @@ bool ExpressionVisitor::isRandom(const Expression& expression) {
     return false;
 }
 
+bool ExpressionVisitor::isNonDeterministic(const Expression& expression) {
+    if (expression.expressionType == ExpressionType::FUNCTION) {
+        auto funcName = expression.constCast<ScalarFunctionExpression>().getFunction().name;
+        if (funcName == function::GenRandomUUIDFunction::name ||
+            funcName == function::RandFunction::name ||
+            funcName == function::CurrentDateFunction::name ||
+            funcName == function::CurrentTimestampFunction::name ||
+            funcName == function::NextValFunction::name) {
+            return true;
+        }
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(expression)) {
+        if (isNonDeterministic(*child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void DependentVarNameCollector::visitSubqueryExpr(std::shared_ptr<Expression> expr) {
     auto& subqueryExpr = expr->constCast<SubqueryExpression>();
     for (auto& node : subqueryExpr.getQueryGraphCollection()->getQueryNodes()) {
@@ -307,6 +327,12 @@ bool ConstantExpressionVisitor::visitFunction(const Expression& expr) {
     if (funcExpr.getFunction().name == function::RandFunction::name) {
         return false;
     }
+    // Evaluated against the transaction the query runs in, which may differ from the one it was
+    // compiled in if the plan is cached.
+    if (funcExpr.getFunction().name == function::CurrentDateFunction::name ||
+        funcExpr.getFunction().name == function::CurrentTimestampFunction::name) {
+        return false;
+    }
     return visitChildren(expr);
 }
 
@@ -0,0 +1,44 @@
+#include "binder/visitor/deterministic_statement_analyzer.h"
+
+#include "binder/expression_visitor.h"
+#include "binder/query/reading_clause/bound_match_clause.h"
+#include "binder/query/reading_clause/bound_unwind_clause.h"
+
+namespace kuzu {
+namespace binder {
+
+void DeterministicStatementAnalyzer::visitMatch(const BoundReadingClause& readingClause) {
+    auto& matchClause = readingClause.constCast<BoundMatchClause>();
+    if (matchClause.hasPredicate()) {
+        visitExpression(matchClause.getPredicate());
+    }
+}
+
+void DeterministicStatementAnalyzer::visitUnwind(const BoundReadingClause& readingClause) {
+    visitExpression(readingClause.constCast<BoundUnwindClause>().getInExpr());
+}
+
+void DeterministicStatementAnalyzer::visitProjectionBody(
+    const BoundProjectionBody& projectionBody) {
+    for (auto& expression : projectionBody.getProjectionExpressions()) {
+        visitExpression(expression);
+    }
+    for (auto& expression : projectionBody.getOrderByExpressions()) {
+        visitExpression(expression);
+    }
+}
+
+void DeterministicStatementAnalyzer::visitProjectionBodyPredicate(
+    const std::shared_ptr<Expression>& predicate) {
+    visitExpression(predicate);
+}
+
+void DeterministicStatementAnalyzer::visitExpression(
+    const std::shared_ptr<Expression>& expression) {
+    if (deterministic && ExpressionVisitor::isNonDeterministic(*expression)) {
+        deterministic = false;
+    }
+}
+
+} // namespace binder
+} // namespace kuzu
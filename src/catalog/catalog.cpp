@@ -27,7 +27,7 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace catalog {
 
-Catalog::Catalog() : version{0} {
+Catalog::Catalog() : version{0}, schemaVersion{0} {
     initCatalogSets();
     registerBuiltInFunctions();
 }
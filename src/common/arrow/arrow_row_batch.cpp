@@ -6,6 +6,7 @@
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "common/vector/value_vector.h"
 #include "processor/result/flat_tuple.h"
 #include "storage/storage_utils.h"
 
@@ -273,6 +274,153 @@ void ArrowRowBatch::appendValue(ArrowVector* vector, const Value& value,
     vector->numValues++;
 }
 
+// Copies the null mask of the selected values. The validity buffer is initialized to all valid.
+static void copyColumnNullMask(ArrowVector* vector, const ValueVector& valueVector,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues) {
+    if (valueVector.hasNoNullsGuarantee()) {
+        return;
+    }
+    for (auto i = 0u; i < numValues; i++) {
+        if (valueVector.isNull(selVector[startIdx + i])) {
+            setBitToZero(vector->validity.data(), vector->numValues + i);
+            vector->numNulls++;
+        }
+    }
+}
+
+template<typename T>
+static void copyFixedWidthColumn(ArrowVector* vector, const ValueVector& valueVector,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues) {
+    auto dst = reinterpret_cast<T*>(vector->data.data()) + vector->numValues;
+    auto src = reinterpret_cast<const T*>(valueVector.getData());
+    if (selVector.isStatic()) {
+        // Selected positions are consecutive.
+        std::memcpy(dst, src + selVector[startIdx], numValues * sizeof(T));
+    } else {
+        for (auto i = 0u; i < numValues; i++) {
+            dst[i] = src[selVector[startIdx + i]];
+        }
+    }
+}
+
+static void copyBoolColumn(ArrowVector* vector, const ValueVector& valueVector,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues) {
+    auto src = reinterpret_cast<const bool*>(valueVector.getData());
+    for (auto i = 0u; i < numValues; i++) {
+        if (src[selVector[startIdx + i]]) {
+            setBitToOne(vector->data.data(), vector->numValues + i);
+        } else {
+            setBitToZero(vector->data.data(), vector->numValues + i);
+        }
+    }
+}
+
+static void copyIntervalColumn(ArrowVector* vector, const ValueVector& valueVector,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues) {
+    auto dst = reinterpret_cast<int64_t*>(vector->data.data()) + vector->numValues;
+    auto src = reinterpret_cast<const interval_t*>(valueVector.getData());
+    for (auto i = 0u; i < numValues; i++) {
+        auto& interval = src[selVector[startIdx + i]];
+        dst[i] = interval.micros + interval.days * Interval::MICROS_PER_DAY +
+                 interval.months * Interval::MICROS_PER_MONTH;
+    }
+}
+
+static void copyStringColumn(ArrowVector* vector, const ValueVector& valueVector,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues) {
+    auto offsets = reinterpret_cast<std::uint32_t*>(vector->data.data());
+    auto src = reinterpret_cast<const ku_string_t*>(valueVector.getData());
+    if (vector->numValues == 0) {
+        offsets[0] = 0;
+    }
+    // Resize the overflow buffer once for all strings of the column.
+    uint64_t numBytes = 0;
+    for (auto i = 0u; i < numValues; i++) {
+        auto pos = selVector[startIdx + i];
+        if (!valueVector.isNull(pos)) {
+            numBytes += src[pos].len;
+        }
+    }
+    vector->overflow.resize(offsets[vector->numValues] + numBytes + 1);
+    for (auto i = 0u; i < numValues; i++) {
+        auto pos = selVector[startIdx + i];
+        auto idx = vector->numValues + i;
+        if (valueVector.isNull(pos)) {
+            offsets[idx + 1] = offsets[idx];
+            continue;
+        }
+        auto& str = src[pos];
+        std::memcpy(vector->overflow.data() + offsets[idx], str.getData(), str.len);
+        offsets[idx + 1] = offsets[idx] + str.len;
+    }
+}
+
+void ArrowRowBatch::appendColumn(ArrowVector* vector, const ValueVector& valueVector,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues,
+    bool fallbackExtensionTypes) {
+    switch (valueVector.dataType.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        copyBoolColumn(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::INT128: {
+        copyFixedWidthColumn<int128_t>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_TZ: {
+        copyFixedWidthColumn<int64_t>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::UINT32: {
+        copyFixedWidthColumn<int32_t>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::UINT16: {
+        copyFixedWidthColumn<int16_t>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT8: {
+        copyFixedWidthColumn<int8_t>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::DOUBLE: {
+        copyFixedWidthColumn<double>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::FLOAT: {
+        copyFixedWidthColumn<float>(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::INTERVAL: {
+        copyIntervalColumn(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING: {
+        copyStringColumn(vector, valueVector, selVector, startIdx, numValues);
+    } break;
+    default: {
+        // Nested and extension types go through Value.
+        auto value = Value::createDefaultValue(valueVector.dataType);
+        for (auto i = 0u; i < numValues; i++) {
+            auto pos = selVector[startIdx + i];
+            value.setNull(valueVector.isNull(pos));
+            if (!value.isNull()) {
+                value.copyFromColLayout(
+                    valueVector.getData() + pos * valueVector.getNumBytesPerValue(),
+                    const_cast<ValueVector*>(&valueVector));
+            }
+            appendValue(vector, value, fallbackExtensionTypes);
+        }
+        return;
+    }
+    }
+    copyColumnNullMask(vector, valueVector, selVector, startIdx, numValues);
+    vector->numValues += numValues;
+}
+
 template<LogicalTypeID DT>
 void ArrowRowBatch::templateCopyNonNullValue(ArrowVector* vector, const Value& value,
     std::int64_t pos, bool) {
@@ -1018,5 +1166,18 @@ void ArrowRowBatch::append(const processor::FlatTuple& tuple) {
     numTuples++;
 }
 
+void ArrowRowBatch::append(const std::vector<ValueVector*>& valueVectors,
+    const SelectionView& selVector, uint64_t startIdx, uint64_t numValues) {
+    KU_ASSERT(valueVectors.size() == vectors.size());
+    if (numValues == 0) {
+        return;
+    }
+    for (auto i = 0u; i < vectors.size(); i++) {
+        appendColumn(vectors[i].get(), *valueVectors[i], selVector, startIdx, numValues,
+            fallbackExtensionTypes);
+    }
+    numTuples += numValues;
+}
+
 } // namespace common
 } // namespace kuzu
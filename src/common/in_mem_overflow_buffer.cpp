@@ -50,6 +50,14 @@ void InMemOverflowBuffer::preventDestruction() {
     }
 }
 
+uint64_t InMemOverflowBuffer::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : blocks) {
+        memoryUsage += block->size();
+    }
+    return memoryUsage;
+}
+
 void InMemOverflowBuffer::allocateNewBlock(uint64_t size) {
     std::unique_ptr<BufferBlock> newBlock;
     if (blocks.empty()) {
@@ -46,8 +46,10 @@ void ProgressBar::finishPipeline(uint64_t queryID) {
     if (!trackProgress) {
         return;
     }
+    // Independent pipelines can finish concurrently.
+    std::lock_guard<std::mutex> lock(progressBarLock);
     numPipelinesFinished++;
-    updateProgress(queryID, 0.0);
+    updateDisplay(queryID, 0.0);
 }
 
 void ProgressBar::updateProgress(uint64_t queryID, double curPipelineProgress) {
@@ -1,8 +1,12 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "main/client_context.h"
 #include "main/database.h"
 #include "processor/processor.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 #if defined(__APPLE__)
 #include <pthread.h>
@@ -20,20 +24,27 @@ TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos)
 #else
 TaskScheduler::TaskScheduler(uint64_t numWorkerThreads)
 #endif
-    : stopWorkerThreads{false}, nextScheduledTaskID{0} {
+    : nextQueueIdx{0}, stopWorkerThreads{false}, wakeUpEpoch{0}, numIdleWorkers{0},
+      nextScheduledTaskID{0} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
+    for (auto& numTasks : numQueuedTasks) {
+        numTasks = 0;
+    }
+    for (auto n = 0u; n < std::max<uint64_t>(numWorkerThreads, 1); ++n) {
+        workerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
     for (auto n = 0u; n < numWorkerThreads; ++n) {
-        workerThreads.emplace_back([&] { runWorkerThread(); });
+        workerThreads.emplace_back([this, n] { runWorkerThread(n); });
     }
 }
 
 TaskScheduler::~TaskScheduler() {
-    lock_t lck{taskSchedulerMtx};
+    lock_t lck{idleWorkerMtx};
     stopWorkerThreads = true;
     lck.unlock();
-    cv.notify_all();
+    idleWorkerCV.notify_all();
     for (auto& thread : workerThreads) {
         thread.join();
     }
@@ -41,11 +52,17 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool launchNewWorkerThread) {
-    for (auto& dependency : task->children) {
-        scheduleTaskAndWaitOrError(dependency, context);
-        if (dependency->terminate()) {
+    if (task->hasConcurrentDependencies()) {
+        if (!scheduleDependenciesConcurrentlyAndWaitOrError(*task, context)) {
             return;
         }
+    } else {
+        for (auto& dependency : task->children) {
+            scheduleTaskAndWaitOrError(dependency, context);
+            if (dependency->terminate()) {
+                return;
+            }
+        }
     }
     std::thread newWorkerThread;
     if (launchNewWorkerThread) {
@@ -55,10 +72,17 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         // numThreadsRegistered field of the task, tt does not keep track of the thread ids or
         // anything specific to the thread.
         task->registerThread();
-        newWorkerThread = std::thread(runTask, task.get());
+        newWorkerThread =
+            std::thread([taskPtr = task.get(), memoryTracker = context->memoryTracker] {
+                storage::QueryMemoryTrackerScope memoryTrackerScope{memoryTracker};
+                runTask(taskPtr);
+            });
     }
-    auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
+    auto scheduledTask = pushTaskIntoQueue(task, *context);
+    // Only wake up a single worker. Each worker that manages to register itself to a task wakes up
+    // the next one (see runWorkerThread()), so we do not wake up all idle workers every time a
+    // (short) task is pushed.
+    wakeUpIdleWorker();
     std::unique_lock<std::mutex> taskLck{task->taskMtx, std::defer_lock};
     while (true) {
         taskLck.lock();
@@ -93,12 +117,118 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         newWorkerThread.join();
     }
     if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
+        removeErroringTask(*scheduledTask);
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+// Collects the dependency subtree of the task in post order, so every task is listed after all of
+// its own dependencies.
+static void collectDependencies(const Task& task, std::vector<std::shared_ptr<Task>>& result) {
+    for (auto& dependency : task.children) {
+        collectDependencies(*dependency, result);
+        result.push_back(dependency);
+    }
+}
+
+static bool dependenciesCompleted(const Task& task,
+    const std::unordered_set<const Task*>& completedTasks) {
+    for (auto& dependency : task.children) {
+        if (!completedTasks.contains(dependency.get())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TaskScheduler::scheduleDependenciesConcurrentlyAndWaitOrError(const Task& task,
+    processor::ExecutionContext* context) {
+    std::vector<std::shared_ptr<Task>> pendingTasks;
+    collectDependencies(task, pendingTasks);
+    std::vector<std::shared_ptr<ScheduledTask>> runningTasks;
+    std::unordered_set<const Task*> completedTasks;
+    std::exception_ptr exceptionPtr = nullptr;
+    bool terminated = false;
+    lock_t lck{taskFinishedMtx};
+    while (true) {
+        // Reap the tasks that have finished. Tasks that completed successfully are removed from
+        // the queue by the worker threads (see getTaskAndRegister()), erroring ones are removed
+        // here.
+        for (auto it = runningTasks.begin(); it != runningTasks.end();) {
+            auto& scheduledTask = *it;
+            auto runningTask = scheduledTask->task.get();
+            if (exceptionPtr == nullptr && runningTask->hasException()) {
+                exceptionPtr = runningTask->getExceptionPtr();
+            }
+            if (!runningTask->isCompleted()) {
+                ++it;
+                continue;
+            }
+            if (runningTask->hasException()) {
+                removeErroringTask(*scheduledTask);
+            } else {
+                completedTasks.insert(runningTask);
+                terminated = terminated || runningTask->terminate();
+            }
+            it = runningTasks.erase(it);
+        }
+        if (exceptionPtr != nullptr || terminated) {
+            // Do not schedule anything else. Tasks that no worker has picked up yet can be
+            // dropped right away.
+            pendingTasks.clear();
+            for (auto it = runningTasks.begin(); it != runningTasks.end();) {
+                if (removeTaskIfNotStarted(**it)) {
+                    it = runningTasks.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        // Schedule every task whose dependencies have completed.
+        auto scheduledNewTask = false;
+        for (auto it = pendingTasks.begin(); it != pendingTasks.end();) {
+            if (dependenciesCompleted(**it, completedTasks)) {
+                runningTasks.push_back(pushTaskIntoQueue(*it, *context));
+                scheduledNewTask = true;
+                it = pendingTasks.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (scheduledNewTask) {
+            wakeUpIdleWorker();
+        }
+        if (runningTasks.empty()) {
+            KU_ASSERT(pendingTasks.empty());
+            break;
+        }
+        bool timedWait = false;
+        auto timeout = 0u;
+        if (context->clientContext->hasTimeout()) {
+            timeout = context->clientContext->getTimeoutRemainingInMS();
+            if (timeout == 0) {
+                context->clientContext->interrupt();
+            } else {
+                timedWait = true;
+            }
+        } else if (exceptionPtr != nullptr) {
+            // Interrupt the remaining tasks, so other threads can stop working on them early.
+            context->clientContext->interrupt();
+        }
+        if (timedWait) {
+            taskFinishedCV.wait_for(lck, std::chrono::milliseconds(timeout));
+        } else {
+            taskFinishedCV.wait(lck);
+        }
+    }
+    lck.unlock();
+    if (exceptionPtr != nullptr) {
+        std::rethrow_exception(exceptionPtr);
+    }
+    return !terminated;
+}
+
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
 #if defined(__APPLE__)
     qos_class_t qosClass = (qos_class_t)threadQos;
     if (qosClass != QOS_CLASS_DEFAULT && qosClass != QOS_CLASS_UNSPECIFIED) {
@@ -106,42 +236,160 @@ void TaskScheduler::runWorkerThread() {
         KU_UNUSED(pthreadQosStatus);
     }
 #endif
-    std::unique_lock<std::mutex> lck{taskSchedulerMtx, std::defer_lock};
-    std::exception_ptr exceptionPtr = nullptr;
-    std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
     while (true) {
-        // Warning: Threads acquire a global lock (using taskSchedulerMutex) right before
-        // deregistering themselves from a task (and they immediately register themselves for
-        // another task without releasing the lock). This acquire-right-before-deregistering ensures
-        // that all writes that were done by threads in Task_j happen before a Task_{j+1} which
-        // depends on Task_j can start. That's because before Task_{j+1} can start, each thread T_i
-        // working on Task_j will need to deregister itself using the global lock. Therefore, by the
-        // time any thread gets to start on Task_{j+1}, all writes made to Task_j by T_i will become
-        // globally visible because T_i grabbed the global lock before deregistering (and without
-        // T_i deregistering Task_{j+1} cannot start).
-        lck.lock();
+        auto scheduledTask = waitForTaskAndRegister(workerIdx);
+        if (scheduledTask == nullptr) {
+            return;
+        }
+        // Keep charging the query until the task is finalized.
+        storage::MemoryManager::setQueryMemoryTracker(scheduledTask->memoryTracker);
+        // There may be more work in the queues, so pass the wake-up on to another idle worker. The
+        // chain stops at the first worker that cannot register itself to any task.
+        wakeUpIdleWorker();
+        auto task = scheduledTask->task.get();
+        try {
+            task->run();
+        } catch (std::exception& e) {
+            task->setException(std::current_exception());
+        }
+        // Workers deregister themselves under the task lock, and tasks that depend on this one are
+        // only scheduled once it is seen completed under the same lock. So all writes done by the
+        // workers of a task are visible to the workers of the tasks that depend on it.
+        task->deRegisterThreadAndFinalizeTask();
+        storage::MemoryManager::setQueryMemoryTracker(nullptr);
+        if (task->isCompleted() || task->hasException()) {
+            notifyTaskFinished();
+        }
+    }
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::waitForTaskAndRegister(uint64_t workerIdx) {
+    while (true) {
+        // Read the epoch before looking for a task. Pushing a task changes the epoch afterwards,
+        // so the worker does not go to sleep while there is a task it has not seen.
+        auto epoch = wakeUpEpoch.load();
+        if (stopWorkerThreads) {
+            return nullptr;
+        }
+        auto scheduledTask = getTaskAndRegister(workerIdx);
         if (scheduledTask != nullptr) {
-            if (exceptionPtr != nullptr) {
-                scheduledTask->task->setException(exceptionPtr);
-                exceptionPtr = nullptr;
-            }
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-            scheduledTask = nullptr;
+            return scheduledTask;
         }
-        cv.wait(lck, [&] {
-            scheduledTask = getTaskAndRegister();
-            return scheduledTask != nullptr || stopWorkerThreads;
-        });
+        lock_t lck{idleWorkerMtx};
+        numIdleWorkers++;
+        idleWorkerCV.wait(lck, [&] { return stopWorkerThreads || wakeUpEpoch.load() != epoch; });
+        numIdleWorkers--;
+    }
+}
+
+void TaskScheduler::wakeUpIdleWorker() {
+    wakeUpEpoch++;
+    if (numIdleWorkers > 0) {
+        // Taking the lock makes sure a worker that is about to sleep either sees the new epoch or
+        // is already waiting.
+        lock_t lck{idleWorkerMtx};
         lck.unlock();
-        if (stopWorkerThreads) {
+        idleWorkerCV.notify_one();
+    }
+}
+
+void TaskScheduler::notifyTaskFinished() {
+    lock_t lck{taskFinishedMtx};
+    lck.unlock();
+    taskFinishedCV.notify_all();
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+    const processor::ExecutionContext& context) {
+    const auto priority = context.priority;
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++, priority,
+        context.memoryTracker);
+    scheduledTask->queueIdx = nextQueueIdx++ % workerQueues.size();
+    auto& queue = *workerQueues[scheduledTask->queueIdx];
+    lock_t lck{queue.mtx};
+    // Keep the queue ordered by priority and FIFO within the same priority.
+    auto it = queue.tasks.end();
+    while (it != queue.tasks.begin() && (*std::prev(it))->priority < priority) {
+        --it;
+    }
+    queue.tasks.insert(it, scheduledTask);
+    numQueuedTasks[static_cast<size_t>(priority)]++;
+    return scheduledTask;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(uint64_t workerIdx) {
+    // Look for tasks of the highest priority that has queued tasks first. If none of them accepts
+    // more threads, look for tasks of lower priorities.
+    for (auto priority = numQueuedTasks.size(); priority-- > 0;) {
+        if (numQueuedTasks[priority] == 0) {
+            continue;
+        }
+        // Look into the worker's own queue first and then steal from the queues of the others.
+        for (auto i = 0u; i < workerQueues.size(); ++i) {
+            auto& queue = *workerQueues[(workerIdx + i) % workerQueues.size()];
+            auto scheduledTask =
+                getTaskAndRegister(queue, static_cast<WorkloadPriority>(priority));
+            if (scheduledTask != nullptr) {
+                return scheduledTask;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(WorkerQueue& queue,
+    WorkloadPriority minPriority) {
+    lock_t lck{queue.mtx};
+    auto it = queue.tasks.begin();
+    while (it != queue.tasks.end() && (*it)->priority >= minPriority) {
+        auto task = (*it)->task;
+        if (!task->registerThread()) {
+            // If we cannot register for a thread it is because of three possibilities:
+            // (i) maximum number of threads have registered for task and the task is completed
+            // without an exception; or (ii) same as (i) but the task has not yet successfully
+            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
+            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
+            // manually removed.
+            if (task->isCompletedSuccessfully()) { // option (i)
+                numQueuedTasks[static_cast<size_t>((*it)->priority)]--;
+                it = queue.tasks.erase(it);
+            } else { // option (ii) or (iii): keep the task in the queue.
+                ++it;
+            }
+        } else {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::removeErroringTask(const ScheduledTask& scheduledTask) {
+    auto& queue = *workerQueues[scheduledTask.queueIdx];
+    lock_t lck{queue.mtx};
+    for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it) {
+        if (scheduledTask.ID == (*it)->ID) {
+            numQueuedTasks[static_cast<size_t>(scheduledTask.priority)]--;
+            queue.tasks.erase(it);
             return;
         }
-        try {
-            scheduledTask->task->run();
-        } catch (std::exception& e) {
-            exceptionPtr = std::current_exception();
+    }
+}
+
+bool TaskScheduler::removeTaskIfNotStarted(const ScheduledTask& scheduledTask) {
+    auto& queue = *workerQueues[scheduledTask.queueIdx];
+    // Workers register themselves to the tasks of a queue while holding its lock.
+    lock_t lck{queue.mtx};
+    if (scheduledTask.task->numThreadsRegistered > 0) {
+        return false;
+    }
+    for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it) {
+        if (scheduledTask.ID == (*it)->ID) {
+            numQueuedTasks[static_cast<size_t>(scheduledTask.priority)]--;
+            queue.tasks.erase(it);
+            return true;
         }
     }
+    return false;
 }
 #else
 // Single-threaded version of TaskScheduler
@@ -167,12 +415,24 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
-#endif
 
-std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+    const processor::ExecutionContext& context) {
     lock_t lck{taskSchedulerMtx};
-    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
-    taskQueue.push_back(scheduledTask);
+    return pushTaskIntoQueueNoLock(task, context);
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueueNoLock(
+    const std::shared_ptr<Task>& task, const processor::ExecutionContext& context) {
+    const auto priority = context.priority;
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++, priority,
+        context.memoryTracker);
+    // Keep the queue ordered by priority and FIFO within the same priority.
+    auto it = taskQueue.end();
+    while (it != taskQueue.begin() && (*std::prev(it))->priority < priority) {
+        --it;
+    }
+    taskQueue.insert(it, scheduledTask);
     return scheduledTask;
 }
 
@@ -204,6 +464,10 @@ std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
     lock_t lck{taskSchedulerMtx};
+    removeTaskNoLock(scheduledTaskID);
+}
+
+void TaskScheduler::removeTaskNoLock(uint64_t scheduledTaskID) {
     for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
         if (scheduledTaskID == (*it)->ID) {
             taskQueue.erase(it);
@@ -211,6 +475,7 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
         }
     }
 }
+#endif
 
 void TaskScheduler::runTask(Task* task) {
     try {
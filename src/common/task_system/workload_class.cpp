@@ -0,0 +1,147 @@
+#include "common/task_system/workload_class.h"
+
+#include <chrono>
+
+#include "common/assert.h"
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "main/client_context.h"
+
+namespace kuzu {
+namespace common {
+
+WorkloadPriority WorkloadPriorityUtils::fromString(const std::string& str) {
+    auto normalizedStr = StringUtils::getUpper(str);
+    if (normalizedStr == "LOW") {
+        return WorkloadPriority::LOW;
+    }
+    if (normalizedStr == "NORMAL") {
+        return WorkloadPriority::NORMAL;
+    }
+    if (normalizedStr == "HIGH") {
+        return WorkloadPriority::HIGH;
+    }
+    throw RuntimeException(stringFormat(
+        "Cannot parse {} as a workload priority. Supported inputs are [LOW, NORMAL, HIGH]", str));
+}
+
+std::string WorkloadPriorityUtils::toString(WorkloadPriority priority) {
+    switch (priority) {
+    case WorkloadPriority::LOW:
+        return "LOW";
+    case WorkloadPriority::NORMAL:
+        return "NORMAL";
+    case WorkloadPriority::HIGH:
+        return "HIGH";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+WorkloadClassManager::WorkloadClassManager() : nextTicket{0} {
+    auto defaultClass = WorkloadClass();
+    defaultClass.name = WorkloadClass::DEFAULT_CLASS_NAME;
+    workloadClasses.emplace(defaultClass.name, WorkloadClassState(defaultClass));
+}
+
+void WorkloadClassManager::setWorkloadClass(WorkloadClass workloadClass) {
+    workloadClass.name = StringUtils::getLower(workloadClass.name);
+    std::unique_lock lck{mtx};
+    if (workloadClasses.contains(workloadClass.name)) {
+        workloadClasses.at(workloadClass.name).workloadClass = std::move(workloadClass);
+    } else {
+        auto name = workloadClass.name;
+        workloadClasses.emplace(name, WorkloadClassState(std::move(workloadClass)));
+    }
+    lck.unlock();
+    // The concurrency limit might have been raised.
+    cv.notify_all();
+}
+
+bool WorkloadClassManager::containsWorkloadClass(const std::string& name) const {
+    std::unique_lock lck{mtx};
+    return workloadClasses.contains(StringUtils::getLower(name));
+}
+
+WorkloadClass WorkloadClassManager::getWorkloadClass(const std::string& name) const {
+    std::unique_lock lck{mtx};
+    const auto lowerCaseName = StringUtils::getLower(name);
+    if (!workloadClasses.contains(lowerCaseName)) {
+        throw RuntimeException(stringFormat("Workload class {} does not exist.", name));
+    }
+    return workloadClasses.at(lowerCaseName).workloadClass;
+}
+
+std::vector<WorkloadClass> WorkloadClassManager::getWorkloadClasses() const {
+    std::unique_lock lck{mtx};
+    std::vector<WorkloadClass> result;
+    for (auto& [_, state] : workloadClasses) {
+        result.push_back(state.workloadClass);
+    }
+    return result;
+}
+
+WorkloadClassManager::WorkloadClassState& WorkloadClassManager::getStateNoLock(
+    const std::string& name) {
+    const auto lowerCaseName = StringUtils::getLower(name);
+    if (!workloadClasses.contains(lowerCaseName)) {
+        throw RuntimeException(stringFormat("Workload class {} does not exist.", name));
+    }
+    return workloadClasses.at(lowerCaseName);
+}
+
+WorkloadClass WorkloadClassManager::admitQuery(const std::string& name,
+    main::ClientContext& context) {
+    std::unique_lock lck{mtx};
+    auto& state = getStateNoLock(name);
+    if (numAdmissionsPerContext.contains(&context)) {
+        numAdmissionsPerContext.at(&context)++;
+        return state.workloadClass;
+    }
+    if (state.waitingQueries.empty() && state.canAdmitQuery()) {
+        state.numActiveQueries++;
+        numAdmissionsPerContext.emplace(&context, 1);
+        return state.workloadClass;
+    }
+    const auto ticket = nextTicket++;
+    state.waitingQueries.push_back(ticket);
+    while (state.waitingQueries.front() != ticket || !state.canAdmitQuery()) {
+        auto timedOut = context.hasTimeout() && context.getTimeoutRemainingInMS() == 0;
+        if (context.interrupted() || timedOut) {
+            std::erase(state.waitingQueries, ticket);
+            lck.unlock();
+            // The next query in the queue might be admitted now.
+            cv.notify_all();
+            throw InterruptException{};
+        }
+        cv.wait_for(lck, std::chrono::milliseconds(ADMISSION_WAIT_INTERVAL_IN_MS));
+    }
+    state.waitingQueries.pop_front();
+    state.numActiveQueries++;
+    numAdmissionsPerContext.emplace(&context, 1);
+    auto workloadClass = state.workloadClass;
+    lck.unlock();
+    // The next query in the queue might be admitted as well if the class is not full yet.
+    cv.notify_all();
+    return workloadClass;
+}
+
+void WorkloadClassManager::finishQuery(const std::string& name,
+    const main::ClientContext& context) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numAdmissionsPerContext.contains(&context));
+    if (--numAdmissionsPerContext.at(&context) > 0) {
+        return;
+    }
+    numAdmissionsPerContext.erase(&context);
+    auto& state = getStateNoLock(name);
+    KU_ASSERT(state.numActiveQueries > 0);
+    state.numActiveQueries--;
+    lck.unlock();
+    cv.notify_all();
+}
+
+} // namespace common
+} // namespace kuzu
@@ -1,5 +1,8 @@
 #include "function/gds/bfs_graph.h"
 
+#include <algorithm>
+
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_utils.h"
 #include "processor/execution_context.h"
 
@@ -116,11 +119,19 @@ bool DenseBFSGraph::tryAddParentWithWeight(nodeID_t boundNodeID, relID_t edgeID,
     }
 }
 
+// The iteration of a single weighted shortest path parent is the number of edges of the path,
+// saturated above any hop upper bound.
+static uint16_t getNumHopsThrough(const ParentList* boundParent) {
+    return std::min<uint32_t>(boundParent->getIter() + 1, UINT16_MAX);
+}
+
 bool DenseBFSGraph::tryAddSingleParentWithWeight(nodeID_t boundNodeID, relID_t edgeID,
     nodeID_t nbrNodeID, bool fwdEdge, double weight, ObjectBlock<ParentList>* block) {
     ParentList* expected = getParentListHead(nbrNodeID.offset);
+    auto boundParent = getParentListHead(boundNodeID);
     auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
-    parent->setCost(getParentListHead(boundNodeID)->getCost() + weight);
+    parent->setCost(boundParent->getCost() + weight);
+    parent->setIter(getNumHopsThrough(boundParent));
     while (parent->getCost() < getCost(expected)) {
         if (curData[nbrNodeID.offset].compare_exchange_strong(expected, parent)) {
             // Since each node can have one parent, set next ptr to nullptr.
@@ -133,6 +144,21 @@ bool DenseBFSGraph::tryAddSingleParentWithWeight(nodeID_t boundNodeID, relID_t e
     return false;
 }
 
+bool DenseBFSGraph::hasSinglePathLongerThan(uint64_t maxHops,
+    const NodeOffsetMaskMap* outputNodeMask) {
+    for (auto& [tableID, maxOffset] : maxOffsetMap) {
+        auto data = denseObjects.getData(tableID);
+        for (auto offset = 0u; offset < maxOffset; ++offset) {
+            auto parent = data[offset].load(std::memory_order_relaxed);
+            if (parent != nullptr && parent->getIter() > maxHops &&
+                DeltaSteppingBuckets::isOutputNode(outputNodeMask, {offset, tableID})) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 ParentList* DenseBFSGraph::getParentListHead(offset_t offset) {
     KU_ASSERT(curData);
     return curData[offset].load(std::memory_order_relaxed);
@@ -209,10 +235,12 @@ bool SparseBFSGraph::tryAddParentWithWeight(nodeID_t boundNodeID, relID_t edgeID
 bool SparseBFSGraph::tryAddSingleParentWithWeight(nodeID_t boundNodeID, relID_t edgeID,
     nodeID_t nbrNodeID, bool fwdEdge, double weight, ObjectBlock<ParentList>* block) {
     auto nbrCost = getCost(getParentListHead(nbrNodeID.offset));
-    auto newCost = getParentListHead(boundNodeID)->getCost() + weight;
+    auto boundParent = getParentListHead(boundNodeID);
+    auto newCost = boundParent->getCost() + weight;
     if (newCost < nbrCost) {
         auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
         parent->setCost(newCost);
+        parent->setIter(getNumHopsThrough(boundParent));
         parent->setNextPtr(nullptr);
         curData->erase(nbrNodeID.offset);
         curData->insert({nbrNodeID.offset, parent});
@@ -224,12 +252,26 @@ bool SparseBFSGraph::tryAddSingleParentWithWeight(nodeID_t boundNodeID, relID_t
         }
         auto parent = reserveParent(boundNodeID, edgeID, fwdEdge, block);
         parent->setCost(newCost);
+        parent->setIter(getNumHopsThrough(boundParent));
         parent->setNextPtr(nullptr);
         curData->insert({nbrNodeID.offset, parent});
     }
     return false;
 }
 
+bool SparseBFSGraph::hasSinglePathLongerThan(uint64_t maxHops,
+    const NodeOffsetMaskMap* outputNodeMask) {
+    for (auto& [tableID, parents] : sparseObjects.getData()) {
+        for (auto& [offset, parent] : parents) {
+            if (parent->getIter() > maxHops &&
+                DeltaSteppingBuckets::isOutputNode(outputNodeMask, {offset, tableID})) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 ParentList* SparseBFSGraph::getParentListHead(offset_t offset) {
     KU_ASSERT(curData);
     if (!curData->contains(offset)) {
@@ -0,0 +1,127 @@
+#include "function/gds/bidirectional_bfs.h"
+
+#include <algorithm>
+
+#include "common/constants.h"
+#include "common/exception/interrupt.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+BidirectionalBFS::BidirectionalBFS(Graph* graph, ExtendDirection extendDirection,
+    uint16_t upperBound)
+    : extendDirection{extendDirection}, upperBound{upperBound},
+      // The backward side extends in the opposite direction, so both directions are scanned.
+      scanner{graph, ExtendDirection::BOTH, {InternalKeyword::ID}} {}
+
+void BidirectionalBFS::initSide(Side& side, nodeID_t nodeID, bool fromSource) const {
+    auto addDirection = [&](ExtendDirection direction) {
+        side.directions.emplace_back(direction, (direction == ExtendDirection::FWD) == fromSource);
+    };
+    switch (extendDirection) {
+    case ExtendDirection::FWD: {
+        addDirection(fromSource ? ExtendDirection::FWD : ExtendDirection::BWD);
+    } break;
+    case ExtendDirection::BWD: {
+        addDirection(fromSource ? ExtendDirection::BWD : ExtendDirection::FWD);
+    } break;
+    case ExtendDirection::BOTH: {
+        addDirection(ExtendDirection::FWD);
+        addDirection(ExtendDirection::BWD);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    // The parent of the node a side starts from is invalid.
+    side.parents.insert({nodeID, Parent{}});
+    side.frontier.push_back(nodeID);
+}
+
+std::vector<BidirectionalBFSStep> BidirectionalBFS::search(main::ClientContext* context,
+    nodeID_t sourceNodeID, nodeID_t dstNodeID) {
+    KU_ASSERT(sourceNodeID != dstNodeID);
+    Side fwdSide, bwdSide;
+    initSide(fwdSide, sourceNodeID, true /* fromSource */);
+    initSide(bwdSide, dstNodeID, false /* fromSource */);
+    while (fwdSide.depth + bwdSide.depth < upperBound && !fwdSide.frontier.empty() &&
+           !bwdSide.frontier.empty()) {
+        // Before each expansion, the nodes visited by the two sides are disjoint and their
+        // distances to the source or the destination are exact. So the first node reached by both
+        // sides lies on a shortest path.
+        auto meetingNodeID = fwdSide.frontier.size() <= bwdSide.frontier.size() ?
+                                 expand(context, fwdSide, bwdSide) :
+                                 expand(context, bwdSide, fwdSide);
+        if (meetingNodeID.offset != INVALID_OFFSET) {
+            return getPath(fwdSide, bwdSide, meetingNodeID);
+        }
+    }
+    return {};
+}
+
+nodeID_t BidirectionalBFS::expand(main::ClientContext* context, Side& side,
+    const Side& otherSide) {
+    std::vector<nodeID_t> nextFrontier;
+    nodeID_t meetingNodeID;
+    side.depth++;
+    for (auto& boundNodeID : side.frontier) {
+        if (context->interrupted()) {
+            throw InterruptException{};
+        }
+        for (auto& [direction, isFwd] : side.directions) {
+            scanner.scanChunks(boundNodeID, direction, [&](const NbrScanState::Chunk& chunk, bool) {
+                // Every node reached by both sides in this expansion lies on a shortest path, so
+                // the rest of the expansion is skipped once one is found.
+                if (meetingNodeID.offset != INVALID_OFFSET) {
+                    return;
+                }
+                chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+                    auto nbrNodeID = neighbors[i];
+                    if (side.parents.contains(nbrNodeID)) {
+                        return;
+                    }
+                    auto edgeID = propertyVectors[0]->template getValue<relID_t>(i);
+                    side.parents.insert({nbrNodeID, Parent{boundNodeID, edgeID, isFwd}});
+                    nextFrontier.push_back(nbrNodeID);
+                    if (otherSide.parents.contains(nbrNodeID)) {
+                        meetingNodeID = nbrNodeID;
+                    }
+                });
+            });
+            if (meetingNodeID.offset != INVALID_OFFSET) {
+                return meetingNodeID;
+            }
+        }
+    }
+    side.frontier = std::move(nextFrontier);
+    return meetingNodeID;
+}
+
+std::vector<BidirectionalBFSStep> BidirectionalBFS::getPath(const Side& fwdSide,
+    const Side& bwdSide, nodeID_t meetingNodeID) const {
+    std::vector<BidirectionalBFSStep> path;
+    // Walk from the meeting node back to the source.
+    auto nodeID = meetingNodeID;
+    auto parent = fwdSide.parents.at(nodeID);
+    while (parent.nodeID.offset != INVALID_OFFSET) {
+        path.push_back({nodeID, parent.edgeID, parent.isFwd});
+        nodeID = parent.nodeID;
+        parent = fwdSide.parents.at(nodeID);
+    }
+    std::reverse(path.begin(), path.end());
+    // Walk from the meeting node to the destination.
+    nodeID = meetingNodeID;
+    parent = bwdSide.parents.at(nodeID);
+    while (parent.nodeID.offset != INVALID_OFFSET) {
+        path.push_back({parent.nodeID, parent.edgeID, parent.isFwd});
+        nodeID = parent.nodeID;
+        parent = bwdSide.parents.at(nodeID);
+    }
+    return path;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,56 @@
+#include "function/gds/delta_stepping.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+void DeltaSteppingBuckets::addWeight(double weight) {
+    std::unique_lock lck{mtx};
+    weightSum += weight;
+    numWeights++;
+}
+
+void DeltaSteppingBuckets::tune() {
+    KU_ASSERT(!tuned);
+    tuned = true;
+    if (numWeights == 0 || weightSum == 0) {
+        // Without positive weights, a single bucket degenerates to Bellman-Ford.
+        delta = std::numeric_limits<double>::infinity();
+        return;
+    }
+    delta = weightSum / numWeights;
+}
+
+void DeltaSteppingBuckets::useSingleBucket() {
+    tuned = true;
+    delta = std::numeric_limits<double>::infinity();
+}
+
+void DeltaSteppingBuckets::defer(nodeID_t nodeID, double cost) {
+    auto bucketIdx = getBucketIdx(cost);
+    std::unique_lock lck{mtx};
+    buckets[bucketIdx].push_back(nodeID);
+}
+
+std::vector<nodeID_t> DeltaSteppingBuckets::popNextBucket() {
+    if (buckets.empty()) {
+        return {};
+    }
+    auto it = buckets.begin();
+    curBucketIdx = it->first;
+    auto result = std::move(it->second);
+    buckets.erase(it);
+    return result;
+}
+
+uint64_t DeltaSteppingBuckets::getBucketIdx(double cost) const {
+    static constexpr auto maxBucketIdx = static_cast<double>(UINT32_MAX);
+    return static_cast<uint64_t>(std::min(cost / delta, maxBucketIdx));
+}
+
+} // namespace function
+} // namespace kuzu
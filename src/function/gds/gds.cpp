@@ -8,6 +8,7 @@
 #include "common/exception/binder.h"
 #include "function/table/bind_input.h"
 #include "graph/graph_entry_set.h"
+#include "graph/materialized_graph.h"
 #include "graph/on_disk_graph.h"
 #include "parser/parser.h"
 #include "planner/operator/logical_table_function_call.h"
@@ -28,8 +29,12 @@ namespace kuzu {
 namespace function {
 
 void GDSFuncSharedState::setGraphNodeMask(std::unique_ptr<NodeOffsetMaskMap> maskMap) {
-    auto onDiskGraph = ku_dynamic_cast<OnDiskGraph*>(graph.get());
-    onDiskGraph->setNodeOffsetMask(maskMap.get());
+    if (auto materializedGraph = dynamic_cast<MaterializedGraph*>(graph.get())) {
+        materializedGraph->setNodeOffsetMask(maskMap.get());
+    } else {
+        auto onDiskGraph = ku_dynamic_cast<OnDiskGraph*>(graph.get());
+        onDiskGraph->setNodeOffsetMask(maskMap.get());
+    }
     graphNodeMask = std::move(maskMap);
 }
 
@@ -70,7 +75,10 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context, const std::
     if (entry->type != GraphEntryType::NATIVE) {
         throw BinderException("AA");
     }
-    return bindGraphEntry(context, entry->cast<ParsedNativeGraphEntry>());
+    auto& nativeEntry = entry->cast<ParsedNativeGraphEntry>();
+    auto result = bindGraphEntry(context, nativeEntry);
+    result.materializedGraph = nativeEntry.materializedGraph;
+    return result;
 }
 
 static NativeGraphEntryTableInfo bindNodeEntry(ClientContext& context, const std::string& tableName,
@@ -186,8 +194,19 @@ std::string GDSFunction::bindColumnName(const parser::YieldVariable& yieldVariab
 std::unique_ptr<TableFuncSharedState> GDSFunction::initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<GDSBindData>();
-    auto graph =
-        std::make_unique<OnDiskGraph>(input.context->clientContext, bindData->graphEntry.copy());
+    auto context = input.context->clientContext;
+    auto& graphEntry = bindData->graphEntry;
+    std::unique_ptr<Graph> graph;
+    if (graphEntry.materializedGraph != nullptr) {
+        auto data = graphEntry.materializedGraph->getOrBuild(context, graphEntry);
+        if (data != nullptr) {
+            graph =
+                std::make_unique<MaterializedGraph>(context, graphEntry.copy(), std::move(data));
+        }
+    }
+    if (graph == nullptr) {
+        graph = std::make_unique<OnDiskGraph>(context, graphEntry.copy());
+    }
     return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(), std::move(graph));
 }
 
@@ -215,6 +215,7 @@ void FrontierPair::beginNewIteration() {
     std::unique_lock<std::mutex> lck{mtx};
     curIter++;
     hasActiveNodesForNextIter_.store(false);
+    numActiveNodesOnCurrentFrontier = numActiveNodesForNextIter.exchange(0);
     beginNewIterationInternalNoLock();
 }
 
@@ -39,6 +39,10 @@ oid_t FrontierTaskInfo::getRelTableID() const {
 }
 
 void FrontierTask::run() {
+    if (info.pull) {
+        runPull();
+        return;
+    }
     FrontierMorsel morsel;
     auto numActiveNodes = 0u;
     auto graph = info.graph;
@@ -81,6 +85,7 @@ void FrontierTask::run() {
         KU_UNREACHABLE;
     }
     if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
 }
@@ -117,6 +122,40 @@ void FrontierTask::runSparse() {
         KU_UNREACHABLE;
     }
     if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
+        sharedState->frontierPair.setActiveNodesForNextIter();
+    }
+}
+
+void FrontierTask::runPull() {
+    FrontierMorsel morsel;
+    auto numActiveNodes = 0u;
+    auto graph = info.graph;
+    // Scan from the nbr table nodes back to the bound table nodes.
+    auto scanState = graph->prepareRelScan(*info.relGroupEntry, info.getRelTableID(),
+        info.getBoundTableID(), info.propertiesToScan);
+    auto ec = info.edgeCompute.copy();
+    auto nbrTableID = info.getNbrTableID();
+    auto fwdEdge = info.direction == ExtendDirection::FWD;
+    while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
+        for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); ++offset) {
+            nodeID_t nodeID = {offset, nbrTableID};
+            if (!ec->needsParent(nodeID)) {
+                continue;
+            }
+            auto edges =
+                fwdEdge ? graph->scanBwd(nodeID, *scanState) : graph->scanFwd(nodeID, *scanState);
+            for (auto chunk : edges) {
+                if (ec->pullEdgeCompute(nodeID, chunk, fwdEdge)) {
+                    sharedState->frontierPair.addNodeToNextFrontier(offset);
+                    numActiveNodes++;
+                    break;
+                }
+            }
+        }
+    }
+    if (numActiveNodes) {
+        sharedState->frontierPair.addNumActiveNodesForNextIter(numActiveNodes);
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
 }
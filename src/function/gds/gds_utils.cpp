@@ -1,6 +1,7 @@
 #include "function/gds/gds_utils.h"
 
 #include "binder/expression/property_expression.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/interrupt.h"
 #include "common/task_system/task_scheduler.h"
@@ -19,27 +20,36 @@ using namespace kuzu::graph;
 namespace kuzu {
 namespace function {
 
+// A pull-based iteration scans the edges of the nbr table nodes in the opposite direction, which
+// requires the rels to be stored in both directions.
+static bool canPull(const GraphRelInfo& relInfo) {
+    return relInfo.relGroupEntry->constCast<RelGroupCatalogEntry>().getRelDataDirections().size() ==
+           2;
+}
+
 static std::shared_ptr<FrontierTask> getFrontierTask(const main::ClientContext* context,
     const GraphRelInfo& relInfo, Graph* graph, ExtendDirection extendDirection,
-    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan) {
+    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan, bool pull) {
     auto info = FrontierTaskInfo(relInfo.srcTableID, relInfo.dstTableID, relInfo.relGroupEntry,
         graph, extendDirection, *computeState.edgeCompute, std::move(propertiesToScan));
+    info.pull = pull && canPull(relInfo);
     computeState.beginFrontierCompute(info.getBoundTableID(), info.getNbrTableID());
     auto numThreads = context->getMaxNumThreadForExec();
     auto sharedState =
         std::make_shared<FrontierTaskSharedState>(numThreads, *computeState.frontierPair);
-    auto maxOffset =
-        graph->getMaxOffset(transaction::Transaction::Get(*context), info.getBoundTableID());
+    // A pull-based iteration runs over the nbr table nodes.
+    auto tableID = info.pull ? info.getNbrTableID() : info.getBoundTableID();
+    auto maxOffset = graph->getMaxOffset(transaction::Transaction::Get(*context), tableID);
     sharedState->morselDispatcher.init(maxOffset);
     return std::make_shared<FrontierTask>(numThreads, info, sharedState);
 }
 
 static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo& relInfo,
     Graph* graph, ExtendDirection extendDirection, const GDSComputeState& computeState,
-    std::vector<std::string> propertiesToScan) {
+    std::vector<std::string> propertiesToScan, bool pull) {
     auto clientContext = context->clientContext;
     auto task = getFrontierTask(clientContext, relInfo, graph, extendDirection, computeState,
-        std::move(propertiesToScan));
+        std::move(propertiesToScan), pull);
     if (computeState.frontierPair->getState() == GDSDensityState::SPARSE) {
         task->runSparse();
         return;
@@ -59,7 +69,7 @@ static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo&
 
 static void runOneIteration(ExecutionContext* context, Graph* graph,
     ExtendDirection extendDirection, const GDSComputeState& compState,
-    const std::vector<std::string>& propertiesToScan) {
+    const std::vector<std::string>& propertiesToScan, bool pull = false) {
     for (auto info : graph->getGraphEntry()->nodeInfos) {
         for (const auto& relInfo : graph->getRelInfos(info.entry->getTableID())) {
             if (context->clientContext->interrupted()) {
@@ -68,17 +78,17 @@ static void runOneIteration(ExecutionContext* context, Graph* graph,
             switch (extendDirection) {
             case ExtendDirection::FWD: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
             } break;
             case ExtendDirection::BWD: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
             } break;
             case ExtendDirection::BOTH: {
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
                 scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                    propertiesToScan, pull);
             } break;
             default:
                 KU_UNREACHABLE;
@@ -87,6 +97,18 @@ static void runOneIteration(ExecutionContext* context, Graph* graph,
     }
 }
 
+// Extending the current frontier checks every edge of its nodes, while pulling checks the edges of
+// the unvisited nodes until a parent is found. Following Beamer et al. ("Direction-Optimizing
+// Breadth-First Search"), pulling pays off once the frontier holds a sizable fraction of the nodes.
+static constexpr uint64_t PULL_FRONTIER_FRACTION = 20;
+
+static bool shouldPull(const GDSComputeState& compState, offset_t numNodes) {
+    auto frontierPair = compState.frontierPair.get();
+    return compState.edgeCompute->supportsPull() &&
+           frontierPair->getState() == GDSDensityState::DENSE &&
+           frontierPair->getNumActiveNodesOnCurrentFrontier() * PULL_FRONTIER_FRACTION > numNodes;
+}
+
 void GDSUtils::runAlgorithmEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration) {
     auto frontierPair = compState.frontierPair.get();
@@ -107,13 +129,54 @@ void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSCompute
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration,
     NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
     auto frontierPair = compState.frontierPair.get();
+    auto numNodes = graph->getNumNodes(transaction::Transaction::Get(*context->clientContext));
     compState.edgeCompute->resetSingleThreadState();
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
         if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
             break;
         }
+        runOneIteration(context, graph, extendDirection, compState, propertiesToScan,
+            shouldPull(compState, numNodes));
+        if (frontierPair->needSwitchToDense(
+                context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
+            compState.switchToDense(context, graph);
+        }
+    }
+}
+
+bool GDSUtils::runDeltaSteppingEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
+    Graph* graph, ExtendDirection extendDirection, DeltaSteppingBuckets& buckets,
+    NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
+    // Frontiers store the iteration in which a node is activated, which bounds the number of
+    // iterations.
+    static constexpr uint16_t maxIteration = FRONTIER_UNVISITED - 1;
+    auto frontierPair = compState.frontierPair.get();
+    compState.edgeCompute->resetSingleThreadState();
+    while (true) {
+        if (!frontierPair->hasActiveNodesForNextIter()) {
+            // The current bucket is settled. Continue with the next non-empty bucket.
+            auto nodeIDs = buckets.popNextBucket();
+            if (nodeIDs.empty()) {
+                return true;
+            }
+            if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
+                return true;
+            }
+            for (auto& nodeID : nodeIDs) {
+                frontierPair->pinNextFrontier(nodeID.tableID);
+                frontierPair->addNodeToNextFrontier(nodeID);
+            }
+            frontierPair->setActiveNodesForNextIter();
+        }
+        if (frontierPair->getCurrentIter() >= maxIteration) {
+            return false;
+        }
+        frontierPair->beginNewIteration();
         runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+        if (!buckets.isTuned()) {
+            buckets.tune();
+        }
         if (frontierPair->needSwitchToDense(
                 context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
             compState.switchToDense(context, graph);
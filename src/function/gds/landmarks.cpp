@@ -0,0 +1,267 @@
+#include "function/gds/landmarks.h"
+
+#include <algorithm>
+#include <queue>
+
+#include "catalog/catalog.h"
+#include "common/enums/extend_direction_util.h"
+#include "common/exception/interrupt.h"
+#include "common/string_format.h"
+#include "function/gds/gds_function_collection.h"
+#include "function/gds/weight_utils.h"
+#include "graph/on_disk_graph.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "transaction/table_version_tracker.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::graph;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+WeightedNbrScanner::WeightedNbrScanner(Graph* graph, ExtendDirection extendDirection,
+    const std::string& weightPropertyName, const LogicalType& weightType)
+    : extendDirection{extendDirection}, weightTypeID{weightType.getLogicalTypeID()},
+      scanner{graph, ExtendDirection::BOTH, {InternalKeyword::ID, weightPropertyName}} {}
+
+template<typename Func>
+void WeightedNbrScanner::scan(nodeID_t nodeID, bool reverse, Func func) {
+    auto direction = extendDirection;
+    // Reversing a traversal in both directions does not change it.
+    if (reverse && direction != ExtendDirection::BOTH) {
+        direction = direction == ExtendDirection::FWD ? ExtendDirection::BWD : ExtendDirection::FWD;
+    }
+    scanner.scanChunks(nodeID, direction, [&](const NbrScanState::Chunk& chunk, bool isFwd) {
+        WeightUtils::visit(WeightedSPPathsFunction::name, weightTypeID, [&]<typename T>(T) {
+            chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+                auto edgeID = propertyVectors[0]->template getValue<relID_t>(i);
+                auto weight = propertyVectors[1]->template getValue<T>(i);
+                WeightUtils::checkWeight(WeightedSPPathsFunction::name, weight);
+                func(neighbors[i], edgeID, isFwd, static_cast<double>(weight));
+            });
+        });
+    });
+}
+
+double LandmarkDistances::getLowerBound(nodeID_t nodeID, nodeID_t dstNodeID) const {
+    auto& nodeFrom = fromLandmark.at(nodeID.tableID);
+    auto& nodeTo = toLandmark.at(nodeID.tableID);
+    auto& dstFrom = fromLandmark.at(dstNodeID.tableID);
+    auto& dstTo = toLandmark.at(dstNodeID.tableID);
+    auto nodeIdx = nodeID.offset * numLandmarks;
+    auto dstIdx = dstNodeID.offset * numLandmarks;
+    double result = 0;
+    for (auto i = 0u; i < numLandmarks; ++i) {
+        // A difference of two unreachable costs is NaN, which std::max ignores. Otherwise, an
+        // unreachable cost yields an infinite bound only if the destination is unreachable from
+        // the node.
+        result = std::max(result, dstFrom.get(dstIdx + i) - nodeFrom.get(nodeIdx + i));
+        result = std::max(result, nodeTo.get(nodeIdx + i) - dstTo.get(dstIdx + i));
+    }
+    return result;
+}
+
+using cost_node_pair_t = std::pair<double, nodeID_t>;
+using min_cost_queue_t = std::priority_queue<cost_node_pair_t, std::vector<cost_node_pair_t>,
+    std::greater<cost_node_pair_t>>;
+
+// Dijkstra's algorithm from the landmark. Stores the cost of every reached node at column
+// landmarkIdx of costs.
+static void computeLandmarkCosts(ClientContext* context, WeightedNbrScanner& scanner,
+    nodeID_t landmarkNodeID, bool reverse, uint64_t numLandmarks, idx_t landmarkIdx,
+    table_id_map_t<ObjectArray<double>>& costs) {
+    auto getCost = [&](nodeID_t nodeID) -> double& {
+        return costs.at(nodeID.tableID).getUnsafe(nodeID.offset * numLandmarks + landmarkIdx);
+    };
+    min_cost_queue_t queue;
+    getCost(landmarkNodeID) = 0;
+    queue.push({0, landmarkNodeID});
+    while (!queue.empty()) {
+        auto [cost, nodeID] = queue.top();
+        queue.pop();
+        if (cost > getCost(nodeID)) { // Stale entry.
+            continue;
+        }
+        if (context->interrupted()) {
+            throw InterruptException{};
+        }
+        scanner.scan(nodeID, reverse, [&](nodeID_t nbrNodeID, relID_t, bool, double weight) {
+            auto newCost = cost + weight;
+            auto& nbrCost = getCost(nbrNodeID);
+            if (newCost < nbrCost) {
+                nbrCost = newCost;
+                queue.push({newCost, nbrNodeID});
+            }
+        });
+    }
+}
+
+// Picks landmarks with the farthest heuristic: the first landmark is a node of highest degree, and
+// every following landmark is the node farthest from the landmarks picked so far.
+static std::shared_ptr<LandmarkDistances> buildLandmarkDistances(ClientContext* context,
+    const NativeGraphEntry& entry, ExtendDirection extendDirection,
+    const std::string& weightPropertyName, const LogicalType& weightType, uint64_t numLandmarks) {
+    // Build over all the rels of the graph regardless of the predicates of the query.
+    OnDiskGraph graph(context, NativeGraphEntry(entry.getNodeEntries(), entry.getRelEntries()));
+    WeightedNbrScanner scanner(&graph, extendDirection, weightPropertyName, weightType);
+    auto result = std::make_shared<LandmarkDistances>();
+    result->numLandmarks = numLandmarks;
+    auto maxOffsetMap = graph.getMaxOffsetMap(transaction::Transaction::Get(*context));
+    auto mm = storage::MemoryManager::Get(*context);
+    auto allocate = [&](ObjectArray<double>& costs, offset_t size) {
+        costs.allocate(size, mm, false /* initializeToZero */);
+        for (offset_t i = 0; i < size; ++i) {
+            costs.set(i, LandmarkDistances::UNREACHABLE);
+        }
+    };
+    // Cost from the closest landmark picked so far to each node, in either direction.
+    table_id_map_t<ObjectArray<double>> closestCosts;
+    nodeID_t landmarkNodeID;
+    uint64_t maxDegree = 0;
+    for (auto& [tableID, maxOffset] : maxOffsetMap) {
+        allocate(result->fromLandmark[tableID], maxOffset * numLandmarks);
+        allocate(result->toLandmark[tableID], maxOffset * numLandmarks);
+        allocate(closestCosts[tableID], maxOffset);
+        for (offset_t offset = 0; offset < maxOffset; ++offset) {
+            auto nodeID = nodeID_t{offset, tableID};
+            uint64_t degree = 0;
+            auto countEdge = [&](nodeID_t, relID_t, bool, double) { degree++; };
+            scanner.scan(nodeID, false /* reverse */, countEdge);
+            scanner.scan(nodeID, true /* reverse */, countEdge);
+            if (degree > maxDegree) {
+                maxDegree = degree;
+                landmarkNodeID = nodeID;
+            }
+        }
+    }
+    for (auto i = 0u; i < numLandmarks && landmarkNodeID.offset != INVALID_OFFSET; ++i) {
+        computeLandmarkCosts(context, scanner, landmarkNodeID, false /* reverse */, numLandmarks,
+            i, result->fromLandmark);
+        computeLandmarkCosts(context, scanner, landmarkNodeID, true /* reverse */, numLandmarks, i,
+            result->toLandmark);
+        landmarkNodeID = nodeID_t{};
+        double maxCost = 0;
+        for (auto& [tableID, costs] : closestCosts) {
+            auto& fromCosts = result->fromLandmark.at(tableID);
+            auto& toCosts = result->toLandmark.at(tableID);
+            for (offset_t offset = 0; offset < costs.getSize(); ++offset) {
+                auto idx = offset * numLandmarks + i;
+                auto& cost = costs.getUnsafe(offset);
+                cost = std::min({cost, fromCosts.get(idx), toCosts.get(idx)});
+                // Nodes not connected to any landmark picked so far are not picked, since they
+                // are mostly isolated nodes.
+                if (cost > maxCost && cost != LandmarkDistances::UNREACHABLE) {
+                    maxCost = cost;
+                    landmarkNodeID = nodeID_t{offset, tableID};
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<const LandmarkDistances> LandmarkCache::getOrBuild(ClientContext* context,
+    const NativeGraphEntry& entry, ExtendDirection extendDirection,
+    const std::string& weightPropertyName, const LogicalType& weightType, uint64_t numLandmarks) {
+    auto tableVersions =
+        context->getDatabase()->getTableVersionTracker()->getTableVersions(entry.getTableIDs());
+    if (!transaction::TableVersionTracker::isVisible(*transaction::Transaction::Get(*context),
+            tableVersions)) {
+        return nullptr;
+    }
+    std::string key;
+    for (auto& tableVersion : tableVersions) {
+        key += stringFormat("{},", tableVersion.first);
+    }
+    key += stringFormat("{}|{}|{}", ExtendDirectionUtil::toString(extendDirection),
+        weightPropertyName, numLandmarks);
+    auto schemaVersion = catalog::Catalog::Get(*context)->getSchemaVersion();
+    {
+        std::unique_lock lck{mtx};
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            auto& [entryKey, cached] = *it;
+            if (entryKey == key && cached->schemaVersion == schemaVersion &&
+                cached->tableVersions == tableVersions) {
+                auto result = cached;
+                entries.splice(entries.begin(), entries, it);
+                return result;
+            }
+        }
+    }
+    // Build without holding the lock, so that queries over other graphs are not blocked by the
+    // Dijkstra searches. Concurrent queries may build the same distances, and the last one wins.
+    auto result = buildLandmarkDistances(context, entry, extendDirection, weightPropertyName,
+        weightType, numLandmarks);
+    result->schemaVersion = schemaVersion;
+    result->tableVersions = std::move(tableVersions);
+    std::unique_lock lck{mtx};
+    std::erase_if(entries, [&](const auto& cachedEntry) { return cachedEntry.first == key; });
+    entries.emplace_front(std::move(key), result);
+    if (entries.size() > MAX_NUM_ENTRIES) {
+        entries.pop_back();
+    }
+    return result;
+}
+
+LandmarkAStar::LandmarkAStar(Graph* graph, ExtendDirection extendDirection,
+    const std::string& weightPropertyName, const LogicalType& weightType,
+    std::shared_ptr<const LandmarkDistances> landmarks)
+    : scanner{graph, extendDirection, weightPropertyName, weightType},
+      landmarks{std::move(landmarks)} {}
+
+std::vector<AStarStep> LandmarkAStar::search(ClientContext* context, nodeID_t sourceNodeID,
+    nodeID_t dstNodeID) {
+    node_id_map_t<Label> labels;
+    // Ordered by the cost from the source plus the lower bound to the destination.
+    min_cost_queue_t queue;
+    labels.insert({sourceNodeID, Label{0, nodeID_t{}, relID_t{}, false, 0}});
+    queue.push({landmarks->getLowerBound(sourceNodeID, dstNodeID), sourceNodeID});
+    while (!queue.empty()) {
+        auto [estimate, nodeID] = queue.top();
+        queue.pop();
+        auto cost = labels.at(nodeID).cost;
+        if (estimate > cost + landmarks->getLowerBound(nodeID, dstNodeID)) { // Stale entry.
+            continue;
+        }
+        if (nodeID == dstNodeID) {
+            break;
+        }
+        if (context->interrupted()) {
+            throw InterruptException{};
+        }
+        scanner.scan(nodeID, false /* reverse */,
+            [&](nodeID_t nbrNodeID, relID_t edgeID, bool isFwd, double weight) {
+                auto newCost = cost + weight;
+                auto it = labels.find(nbrNodeID);
+                if (it != labels.end() && it->second.cost <= newCost) {
+                    return;
+                }
+                auto lowerBound = landmarks->getLowerBound(nbrNodeID, dstNodeID);
+                if (lowerBound == LandmarkDistances::UNREACHABLE) {
+                    return;
+                }
+                labels[nbrNodeID] = Label{newCost, nodeID, edgeID, isFwd, weight};
+                queue.push({newCost + lowerBound, nbrNodeID});
+            });
+    }
+    std::vector<AStarStep> path;
+    if (!labels.contains(dstNodeID)) {
+        return path;
+    }
+    // The lower bounds are consistent, so the cost of the destination is final once it is
+    // expanded, or once the queue is empty.
+    auto nodeID = dstNodeID;
+    while (nodeID != sourceNodeID) {
+        auto& label = labels.at(nodeID);
+        path.push_back({nodeID, label.edgeID, label.isFwd, label.weight});
+        nodeID = label.parentNodeID;
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+} // namespace function
+} // namespace kuzu
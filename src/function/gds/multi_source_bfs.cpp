@@ -0,0 +1,104 @@
+#include "function/gds/multi_source_bfs.h"
+
+#include <bit>
+
+#include "common/exception/interrupt.h"
+#include "main/client_context.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::graph;
+
+namespace kuzu {
+namespace function {
+
+MultiSourceBFS::MultiSourceBFS(main::ClientContext* context, Graph* graph,
+    ExtendDirection extendDirection, uint16_t upperBound)
+    : context{context}, extendDirection{extendDirection}, upperBound{upperBound},
+      scanner{graph, extendDirection, {}} {
+    auto mm = storage::MemoryManager::Get(*context);
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction::Transaction::Get(*context));
+    for (auto& [tableID, maxOffset] : maxOffsetMap) {
+        auto& tableBitsets = bitsets[tableID];
+        tableBitsets.seen.allocate(maxOffset, mm, true /* initializeToZero */);
+        tableBitsets.visit.allocate(maxOffset, mm, true /* initializeToZero */);
+        tableBitsets.visitNext.allocate(maxOffset, mm, true /* initializeToZero */);
+    }
+}
+
+void MultiSourceBFS::reset() {
+    for (auto& nodeID : reachedNodes) {
+        auto& tableBitsets = bitsets.at(nodeID.tableID);
+        tableBitsets.seen.set(nodeID.offset, 0);
+        tableBitsets.visit.set(nodeID.offset, 0);
+    }
+    reachedNodes.clear();
+}
+
+void MultiSourceBFS::run(const std::vector<nodeID_t>& sourceNodeIDs, const reach_func_t& func) {
+    KU_ASSERT(sourceNodeIDs.size() <= MAX_NUM_SOURCES);
+    reset();
+    std::vector<nodeID_t> frontier;
+    for (auto i = 0u; i < sourceNodeIDs.size(); ++i) {
+        auto nodeID = sourceNodeIDs[i];
+        auto& tableBitsets = bitsets.at(nodeID.tableID);
+        if (tableBitsets.seen.get(nodeID.offset) == 0) {
+            frontier.push_back(nodeID);
+            reachedNodes.push_back(nodeID);
+        }
+        tableBitsets.seen.getUnsafe(nodeID.offset) |= uint64_t{1} << i;
+        tableBitsets.visit.getUnsafe(nodeID.offset) |= uint64_t{1} << i;
+    }
+    std::vector<nodeID_t> nextFrontier;
+    for (uint16_t length = 1; length <= upperBound && !frontier.empty(); ++length) {
+        for (auto& nodeID : frontier) {
+            if (context->interrupted()) {
+                throw InterruptException{};
+            }
+            extend(nodeID, bitsets.at(nodeID.tableID).visit.get(nodeID.offset), nextFrontier);
+        }
+        for (auto& nodeID : frontier) {
+            bitsets.at(nodeID.tableID).visit.set(nodeID.offset, 0);
+        }
+        for (auto& nodeID : nextFrontier) {
+            auto& tableBitsets = bitsets.at(nodeID.tableID);
+            auto bits = tableBitsets.visitNext.get(nodeID.offset);
+            tableBitsets.visit.set(nodeID.offset, bits);
+            tableBitsets.visitNext.set(nodeID.offset, 0);
+            while (bits != 0) {
+                if (!func(std::countr_zero(bits), nodeID, length)) {
+                    return;
+                }
+                bits &= bits - 1;
+            }
+        }
+        std::swap(frontier, nextFrontier);
+        nextFrontier.clear();
+    }
+}
+
+void MultiSourceBFS::extend(nodeID_t boundNodeID, uint64_t bits, std::vector<nodeID_t>& next) {
+    auto visitNbr = [&](nodeID_t nbrNodeID) {
+        auto& tableBitsets = bitsets.at(nbrNodeID.tableID);
+        auto& seen = tableBitsets.seen.getUnsafe(nbrNodeID.offset);
+        auto newBits = bits & ~seen;
+        if (newBits == 0) {
+            return;
+        }
+        if (seen == 0) {
+            reachedNodes.push_back(nbrNodeID);
+        }
+        // Sources reaching the neighbor in this iteration are marked as seen right away. Other
+        // frontier nodes can only reach it with the same length.
+        seen |= newBits;
+        auto& visitNext = tableBitsets.visitNext.getUnsafe(nbrNodeID.offset);
+        if (visitNext == 0) {
+            next.push_back(nbrNodeID);
+        }
+        visitNext |= newBits;
+    };
+    scanner.scan(boundNodeID, extendDirection, visitNbr);
+}
+
+} // namespace function
+} // namespace kuzu
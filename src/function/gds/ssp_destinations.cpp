@@ -48,6 +48,22 @@ public:
         }
     }
 
+    // Writes a destination reached by a multi-source BFS, which does not use the frontier.
+    void write(FactorizedTable& fTable, nodeID_t sourceNodeID, nodeID_t dstNodeID,
+        uint16_t length, LimitCounter* counter) {
+        pinOutputNodeMask(dstNodeID.tableID);
+        if (!inOutputNodeMask(dstNodeID.offset)) {
+            return;
+        }
+        srcNodeIDVector->setValue<nodeID_t>(0, sourceNodeID);
+        dstNodeIDVector->setValue<nodeID_t>(0, dstNodeID);
+        lengthVector->setValue<uint16_t>(0, length);
+        fTable.append(vectors);
+        if (counter != nullptr) {
+            counter->increase(1);
+        }
+    }
+
     std::unique_ptr<RJOutputWriter> copy() override {
         return std::make_unique<SSPDestinationsOutputWriter>(context, outputNodeMask, sourceNodeID_,
             frontier);
@@ -75,6 +91,17 @@ public:
         return activeNodes;
     }
 
+    bool supportsPull() const override { return true; }
+
+    bool pullEdgeCompute(nodeID_t, NbrScanState::Chunk& resultChunk, bool) override {
+        auto found = false;
+        resultChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) {
+            found = frontierPair->isActiveOnCurrentFrontier(neighbors[i].offset);
+            return !found;
+        });
+        return found;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<SSPDestinationsEdgeCompute>(frontierPair);
     }
@@ -94,6 +121,32 @@ public:
         return columns;
     }
 
+    // Only the iteration of the destination in the frontier is read by the output writer.
+    bool supportsBidirectionalSearch() const override { return true; }
+
+    bool supportsMultiSourceSearch() const override { return true; }
+
+    void runMultiSourceSearch(ExecutionContext* context, const RJBindData& bindData,
+        MultiSourceBFS& multiSourceBFS, const std::vector<nodeID_t>& sourceNodeIDs,
+        RecursiveExtendSharedState* sharedState) override {
+        auto mm = storage::MemoryManager::Get(*context->clientContext);
+        auto localFT = sharedState->factorizedTablePool.claimLocalTable(mm);
+        SSPDestinationsOutputWriter writer{context->clientContext,
+            sharedState->getOutputNodeMaskMap(), sourceNodeIDs[0], nullptr /* frontier */};
+        auto outputTableIDSet = bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet();
+        multiSourceBFS.run(sourceNodeIDs, [&](idx_t sourceIdx, nodeID_t nodeID, uint16_t length) {
+            if (sharedState->exceedLimit()) {
+                return false;
+            }
+            if (outputTableIDSet.contains(nodeID.tableID)) {
+                writer.write(*localFT, sourceNodeIDs[sourceIdx], nodeID, length,
+                    sharedState->counter.get());
+            }
+            return true;
+        });
+        sharedState->factorizedTablePool.returnLocalTable(localFT);
+    }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<SingleSPDestinationsAlgorithm>(*this);
     }
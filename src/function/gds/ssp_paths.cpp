@@ -27,18 +27,39 @@ public:
             auto nbrNodeID = neighbors[i];
             auto iter = frontierPair->getNextFrontierValue(nbrNodeID.offset);
             if (iter == FRONTIER_UNVISITED) {
-                if (!block->hasSpace()) {
-                    block = bfsGraphManager->getCurrentGraph()->addNewBlock();
-                }
                 auto edgeID = propertyVectors[0]->template getValue<nodeID_t>(i);
-                bfsGraphManager->getCurrentGraph()->addSingleParent(frontierPair->getCurrentIter(),
-                    boundNodeID, edgeID, nbrNodeID, isFwd, block);
+                addParent(boundNodeID, edgeID, nbrNodeID, isFwd);
                 activeNodes.push_back(nbrNodeID);
             }
         });
         return activeNodes;
     }
 
+    bool supportsPull() const override { return true; }
+
+    bool pullEdgeCompute(nodeID_t nodeID, graph::NbrScanState::Chunk& resultChunk,
+        bool isFwd) override {
+        auto found = false;
+        resultChunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+            auto parentNodeID = neighbors[i];
+            if (found || !frontierPair->isActiveOnCurrentFrontier(parentNodeID.offset)) {
+                return;
+            }
+            auto edgeID = propertyVectors[0]->template getValue<nodeID_t>(i);
+            addParent(parentNodeID, edgeID, nodeID, isFwd);
+            found = true;
+        });
+        return found;
+    }
+
+    void addParent(nodeID_t boundNodeID, relID_t edgeID, nodeID_t nbrNodeID, bool isFwd) {
+        if (!block->hasSpace()) {
+            block = bfsGraphManager->getCurrentGraph()->addNewBlock();
+        }
+        bfsGraphManager->getCurrentGraph()->addSingleParent(frontierPair->getCurrentIter(),
+            boundNodeID, edgeID, nbrNodeID, isFwd, block);
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<SSPPathsEdgeCompute>(frontierPair, bfsGraphManager);
     }
@@ -67,6 +88,14 @@ public:
         return columns;
     }
 
+    bool supportsBidirectionalSearch() const override { return true; }
+
+    void addBidirectionalSearchEdge(GDSComputeState& computeState, nodeID_t boundNodeID,
+        const BidirectionalBFSStep& step) override {
+        auto edgeCompute = ku_dynamic_cast<SSPPathsEdgeCompute*>(computeState.edgeCompute.get());
+        edgeCompute->addParent(boundNodeID, step.edgeID, step.nodeID, step.isFwd);
+    }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<SingleSPPathsAlgorithm>(*this);
     }
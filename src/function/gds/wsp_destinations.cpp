@@ -1,3 +1,6 @@
+#include <array>
+#include <mutex>
+
 #include "binder/expression/node_expression.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
@@ -13,76 +16,97 @@ using namespace kuzu::processor;
 namespace kuzu {
 namespace function {
 
+// Cost of the cheapest path found to a node and its number of edges.
+struct CostEntry {
+    double cost = std::numeric_limits<double>::max();
+    iteration_t numHops = 0;
+};
+
 class Costs {
 public:
     virtual ~Costs() = default;
 
     virtual void pinTableID(table_id_t tableID) = 0;
 
-    virtual void setCost(offset_t offset, double cost) = 0;
-    virtual bool tryReplaceWithMinCost(offset_t offset, double newCost) = 0;
+    virtual void setCost(offset_t offset, CostEntry entry) = 0;
+    virtual bool tryReplaceWithMinCost(offset_t offset, CostEntry newEntry) = 0;
 
     virtual double getCost(offset_t offset) = 0;
+    // Returns the cost and the number of edges of the same path.
+    virtual CostEntry getCostEntry(offset_t offset) = 0;
 };
 
 class SparseCostsReference : public Costs {
 public:
-    explicit SparseCostsReference(GDSSpareObjectManager<double>& sparseObjects)
+    explicit SparseCostsReference(GDSSpareObjectManager<CostEntry>& sparseObjects)
         : sparseObjects{sparseObjects} {}
 
     void pinTableID(table_id_t tableID) override { curData = sparseObjects.getData(tableID); }
 
-    void setCost(offset_t offset, double cost) override {
+    void setCost(offset_t offset, CostEntry entry) override {
         KU_ASSERT(curData != nullptr);
-        if (curData->contains(offset)) {
-            curData->at(offset) = cost;
-        } else {
-            curData->insert({offset, cost});
-        }
+        curData->insert_or_assign(offset, entry);
     }
 
-    bool tryReplaceWithMinCost(offset_t offset, double newCost) override {
+    bool tryReplaceWithMinCost(offset_t offset, CostEntry newEntry) override {
         auto curCost = getCost(offset);
-        if (newCost < curCost) {
-            setCost(offset, newCost);
+        if (newEntry.cost < curCost) {
+            setCost(offset, newEntry);
             return true;
         }
         return false;
     }
 
-    double getCost(offset_t offset) override {
+    double getCost(offset_t offset) override { return getCostEntry(offset).cost; }
+
+    CostEntry getCostEntry(offset_t offset) override {
         KU_ASSERT(curData != nullptr);
         if (curData->contains(offset)) {
             return curData->at(offset);
         }
-        return std::numeric_limits<double>::max();
+        return CostEntry{};
     }
 
 private:
-    std::unordered_map<offset_t, double>* curData = nullptr;
-    GDSSpareObjectManager<double>& sparseObjects;
+    std::unordered_map<offset_t, CostEntry>* curData = nullptr;
+    GDSSpareObjectManager<CostEntry>& sparseObjects;
 };
 
+// Nodes share NUM_COST_LOCKS locks by offset.
+static constexpr uint64_t NUM_COST_LOCKS = 64;
+using CostLocks = std::array<std::mutex, NUM_COST_LOCKS>;
+
+// Costs are read without locking, but a cost and its number of edges are only written and read
+// together under the lock of the node, so that they always describe the same path.
 class DenseCostsReference : public Costs {
 public:
-    explicit DenseCostsReference(GDSDenseObjectManager<std::atomic<double>>& denseObjects)
-        : denseObjects{denseObjects} {}
+    DenseCostsReference(GDSDenseObjectManager<std::atomic<double>>& denseObjects,
+        GDSDenseObjectManager<iteration_t>& denseNumHops, CostLocks& locks)
+        : denseObjects{denseObjects}, denseNumHops{denseNumHops}, locks{locks} {}
 
-    void pinTableID(table_id_t tableID) override { curData = denseObjects.getData(tableID); }
+    void pinTableID(table_id_t tableID) override {
+        curData = denseObjects.getData(tableID);
+        curNumHops = denseNumHops.getData(tableID);
+    }
 
-    void setCost(offset_t offset, double cost) override {
+    void setCost(offset_t offset, CostEntry entry) override {
         KU_ASSERT(curData != nullptr);
-        curData[offset].store(cost, std::memory_order_relaxed);
+        std::unique_lock lck{locks[offset % NUM_COST_LOCKS]};
+        curData[offset].store(entry.cost, std::memory_order_relaxed);
+        curNumHops[offset] = entry.numHops;
     }
 
-    bool tryReplaceWithMinCost(offset_t offset, double newCost) override {
-        auto curCost = getCost(offset);
-        while (newCost < curCost) {
-            if (curData[offset].compare_exchange_strong(curCost, newCost)) {
-                return true;
-            }
+    bool tryReplaceWithMinCost(offset_t offset, CostEntry newEntry) override {
+        if (!(newEntry.cost < getCost(offset))) {
+            return false;
         }
-        return false;
+        std::unique_lock lck{locks[offset % NUM_COST_LOCKS]};
+        if (!(newEntry.cost < getCost(offset))) {
+            return false;
+        }
+        curData[offset].store(newEntry.cost, std::memory_order_relaxed);
+        curNumHops[offset] = newEntry.numHops;
+        return true;
     }
 
     double getCost(offset_t offset) override {
@@ -90,10 +114,18 @@ public:
         return curData[offset].load(std::memory_order_relaxed);
     }
 
+    CostEntry getCostEntry(offset_t offset) override {
+        KU_ASSERT(curData != nullptr);
+        std::unique_lock lck{locks[offset % NUM_COST_LOCKS]};
+        return CostEntry{getCost(offset), curNumHops[offset]};
+    }
+
 private:
-    table_id_map_t<offset_t> nodeMaxOffsetMap;
     std::atomic<double>* curData = nullptr;
+    iteration_t* curNumHops = nullptr;
     GDSDenseObjectManager<std::atomic<double>>& denseObjects;
+    GDSDenseObjectManager<iteration_t>& denseNumHops;
+    CostLocks& locks;
 };
 
 class CostsPair {
@@ -104,8 +136,8 @@ public:
         curSparseCosts = std::make_unique<SparseCostsReference>(sparseObjects);
         nextSparseCosts = std::make_unique<SparseCostsReference>(sparseObjects);
         denseObjects = GDSDenseObjectManager<std::atomic<double>>();
-        curDenseCosts = std::make_unique<DenseCostsReference>(denseObjects);
-        nextDenseCosts = std::make_unique<DenseCostsReference>(denseObjects);
+        curDenseCosts = std::make_unique<DenseCostsReference>(denseObjects, denseNumHops, locks);
+        nextDenseCosts = std::make_unique<DenseCostsReference>(denseObjects, denseNumHops, locks);
     }
 
     Costs* getCurrentCosts() { return curCosts; }
@@ -140,11 +172,51 @@ public:
         }
     }
 
-    // CAS update nbrOffset if new path from boundOffset has a smaller cost.
-    bool update(offset_t boundOffset, offset_t nbrOffset, double val) {
-        KU_ASSERT(curCosts && nextCosts);
-        auto newCost = curCosts->getCost(boundOffset) + val;
-        return nextCosts->tryReplaceWithMinCost(nbrOffset, newCost);
+    double getCost(offset_t boundOffset) {
+        KU_ASSERT(curCosts);
+        return curCosts->getCost(boundOffset);
+    }
+
+    CostEntry getCostEntry(offset_t boundOffset) {
+        KU_ASSERT(curCosts);
+        return curCosts->getCostEntry(boundOffset);
+    }
+
+    // Updates nbrOffset if new path has a smaller cost.
+    bool update(offset_t nbrOffset, CostEntry newEntry) {
+        KU_ASSERT(nextCosts);
+        return nextCosts->tryReplaceWithMinCost(nbrOffset, newEntry);
+    }
+
+    // Returns true if the cheapest path to an output node has more than maxHops edges.
+    bool hasPathLongerThan(uint64_t maxHops, const NodeOffsetMaskMap* outputNodeMask) {
+        switch (densityState) {
+        case GDSDensityState::SPARSE: {
+            for (auto& [tableID, map] : sparseObjects.getData()) {
+                for (auto& [offset, entry] : map) {
+                    if (entry.numHops > maxHops &&
+                        DeltaSteppingBuckets::isOutputNode(outputNodeMask, {offset, tableID})) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+        case GDSDensityState::DENSE: {
+            for (auto& [tableID, maxOffset] : maxOffsetMap) {
+                auto numHops = denseNumHops.getData(tableID);
+                for (auto offset = 0u; offset < maxOffset; ++offset) {
+                    if (numHops[offset] > maxHops &&
+                        DeltaSteppingBuckets::isOutputNode(outputNodeMask, {offset, tableID})) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+        default:
+            KU_UNREACHABLE;
+        }
     }
 
     void switchToDense(ExecutionContext* context) {
@@ -153,15 +225,20 @@ public:
         auto mm = MemoryManager::Get(*context->clientContext);
         for (auto& [tableID, maxOffset] : maxOffsetMap) {
             denseObjects.allocate(tableID, maxOffset, mm);
+            denseNumHops.allocate(tableID, maxOffset, mm);
             auto data = denseObjects.getData(tableID);
+            auto numHops = denseNumHops.getData(tableID);
             for (auto i = 0u; i < maxOffset; i++) {
                 data[i].store(std::numeric_limits<double>::max());
+                numHops[i] = 0;
             }
         }
         for (auto& [tableID, map] : sparseObjects.getData()) {
             auto data = denseObjects.getData(tableID);
-            for (auto& [offset, cost] : map) {
-                data[offset].store(cost);
+            auto numHops = denseNumHops.getData(tableID);
+            for (auto& [offset, entry] : map) {
+                data[offset].store(entry.cost);
+                numHops[offset] = entry.numHops;
             }
         }
     }
@@ -169,10 +246,12 @@ public:
 private:
     table_id_map_t<offset_t> maxOffsetMap;
     GDSDensityState densityState;
-    GDSSpareObjectManager<double> sparseObjects;
+    GDSSpareObjectManager<CostEntry> sparseObjects;
     std::unique_ptr<SparseCostsReference> curSparseCosts;
     std::unique_ptr<SparseCostsReference> nextSparseCosts;
     GDSDenseObjectManager<std::atomic<double>> denseObjects;
+    GDSDenseObjectManager<iteration_t> denseNumHops;
+    CostLocks locks;
     std::unique_ptr<DenseCostsReference> curDenseCosts;
     std::unique_ptr<DenseCostsReference> nextDenseCosts;
 
@@ -183,29 +262,51 @@ private:
 template<typename T>
 class WSPDestinationsEdgeCompute : public EdgeCompute {
 public:
-    explicit WSPDestinationsEdgeCompute(CostsPair* costsPair) : costsPair{costsPair} {}
+    WSPDestinationsEdgeCompute(CostsPair* costsPair, DeltaSteppingBuckets* buckets)
+        : costsPair{costsPair}, buckets{buckets} {}
 
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& chunk,
         bool) override {
         std::vector<nodeID_t> result;
+        auto boundEntry = costsPair->getCostEntry(boundNodeID.offset);
+        // Saturates above any hop upper bound.
+        auto numHops = static_cast<iteration_t>(
+            std::min<uint64_t>(boundEntry.numHops + 1, FRONTIER_UNVISITED));
         chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
             auto nbrNodeID = neighbors[i];
             auto weight = propertyVectors[0]->template getValue<T>(i);
             WeightUtils::checkWeight(WeightedSPDestinationsFunction::name, weight);
-            if (costsPair->update(boundNodeID.offset, nbrNodeID.offset,
-                    static_cast<double>(weight))) {
+            if (!buckets->isTuned()) {
+                buckets->addWeight(static_cast<double>(weight));
+            }
+            auto newCost = boundEntry.cost + static_cast<double>(weight);
+            if (!costsPair->update(nbrNodeID.offset, CostEntry{newCost, numHops})) {
+                return;
+            }
+            if (buckets->isInCurrentBucket(newCost)) {
                 result.push_back(nbrNodeID);
+            } else {
+                buckets->defer(nbrNodeID, newCost);
             }
         });
         return result;
     }
 
+    // Terminates once the costs of all output nodes are settled.
+    bool terminate(NodeOffsetMaskMap& maskMap) override {
+        return buckets->areSettled(maskMap, [&](nodeID_t nodeID) {
+            costsPair->pinCurTableID(nodeID.tableID);
+            return costsPair->getCost(nodeID.offset);
+        });
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<WSPDestinationsEdgeCompute<T>>(costsPair);
+        return std::make_unique<WSPDestinationsEdgeCompute<T>>(costsPair, buckets);
     }
 
 private:
     CostsPair* costsPair;
+    DeltaSteppingBuckets* buckets;
 };
 
 class WSPDestinationsAuxiliaryState : public GDSAuxiliaryState {
@@ -214,10 +315,15 @@ public:
         : costsPair{std::move(costsPair)} {}
 
     Costs* getCosts() { return costsPair->getCurrentCosts(); }
+    DeltaSteppingBuckets* getBuckets() { return &buckets; }
+
+    bool hasPathLongerThan(uint64_t maxHops, const NodeOffsetMaskMap* outputNodeMask) {
+        return costsPair->hasPathLongerThan(maxHops, outputNodeMask);
+    }
 
     void initSource(nodeID_t sourceNodeID) override {
         costsPair->pinCurTableID(sourceNodeID.tableID);
-        costsPair->getCurrentCosts()->setCost(sourceNodeID.offset, 0);
+        costsPair->getCurrentCosts()->setCost(sourceNodeID.offset, CostEntry{0, 0});
     }
 
     void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
@@ -231,6 +337,7 @@ public:
 
 private:
     std::unique_ptr<CostsPair> costsPair;
+    DeltaSteppingBuckets buckets;
 };
 
 class WSPDestinationsOutputWriter : public RJOutputWriter {
@@ -293,6 +400,16 @@ public:
         return columns;
     }
 
+    DeltaSteppingBuckets* getDeltaSteppingBuckets(GDSComputeState& computeState) const override {
+        return computeState.auxiliaryState->ptrCast<WSPDestinationsAuxiliaryState>()->getBuckets();
+    }
+
+    bool hasPathLongerThan(GDSComputeState& computeState, uint64_t maxHops,
+        const NodeOffsetMaskMap* outputNodeMask) const override {
+        return computeState.auxiliaryState->ptrCast<WSPDestinationsAuxiliaryState>()
+            ->hasPathLongerThan(maxHops, outputNodeMask);
+    }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<WeightedSPDestinationsAlgorithm>(*this);
     }
@@ -310,10 +427,12 @@ private:
             graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)));
         auto costPairPtr = costsPair.get();
         auto auxiliaryState = std::make_unique<WSPDestinationsAuxiliaryState>(std::move(costsPair));
+        auto buckets = auxiliaryState->getBuckets();
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPDestinationsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<WSPDestinationsEdgeCompute<T>>(costPairPtr);
+                auto edgeCompute =
+                    std::make_unique<WSPDestinationsEdgeCompute<T>>(costPairPtr, buckets);
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
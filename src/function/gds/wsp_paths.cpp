@@ -1,4 +1,5 @@
 #include "binder/binder.h"
+#include "common/cast.h"
 #include "function/gds/auxiliary_state/path_auxiliary_state.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
@@ -14,40 +15,74 @@ using namespace kuzu::binder;
 namespace kuzu {
 namespace function {
 
-template<typename T>
-class WSPPathsEdgeCompute : public EdgeCompute {
+class WSPPathsEdgeComputeBase : public EdgeCompute {
 public:
-    explicit WSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager)
-        : bfsGraphManager{bfsGraphManager} {
+    WSPPathsEdgeComputeBase(BFSGraphManager* bfsGraphManager, DeltaSteppingBuckets* buckets)
+        : bfsGraphManager{bfsGraphManager}, buckets{buckets} {
         block = bfsGraphManager->getCurrentGraph()->addNewBlock();
     }
 
+    // Returns false if the nbr node is already reached with a lower cost.
+    bool addParent(nodeID_t boundNodeID, relID_t edgeID, nodeID_t nbrNodeID, bool fwdEdge,
+        double weight) {
+        auto bfsGraph = bfsGraphManager->getCurrentGraph();
+        if (!block->hasSpace()) {
+            block = bfsGraph->addNewBlock();
+        }
+        return bfsGraph->tryAddSingleParentWithWeight(boundNodeID, edgeID, nbrNodeID, fwdEdge,
+            weight, block);
+    }
+
+protected:
+    BFSGraphManager* bfsGraphManager;
+    DeltaSteppingBuckets* buckets;
+    ObjectBlock<ParentList>* block = nullptr;
+};
+
+template<typename T>
+class WSPPathsEdgeCompute : public WSPPathsEdgeComputeBase {
+public:
+    WSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager, DeltaSteppingBuckets* buckets)
+        : WSPPathsEdgeComputeBase{bfsGraphManager, buckets} {}
+
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& chunk,
         bool fwdEdge) override {
         std::vector<nodeID_t> result;
+        auto bfsGraph = bfsGraphManager->getCurrentGraph();
+        auto boundCost = bfsGraph->getParentListHead(boundNodeID)->getCost();
         chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
             auto nbrNodeID = neighbors[i];
             auto edgeID = propertyVectors[0]->template getValue<relID_t>(i);
             auto weight = propertyVectors[1]->template getValue<T>(i);
             WeightUtils::checkWeight(WeightedSPPathsFunction::name, weight);
-            if (!block->hasSpace()) {
-                block = bfsGraphManager->getCurrentGraph()->addNewBlock();
+            if (!buckets->isTuned()) {
+                buckets->addWeight(static_cast<double>(weight));
+            }
+            if (!addParent(boundNodeID, edgeID, nbrNodeID, fwdEdge, static_cast<double>(weight))) {
+                return;
             }
-            if (bfsGraphManager->getCurrentGraph()->tryAddSingleParentWithWeight(boundNodeID,
-                    edgeID, nbrNodeID, fwdEdge, static_cast<double>(weight), block)) {
+            auto newCost = boundCost + static_cast<double>(weight);
+            if (buckets->isInCurrentBucket(newCost)) {
                 result.push_back(nbrNodeID);
+            } else {
+                buckets->defer(nbrNodeID, newCost);
             }
         });
         return result;
     }
 
-    std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphManager);
+    // Terminates once the paths to all output nodes are settled.
+    bool terminate(NodeOffsetMaskMap& maskMap) override {
+        auto bfsGraph = bfsGraphManager->getCurrentGraph();
+        return buckets->areSettled(maskMap, [&](nodeID_t nodeID) {
+            auto parent = bfsGraph->getParentListHead(nodeID);
+            return parent == nullptr ? std::numeric_limits<double>::max() : parent->getCost();
+        });
     }
 
-private:
-    BFSGraphManager* bfsGraphManager;
-    ObjectBlock<ParentList>* block = nullptr;
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphManager, buckets);
+    }
 };
 
 class WSPPathsOutputWriter : public PathsOutputWriter {
@@ -108,6 +143,25 @@ public:
         return columns;
     }
 
+    DeltaSteppingBuckets* getDeltaSteppingBuckets(GDSComputeState& computeState) const override {
+        return computeState.auxiliaryState->ptrCast<WSPPathsAuxiliaryState>()->getBuckets();
+    }
+
+    bool hasPathLongerThan(GDSComputeState& computeState, uint64_t maxHops,
+        const NodeOffsetMaskMap* outputNodeMask) const override {
+        return computeState.auxiliaryState->ptrCast<WSPPathsAuxiliaryState>()->hasPathLongerThan(
+            maxHops, outputNodeMask);
+    }
+
+    bool supportsAStarSearch() const override { return true; }
+
+    void addAStarSearchEdge(GDSComputeState& computeState, nodeID_t boundNodeID,
+        const AStarStep& step) override {
+        auto edgeCompute =
+            ku_dynamic_cast<WSPPathsEdgeComputeBase*>(computeState.edgeCompute.get());
+        edgeCompute->addParent(boundNodeID, step.edgeID, step.nodeID, step.isFwd, step.weight);
+    }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<WeightedSPPathsAlgorithm>(*this);
     }
@@ -127,8 +181,10 @@ private:
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPPathsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraph.get());
+                auto bfsGraphPtr = bfsGraph.get();
                 auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph));
+                auto edgeCompute = std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphPtr,
+                    auxiliaryState->getBuckets());
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
@@ -0,0 +1,68 @@
+#include "common/exception/runtime.h"
+#include "common/task_system/task_scheduler.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct CreateWorkloadClassBindData final : TableFuncBindData {
+    WorkloadClass workloadClass;
+
+    explicit CreateWorkloadClassBindData(WorkloadClass workloadClass)
+        : TableFuncBindData{0}, workloadClass{std::move(workloadClass)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateWorkloadClassBindData>(workloadClass);
+    }
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = ku_dynamic_cast<CreateWorkloadClassBindData*>(input.bindData);
+    TaskScheduler::Get(*input.context->clientContext)
+        ->getWorkloadClassManager()
+        ->setWorkloadClass(bindData->workloadClass);
+    return 0;
+}
+
+static uint64_t getLimit(const TableFuncBindInput* input, idx_t idx, const std::string& name) {
+    auto limit = input->getLiteralVal<int64_t>(idx);
+    if (limit < 0) {
+        throw RuntimeException(
+            stringFormat("{} of a workload class must be non-negative. Got {}.", name, limit));
+    }
+    return limit;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
+    const TableFuncBindInput* input) {
+    auto name = input->getLiteralVal<std::string>(0);
+    auto priority = WorkloadPriorityUtils::fromString(input->getLiteralVal<std::string>(1));
+    auto maxNumThreads = getLimit(input, 2, "Max number of threads");
+    auto maxMemoryPerQuery = getLimit(input, 3, "Max memory per query");
+    auto maxConcurrentQueries = getLimit(input, 4, "Max number of concurrent queries");
+    return std::make_unique<CreateWorkloadClassBindData>(WorkloadClass(std::move(name), priority,
+        maxNumThreads, maxMemoryPerQuery, maxConcurrentQueries));
+}
+
+function_set CreateWorkloadClassFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::INT64,
+            LogicalTypeID::INT64, LogicalTypeID::INT64});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,10 +1,12 @@
 #include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "function/gds/gds.h"
 #include "function/table/bind_data.h"
 #include "function/table/bind_input.h"
 #include "function/table/standalone_call_function.h"
 #include "graph/graph_entry_set.h"
+#include "graph/materialized_graph.h"
 #include "parser/parser.h"
 #include "processor/execution_context.h"
 
@@ -20,15 +22,17 @@ struct ProjectGraphNativeBindData final : TableFuncBindData {
     std::string graphName;
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    bool materialize;
 
     ProjectGraphNativeBindData(std::string graphName,
         std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, bool materialize)
         : TableFuncBindData{0}, graphName{std::move(graphName)}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, materialize{materialize} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+            materialize);
     }
 };
 
@@ -39,6 +43,10 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos);
     // bind graph entry to check if input is valid or not. Ignore bind result.
     GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
+    if (bindData->materialize) {
+        // The CSR is built by the first algorithm that runs over the graph.
+        entry->materializedGraph = std::make_shared<MaterializedGraphCache>();
+    }
     graphEntrySet->addGraph(bindData->graphName, std::move(entry));
     return 0;
 }
@@ -73,12 +81,27 @@ static std::vector<ParsedNativeGraphTableInfo> extractGraphEntryTableInfos(const
     return infos;
 }
 
+static bool bindMaterialize(const optional_params_t& optionalParams) {
+    auto materialize = false;
+    for (auto& [name, value] : optionalParams) {
+        if (StringUtils::getLower(name) == "materialize") {
+            value.validateType(LogicalTypeID::BOOL);
+            materialize = value.getValue<bool>();
+        } else {
+            throw BinderException{"Unrecognized optional parameter: " + name};
+        }
+    }
+    return materialize;
+}
+
 static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
     const TableFuncBindInput* input) {
     auto graphName = input->getLiteralVal<std::string>(0);
     auto nodeInfos = extractGraphEntryTableInfos(input->getValue(1));
     auto relInfos = extractGraphEntryTableInfos(input->getValue(2));
-    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+    auto materialize = bindMaterialize(input->optionalParams);
+    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+        materialize);
 }
 
 function_set ProjectGraphNativeFunction::getFunctionSet() {
@@ -44,6 +44,17 @@ std::vector<TableCatalogEntry*> NativeGraphEntry::getNodeEntries() const {
     return result;
 }
 
+table_id_set_t NativeGraphEntry::getTableIDs() const {
+    table_id_set_t result;
+    for (auto& info : nodeInfos) {
+        result.insert(info.entry->getTableID());
+    }
+    for (auto& info : relInfos) {
+        result.insert(info.entry->getTableID());
+    }
+    return result;
+}
+
 const NativeGraphEntryTableInfo& NativeGraphEntry::getRelInfo(table_id_t tableID) const {
     for (auto& info : relInfos) {
         if (info.entry->getTableID() == tableID) {
@@ -0,0 +1,399 @@
+#include "graph/materialized_graph.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/string_utils.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace graph {
+
+CSRPropertyColumn::CSRPropertyColumn(std::string name, LogicalType type)
+    : name{std::move(name)}, type{std::move(type)},
+      numBytesPerValue{PhysicalTypeUtils::getFixedTypeSize(this->type.getPhysicalType())} {}
+
+idx_t CSRAdjList::getPropertyIdx(const std::string& name) const {
+    for (auto i = 0u; i < properties.size(); ++i) {
+        if (StringUtils::caseInsensitiveEquals(properties[i].name, name)) {
+            return i;
+        }
+    }
+    return INVALID_IDX;
+}
+
+// Only properties whose values are stored inline in a value vector are materialized.
+static bool canMaterialize(const LogicalType& type) {
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::BOOL:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::UINT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::INTERVAL:
+    case PhysicalTypeID::INTERNAL_ID:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static Graph::EdgeIterator scanBoundNode(OnDiskGraph& graph, const GraphRelInfo& info,
+    RelDataDirection direction, NbrScanState& scanState, offset_t offset) {
+    auto boundTableID = direction == RelDataDirection::FWD ? info.srcTableID : info.dstTableID;
+    auto nodeID = nodeID_t{offset, boundTableID};
+    return direction == RelDataDirection::FWD ? graph.scanFwd(nodeID, scanState) :
+                                                graph.scanBwd(nodeID, scanState);
+}
+
+// Counts the neighbors of every bound node, so that each array is allocated once with its final
+// size. The returned csrOffsets are in storage order until the node orders are known.
+static std::unique_ptr<CSRAdjList> countAdjList(ClientContext* context, OnDiskGraph& graph,
+    const GraphRelInfo& info, RelDataDirection direction) {
+    auto adjList = std::make_unique<CSRAdjList>();
+    auto mm = MemoryManager::Get(*context);
+    auto boundTableID = direction == RelDataDirection::FWD ? info.srcTableID : info.dstTableID;
+    auto nbrTableID = RelDirectionUtils::getNbrTableID(direction, info.srcTableID, info.dstTableID);
+    auto numBoundNodes = graph.getMaxOffset(transaction::Transaction::Get(*context), boundTableID);
+    adjList->csrOffsets.allocate(numBoundNodes + 1, mm, false /* initializeToZero */);
+    adjList->csrOffsets.set(0, 0);
+    auto countState = graph.prepareRelScan(*info.relGroupEntry, info.relTableID, nbrTableID, {});
+    for (offset_t offset = 0; offset < numBoundNodes; ++offset) {
+        for (const auto chunk : scanBoundNode(graph, info, direction, *countState, offset)) {
+            adjList->numEdges += chunk.size();
+        }
+        adjList->csrOffsets.set(offset + 1, adjList->numEdges);
+    }
+    return adjList;
+}
+
+// Renumbers the bound nodes of the counted adjacency list and copies the neighbors into it.
+static void fillAdjList(ClientContext* context, OnDiskGraph& graph, const GraphRelInfo& info,
+    RelDataDirection direction, CSRAdjList& adjList) {
+    auto& relGroupEntry = *info.relGroupEntry;
+    std::vector<std::string> propertyNames;
+    for (auto& property : relGroupEntry.getProperties()) {
+        if (canMaterialize(property.getType())) {
+            propertyNames.push_back(property.getName());
+            adjList.properties.emplace_back(property.getName(), property.getType().copy());
+        }
+    }
+    auto mm = MemoryManager::Get(*context);
+    auto nbrTableID = RelDirectionUtils::getNbrTableID(direction, info.srcTableID, info.dstTableID);
+    auto numBoundNodes = adjList.getNumBoundNodes();
+    auto& boundOrder = *adjList.boundOrder;
+    auto& nbrOrder = *adjList.nbrOrder;
+    function::ObjectArray<offset_t> csrOffsets(numBoundNodes + 1, mm);
+    csrOffsets.set(0, 0);
+    for (offset_t newOffset = 0; newOffset < numBoundNodes; ++newOffset) {
+        auto oldOffset = boundOrder.getOldOffset(newOffset);
+        auto numNbrs = adjList.csrOffsets.get(oldOffset + 1) - adjList.csrOffsets.get(oldOffset);
+        csrOffsets.set(newOffset + 1, csrOffsets.get(newOffset) + numNbrs);
+    }
+    adjList.csrOffsets = std::move(csrOffsets);
+    adjList.nbrNodes.allocate(adjList.numEdges + DEFAULT_VECTOR_CAPACITY, mm,
+        true /* initializeToZero */);
+    for (auto& column : adjList.properties) {
+        column.values.allocate(adjList.numEdges * column.numBytesPerValue, mm,
+            false /* initializeToZero */);
+        column.nulls.allocate(adjList.numEdges, mm, false /* initializeToZero */);
+    }
+    auto scanState =
+        graph.prepareRelScan(relGroupEntry, info.relTableID, nbrTableID, propertyNames);
+    for (offset_t offset = 0; offset < numBoundNodes; ++offset) {
+        auto newOffset = boundOrder.getNewOffset(offset);
+        auto pos = adjList.csrOffsets.get(newOffset);
+        for (const auto chunk : scanBoundNode(graph, info, direction, *scanState, offset)) {
+            chunk.forEach([&](auto nbrNodes, auto propertyVectors, auto i) {
+                adjList.nbrNodes.set(pos,
+                    nodeID_t{nbrOrder.getNewOffset(nbrNodes[i].offset), nbrNodes[i].tableID});
+                for (auto j = 0u; j < adjList.properties.size(); ++j) {
+                    auto& column = adjList.properties[j];
+                    auto& vector = *propertyVectors[j];
+                    memcpy(column.values.getData() + pos * column.numBytesPerValue,
+                        vector.getData() + i * column.numBytesPerValue, column.numBytesPerValue);
+                    column.nulls.set(pos, vector.isNull(i));
+                    column.hasNull |= vector.isNull(i);
+                }
+                pos++;
+            });
+        }
+        // The transaction is read-only, so both scans see the same rels.
+        KU_ASSERT(pos == adjList.csrOffsets.get(newOffset + 1));
+    }
+}
+
+// Orders the nodes of a table by their number of rels over all stored directions.
+static void initNodeOrder(MemoryManager* mm, offset_t numNodes,
+    const std::vector<const CSRAdjList*>& boundAdjLists, CSRNodeOrder& order) {
+    function::ObjectArray<offset_t> degrees(numNodes, mm, true /* initializeToZero */);
+    for (auto adjList : boundAdjLists) {
+        for (offset_t offset = 0; offset < adjList->getNumBoundNodes(); ++offset) {
+            degrees.getUnsafe(offset) +=
+                adjList->csrOffsets.get(offset + 1) - adjList->csrOffsets.get(offset);
+        }
+    }
+    order.newToOld.allocate(numNodes, mm, false /* initializeToZero */);
+    order.oldToNew.allocate(numNodes, mm, false /* initializeToZero */);
+    auto newToOld = order.newToOld.getData();
+    for (offset_t offset = 0; offset < numNodes; ++offset) {
+        newToOld[offset] = offset;
+    }
+    std::stable_sort(newToOld, newToOld + numNodes,
+        [&](offset_t a, offset_t b) { return degrees.get(a) > degrees.get(b); });
+    for (offset_t newOffset = 0; newOffset < numNodes; ++newOffset) {
+        order.oldToNew.set(newToOld[newOffset], newOffset);
+    }
+}
+
+static std::shared_ptr<CSRGraphData> buildGraphData(ClientContext* context,
+    const NativeGraphEntry& entry) {
+    struct AdjListToFill {
+        GraphRelInfo info;
+        RelDataDirection direction;
+        CSRAdjList* adjList;
+    };
+    auto data = std::make_shared<CSRGraphData>();
+    OnDiskGraph graph(context, entry.copy());
+    std::vector<AdjListToFill> adjListsToFill;
+    table_id_map_t<std::vector<const CSRAdjList*>> boundAdjLists;
+    for (auto tableID : graph.getNodeTableIDs()) {
+        for (auto& info : graph.getRelInfos(tableID)) {
+            auto& relTable = data->relTables[info.relTableID];
+            auto& relGroupEntry = info.relGroupEntry->constCast<RelGroupCatalogEntry>();
+            for (auto direction : relGroupEntry.getRelDataDirections()) {
+                auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+                auto& adjList = relTable.adjLists[idx];
+                adjList = countAdjList(context, graph, info, direction);
+                auto boundTableID =
+                    direction == RelDataDirection::FWD ? info.srcTableID : info.dstTableID;
+                boundAdjLists[boundTableID].push_back(adjList.get());
+                adjListsToFill.push_back({info, direction, adjList.get()});
+            }
+        }
+    }
+    auto mm = MemoryManager::Get(*context);
+    auto transaction = transaction::Transaction::Get(*context);
+    for (auto tableID : graph.getNodeTableIDs()) {
+        initNodeOrder(mm, graph.getMaxOffset(transaction, tableID), boundAdjLists[tableID],
+            data->nodeOrders[tableID]);
+    }
+    for (auto& [info, direction, adjList] : adjListsToFill) {
+        auto boundTableID = direction == RelDataDirection::FWD ? info.srcTableID : info.dstTableID;
+        auto nbrTableID =
+            RelDirectionUtils::getNbrTableID(direction, info.srcTableID, info.dstTableID);
+        adjList->boundOrder = &data->nodeOrders.at(boundTableID);
+        adjList->nbrOrder = &data->nodeOrders.at(nbrTableID);
+        fillAdjList(context, graph, info, direction, *adjList);
+    }
+    return data;
+}
+
+std::shared_ptr<const CSRGraphData> MaterializedGraphCache::getOrBuild(ClientContext* context,
+    const NativeGraphEntry& entry) {
+    auto tableVersions =
+        context->getDatabase()->getTableVersionTracker()->getTableVersions(entry.getTableIDs());
+    if (!transaction::TableVersionTracker::isVisible(*transaction::Transaction::Get(*context),
+            tableVersions)) {
+        return nullptr;
+    }
+    auto schemaVersion = Catalog::Get(*context)->getSchemaVersion();
+    {
+        std::unique_lock lck{mtx};
+        if (data != nullptr && data->schemaVersion == schemaVersion &&
+            data->tableVersions == tableVersions) {
+            return data;
+        }
+    }
+    // Build without holding the lock, so that runs which can use the current CSR, e.g. of
+    // transactions that started before the latest write, are not blocked. Concurrent runs may
+    // build the same CSR, and the last one wins.
+    auto newData = buildGraphData(context, entry);
+    newData->schemaVersion = schemaVersion;
+    newData->tableVersions = std::move(tableVersions);
+    std::unique_lock lck{mtx};
+    data = newData;
+    return newData;
+}
+
+MaterializedGraphNbrScanState::MaterializedGraphNbrScanState(ClientContext* context,
+    const CSRRelTable& relTable, const std::vector<std::string>& relProperties,
+    SemiMask* nbrNodeMask, bool useNodeOrder)
+    : relTable{relTable}, nbrNodeMask{nbrNodeMask}, useNodeOrder{useNodeOrder},
+      propertyVectors{static_cast<uint32_t>(relProperties.size())} {
+    if (!useNodeOrder) {
+        nbrNodeBuffer.resize(DEFAULT_VECTOR_CAPACITY);
+    }
+    const CSRAdjList* anyAdjList = nullptr;
+    for (auto i = 0u; i < relTable.adjLists.size(); ++i) {
+        auto& adjList = relTable.adjLists[i];
+        if (adjList == nullptr) {
+            continue;
+        }
+        for (auto& name : relProperties) {
+            propertyIdxs[i].push_back(adjList->getPropertyIdx(name));
+            KU_ASSERT(propertyIdxs[i].back() != INVALID_IDX);
+        }
+        anyAdjList = adjList.get();
+    }
+    KU_ASSERT(anyAdjList != nullptr);
+    auto mm = MemoryManager::Get(*context);
+    for (auto i = 0u; i < relProperties.size(); ++i) {
+        auto& column = anyAdjList->properties[anyAdjList->getPropertyIdx(relProperties[i])];
+        propertyVectors.insert(i, std::make_shared<ValueVector>(column.type.copy(), mm));
+    }
+}
+
+void MaterializedGraphNbrScanState::startScan(RelDataDirection direction, offset_t boundOffset) {
+    auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+    adjList = relTable.adjLists[idx].get();
+    KU_ASSERT(adjList != nullptr);
+    currentPropertyIdxs = &propertyIdxs[idx];
+    nbrNodes = adjList->nbrNodes.getData();
+    if (!useNodeOrder) {
+        boundOffset = adjList->boundOrder->getNewOffset(boundOffset);
+    }
+    if (boundOffset < adjList->getNumBoundNodes()) {
+        nextPos = adjList->csrOffsets.get(boundOffset);
+        endPos = adjList->csrOffsets.get(boundOffset + 1);
+    } else {
+        nextPos = 0;
+        endPos = 0;
+    }
+    propertyVectors.state->getSelVectorUnsafe().setToUnfiltered(0);
+}
+
+bool MaterializedGraphNbrScanState::next() {
+    KU_ASSERT(adjList != nullptr);
+    auto& selVector = propertyVectors.state->getSelVectorUnsafe();
+    while (nextPos < endPos) {
+        auto numNbrs = std::min(endPos - nextPos, DEFAULT_VECTOR_CAPACITY);
+        nbrNodes = adjList->nbrNodes.getData() + nextPos;
+        if (!useNodeOrder) {
+            for (auto i = 0u; i < numNbrs; ++i) {
+                nbrNodeBuffer[i] = nodeID_t{adjList->nbrOrder->getOldOffset(nbrNodes[i].offset),
+                    nbrNodes[i].tableID};
+            }
+            nbrNodes = nbrNodeBuffer.data();
+        }
+        selVector.setToUnfiltered(numNbrs);
+        if (nbrNodeMask != nullptr) {
+            auto numSelected = 0u;
+            auto buffer = selVector.getMutableBuffer();
+            for (auto i = 0u; i < numNbrs; ++i) {
+                buffer[numSelected] = i;
+                numSelected += nbrNodeMask->isMasked(nbrNodes[i].offset);
+            }
+            selVector.setToFiltered(numSelected);
+        }
+        if (selVector.getSelSize() > 0) {
+            for (auto i = 0u; i < currentPropertyIdxs->size(); ++i) {
+                auto& column = adjList->properties[(*currentPropertyIdxs)[i]];
+                auto& vector = *propertyVectors.valueVectors[i];
+                memcpy(vector.getData(),
+                    column.values.getData() + nextPos * column.numBytesPerValue,
+                    numNbrs * column.numBytesPerValue);
+                if (column.hasNull) {
+                    for (auto j = 0u; j < numNbrs; ++j) {
+                        vector.setNull(j, column.nulls.get(nextPos + j));
+                    }
+                } else {
+                    vector.setAllNonNull();
+                }
+            }
+        }
+        nextPos += numNbrs;
+        if (selVector.getSelSize() > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+MaterializedGraph::MaterializedGraph(ClientContext* context, NativeGraphEntry entry,
+    std::shared_ptr<const CSRGraphData> data)
+    : context{context}, onDiskGraph{context, std::move(entry)}, data{std::move(data)} {}
+
+std::unique_ptr<NbrScanState> MaterializedGraph::prepareRelScan(const TableCatalogEntry& entry,
+    oid_t relTableID, table_id_t nbrTableID, std::vector<std::string> relProperties,
+    bool randomLookup) {
+    if (!data->relTables.contains(relTableID)) {
+        return onDiskGraph.prepareRelScan(entry, relTableID, nbrTableID, relProperties,
+            randomLookup);
+    }
+    auto& relTable = data->relTables.at(relTableID);
+    for (auto& adjList : relTable.adjLists) {
+        if (adjList == nullptr) {
+            continue;
+        }
+        for (auto& name : relProperties) {
+            if (adjList->getPropertyIdx(name) == INVALID_IDX) {
+                // On-disk scans return storage offsets.
+                KU_ASSERT(!nodeOrderUsed);
+                return onDiskGraph.prepareRelScan(entry, relTableID, nbrTableID, relProperties,
+                    randomLookup);
+            }
+        }
+    }
+    SemiMask* nbrNodeMask = nullptr;
+    if (nodeOffsetMaskMap != nullptr && nodeOffsetMaskMap->containsTableID(nbrTableID)) {
+        nbrNodeMask = nodeOffsetMaskMap->getOffsetMask(nbrTableID);
+    }
+    return std::make_unique<MaterializedGraphNbrScanState>(context, relTable, relProperties,
+        nbrNodeMask, nodeOrderUsed);
+}
+
+bool MaterializedGraph::useNodeOrder() {
+    // Node masks are indexed by storage offsets.
+    if (nodeOffsetMaskMap != nullptr) {
+        return false;
+    }
+    nodeOrderUsed = true;
+    return true;
+}
+
+offset_t MaterializedGraph::getOriginalOffset(table_id_t tableID, offset_t offset) const {
+    if (!nodeOrderUsed || !data->nodeOrders.contains(tableID)) {
+        return offset;
+    }
+    return data->nodeOrders.at(tableID).getOldOffset(offset);
+}
+
+Graph::EdgeIterator MaterializedGraph::scanFwd(nodeID_t nodeID, NbrScanState& state) {
+    auto materializedState = dynamic_cast<MaterializedGraphNbrScanState*>(&state);
+    if (materializedState == nullptr) {
+        return onDiskGraph.scanFwd(nodeID, state);
+    }
+    materializedState->startScan(RelDataDirection::FWD, nodeID.offset);
+    return EdgeIterator(materializedState);
+}
+
+Graph::EdgeIterator MaterializedGraph::scanBwd(nodeID_t nodeID, NbrScanState& state) {
+    auto materializedState = dynamic_cast<MaterializedGraphNbrScanState*>(&state);
+    if (materializedState == nullptr) {
+        return onDiskGraph.scanBwd(nodeID, state);
+    }
+    materializedState->startScan(RelDataDirection::BWD, nodeID.offset);
+    return EdgeIterator(materializedState);
+}
+
+} // namespace graph
+} // namespace kuzu
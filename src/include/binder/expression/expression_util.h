@@ -62,6 +62,10 @@ struct KUZU_API ExpressionUtil {
     static bool canCastStatically(const Expression& expr, const common::LogicalType& targetType);
 
     static bool canEvaluateAsLiteral(const Expression& expr);
+    // Returns true if evaluating the expression cannot raise a runtime error, i.e. it only
+    // compares, null-checks, combines with boolean connectives or applies non-throwing functions
+    // to columns and constants.
+    static bool canEvaluateWithoutError(const Expression& expr);
     static common::Value evaluateAsLiteralValue(const Expression& expr);
     static uint64_t evaluateAsSkipLimit(const Expression& expr);
 
@@ -16,7 +16,22 @@ public:
 
     void cast(const common::LogicalType& type) override;
 
-    common::Value getValue() const { return value; }
+    const std::string& getParameterName() const { return parameterName; }
+
+    // Reading the value while a statement is compiled makes its plan depend on the value, e.g. when
+    // the value decides an implicit cast or the number of rows to skip. Such plans are only reused
+    // for the same value (see PlanCache). Evaluating the parameter at runtime goes through
+    // ExpressionMapper instead, which takes the value of the execution.
+    common::Value getValue() const {
+        markValueUsed();
+        return value;
+    }
+    void markValueUsed() const {
+        if (!valueUsed) {
+            valueUsed = true;
+        }
+    }
+    bool isValueUsed() const { return valueUsed; }
 
 private:
     std::string toStringInternal() const override { return "$" + parameterName; }
@@ -25,6 +40,7 @@ private:
 private:
     std::string parameterName;
     common::Value value;
+    mutable bool valueUsed = false;
 };
 
 } // namespace binder
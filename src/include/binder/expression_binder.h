@@ -17,6 +17,7 @@ namespace binder {
 
 class Binder;
 struct CaseAlternative;
+class ParameterExpression;
 
 struct ExpressionBinderConfig {
     // If a property is not in projection list but required in order by after aggregation,
@@ -138,6 +139,9 @@ public:
     getKnownParameters() const {
         return knownParameters;
     }
+    // Whether the value of any bound parameter has been read while compiling the statement (see
+    // ParameterExpression::getValue()).
+    bool isParameterValueUsed() const;
 
     std::string getUniqueName(const std::string& name) const;
 
@@ -148,6 +152,7 @@ private:
     main::ClientContext* context;
     std::unordered_set<std::string> unknownParameters;
     std::unordered_map<std::string, std::shared_ptr<common::Value>> knownParameters;
+    std::vector<std::shared_ptr<ParameterExpression>> boundParameters;
     ExpressionBinderConfig config;
 };
 
@@ -26,6 +26,8 @@ public:
     void visit(std::shared_ptr<Expression> expr);
 
     static bool isRandom(const Expression& expression);
+    // Whether evaluating the expression twice over the same data may give different results.
+    static bool isNonDeterministic(const Expression& expression);
 
 protected:
     void visitSwitch(std::shared_ptr<Expression> expr);
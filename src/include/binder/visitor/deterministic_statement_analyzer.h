@@ -0,0 +1,29 @@
+#pragma once
+
+#include "binder/bound_statement_visitor.h"
+
+namespace kuzu {
+namespace binder {
+
+// Checks whether executing a statement twice over the same data gives the same result, i.e. it
+// neither calls random or clock functions nor reads external files.
+class DeterministicStatementAnalyzer final : public BoundStatementVisitor {
+public:
+    bool isDeterministic() const { return deterministic; }
+
+private:
+    void visitMatch(const BoundReadingClause& readingClause) override;
+    void visitUnwind(const BoundReadingClause& readingClause) override;
+    void visitTableFunctionCall(const BoundReadingClause&) override { deterministic = false; }
+    void visitLoadFrom(const BoundReadingClause&) override { deterministic = false; }
+    void visitProjectionBody(const BoundProjectionBody& projectionBody) override;
+    void visitProjectionBodyPredicate(const std::shared_ptr<Expression>& predicate) override;
+
+    void visitExpression(const std::shared_ptr<Expression>& expression);
+
+private:
+    bool deterministic = true;
+};
+
+} // namespace binder
+} // namespace kuzu
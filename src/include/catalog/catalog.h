@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "catalog/catalog_entry/function_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_set.h"
@@ -198,8 +200,12 @@ public:
     std::vector<std::string> getMacroNames(const transaction::Transaction* transaction) const;
     void dropMacro(transaction::Transaction* transaction, std::string& name);
 
-    void incrementVersion() { version++; }
+    void incrementVersion() {
+        version++;
+        schemaVersion++;
+    }
     uint64_t getVersion() const { return version; }
+    uint64_t getSchemaVersion() const { return schemaVersion; }
     bool changedSinceLastCheckpoint() const { return version != 0; }
     void resetVersion() { version = 0; }
 
@@ -244,6 +250,9 @@ private:
     // incremented whenever a change is made to the catalog
     // reset to 0 at the end of each checkpoint
     uint64_t version;
+    // incremented together with version but never reset, so that state derived from the catalog
+    // (e.g. cached plans) can tell whether the schema changed since it was derived
+    std::atomic<uint64_t> schemaVersion;
 };
 
 } // namespace catalog
@@ -15,7 +15,9 @@ class FlatTuple;
 }
 
 namespace common {
+class SelectionView;
 class Value;
+class ValueVector;
 
 // An Arrow Vector(i.e., Array) is defined by a few pieces of metadata and data:
 //  1) a logical data type;
@@ -53,11 +55,19 @@ public:
         bool fallbackExtensionTypes);
 
     void append(const processor::FlatTuple& tuple);
+    // Appends the values at selected positions [startIdx, startIdx + numValues) of value vectors
+    // sharing the same selection vector. Fixed-width and string columns are copied column by column
+    // without materializing Values; other types are converted value by value.
+    void append(const std::vector<ValueVector*>& valueVectors, const SelectionView& selVector,
+        uint64_t startIdx, uint64_t numValues);
     std::int64_t size() const { return numTuples; }
     ArrowArray toArray(const std::vector<LogicalType>& types);
 
 private:
     static void appendValue(ArrowVector* vector, const Value& value, bool fallbackExtensionTypes);
+    static void appendColumn(ArrowVector* vector, const ValueVector& valueVector,
+        const SelectionView& selVector, uint64_t startIdx, uint64_t numValues,
+        bool fallbackExtensionTypes);
 
     static ArrowArray* convertVectorToArray(ArrowVector& vector, const LogicalType& type,
         bool fallbackExtensionTypes);
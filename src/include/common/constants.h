@@ -162,6 +162,13 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Degree stats of rel tables are refreshed at checkpoint. Only use them if they cover at least
+    // this fraction of the rels.
+    static constexpr double MIN_DEGREE_STATS_COVERAGE = 0.5;
+    // With adaptive re-optimization, a query is re-planned if the actual cardinality of a hash join
+    // build side is off its estimate by more than this factor (in either direction).
+    static constexpr double REOPTIMIZATION_ERROR_THRESHOLD = 10;
+    static constexpr uint64_t MAX_NUM_REOPTIMIZATIONS = 3;
 };
 
 struct OrderByConstants {
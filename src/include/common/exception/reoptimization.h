@@ -0,0 +1,26 @@
+#pragma once
+
+#include "common/types/types.h"
+#include "exception.h"
+
+namespace kuzu {
+namespace common {
+
+// Aborts the execution of a query whose plan was built on a badly wrong cardinality estimate so
+// that it can be re-planned with the actual cardinality observed at a pipeline breaker.
+class ReoptimizationException : public Exception {
+public:
+    ReoptimizationException(std::string nodeName, cardinality_t cardinality)
+        : Exception("Query is aborted for re-optimization."), nodeName{std::move(nodeName)},
+          cardinality{cardinality} {}
+
+    std::string getNodeName() const { return nodeName; }
+    cardinality_t getCardinality() const { return cardinality; }
+
+private:
+    std::string nodeName;
+    cardinality_t cardinality;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -59,6 +59,9 @@ public:
 
     storage::MemoryManager* getMemoryManager() { return memoryManager; }
 
+    // Number of bytes allocated for all blocks, including unused space at their ends.
+    uint64_t getMemoryUsage() const;
+
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
         return blocks.empty() ||
@@ -29,7 +29,8 @@ class KUZU_API Task {
 public:
     explicit Task(uint64_t maxNumThreads)
         : parent{nullptr}, maxNumThreads{maxNumThreads}, numThreadsFinished{0},
-          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX} {}
+          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX},
+          concurrentDependencies{false} {}
 
     virtual ~Task() = default;
     virtual void run() = 0;
@@ -52,12 +53,24 @@ public:
         return isCompletedNoLock() && !hasExceptionNoLock();
     }
 
+    bool isCompleted() {
+        lock_t lck{taskMtx};
+        return isCompletedNoLock();
+    }
+
     bool isCompletedNoLock() const {
         return numThreadsRegistered > 0 && numThreadsFinished == numThreadsRegistered;
     }
 
     void setSingleThreadedTask() { maxNumThreads = 1; }
 
+    // By default, the dependencies of a task are scheduled one after another. If the tasks in the
+    // dependency subtree only share state through their parent-child relationships, they can
+    // instead be scheduled as a DAG: a task is scheduled as soon as all of its own dependencies
+    // have completed, so independent dependencies run concurrently and share the worker threads.
+    void setConcurrentDependencies() { concurrentDependencies = true; }
+    bool hasConcurrentDependencies() const { return concurrentDependencies; }
+
     bool registerThread();
 
     void deRegisterThreadAndFinalizeTask();
@@ -101,6 +114,7 @@ protected:
     uint64_t maxNumThreads, numThreadsFinished, numThreadsRegistered;
     std::exception_ptr exceptionsPtr;
     uint64_t ID;
+    bool concurrentDependencies;
 };
 
 } // namespace common
@@ -1,21 +1,32 @@
 #pragma once
+#include <array>
 #include <deque>
 
 #ifndef __SINGLE_THREADED__
+#include <atomic>
 #include <condition_variable>
 #include <thread>
 #endif
 
 #include "common/task_system/task.h"
+#include "common/task_system/workload_class.h"
 #include "processor/execution_context.h"
 
 namespace kuzu {
 namespace common {
 
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID, WorkloadPriority priority,
+        std::shared_ptr<storage::QueryMemoryTracker> memoryTracker)
+        : task{std::move(task)}, ID{ID}, priority{priority},
+          memoryTracker{std::move(memoryTracker)} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    WorkloadPriority priority;
+    // Index of the worker queue the task is put into.
+    uint64_t queueIdx = 0;
+    // Memory allocated by the workers of the task is charged to the query it belongs to.
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker;
 };
 
 /**
@@ -34,10 +45,21 @@ struct ScheduledTask {
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * If the task allows concurrent dependencies (see Task::setConcurrentDependencies()), its
+ * dependency subtree is scheduled as a DAG instead: every dependency whose own dependencies have
+ * completed is put into the queue, so independent pipelines are worked on at the same time.
+ *
+ * Every worker thread owns a task queue. Pushed tasks are spread over the queues round-robin, and
+ * each queue is guarded by its own mutex, so pushing tasks and registering workers to tasks of
+ * different queues do not contend. A worker first looks for a task in its own queue and then steals
+ * one from the queues of the other workers. Tasks stay in the queue they are pushed into until they
+ * complete, so several workers can register themselves to the same task.
+ *
+ * Workers always register themselves to a task of the highest priority (see WorkloadClass) that
+ * accepts more threads. Within a queue, tasks of the same priority are registered to in FIFO
+ * order. However this does not guarantee that the tasks will be completed in FIFO order: a long
+ * running task that is not accepting more registration can stay in the queue for an unlimited time
+ * until completion.
  */
 #ifndef __SINGLE_THREADED__
 class KUZU_API TaskScheduler {
@@ -50,33 +72,68 @@ public:
     ~TaskScheduler();
 
     // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
+    // not concurrently, unless the task allows concurrent dependencies), and throws an exception
+    // if any of the tasks errors. Regardless of
     // whether or not the given task or one of its dependencies errors, when this function
     // returns, no task related to the given task will be in the task queue. Further no worker
     // thread will be working on the given task.
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
+    WorkloadClassManager* getWorkloadClassManager() { return &workloadClassManager; }
+
     static TaskScheduler* Get(const main::ClientContext& context);
 
 private:
-    // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
-
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
-
-    void removeErroringTask(uint64_t scheduledTaskID);
+    struct WorkerQueue {
+        std::mutex mtx;
+        // Ordered by priority and FIFO within the same priority.
+        std::deque<std::shared_ptr<ScheduledTask>> tasks;
+    };
 
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    // Functions to launch worker threads and for the worker threads to use to grab task from queue.
+    void runWorkerThread(uint64_t workerIdx);
+
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        const processor::ExecutionContext& context);
+
+    // Returns false if one of the dependencies requested to terminate all subsequent tasks.
+    bool scheduleDependenciesConcurrentlyAndWaitOrError(const Task& task,
+        processor::ExecutionContext* context);
+
+    void removeErroringTask(const ScheduledTask& scheduledTask);
+    // Removes the task from its queue unless a worker has registered itself to it. Returns whether
+    // the task was removed.
+    bool removeTaskIfNotStarted(const ScheduledTask& scheduledTask);
+
+    // Returns nullptr once the worker threads are stopped.
+    std::shared_ptr<ScheduledTask> waitForTaskAndRegister(uint64_t workerIdx);
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(uint64_t workerIdx);
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(WorkerQueue& queue,
+        WorkloadPriority minPriority);
+    void wakeUpIdleWorker();
+    void notifyTaskFinished();
     static void runTask(Task* task);
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
-    bool stopWorkerThreads;
+    std::vector<std::unique_ptr<WorkerQueue>> workerQueues;
+    std::atomic<uint64_t> nextQueueIdx;
+    // Number of tasks in all queues, by priority.
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(WorkloadPriority::HIGH) + 1>
+        numQueuedTasks;
+    std::atomic<bool> stopWorkerThreads;
     std::vector<std::thread> workerThreads;
-    std::mutex taskSchedulerMtx;
-    std::condition_variable cv;
-    uint64_t nextScheduledTaskID;
+    // Idle workers sleep on idleWorkerCV until the wake-up epoch changes. The mutex is only taken
+    // when a worker goes to sleep or there is a sleeping worker to wake up.
+    std::mutex idleWorkerMtx;
+    std::condition_variable idleWorkerCV;
+    std::atomic<uint64_t> wakeUpEpoch;
+    std::atomic<uint64_t> numIdleWorkers;
+    // Notified whenever a task completes or errors.
+    std::mutex taskFinishedMtx;
+    std::condition_variable taskFinishedCV;
+    std::atomic<uint64_t> nextScheduledTaskID;
+    WorkloadClassManager workloadClassManager;
 #if defined(__APPLE__)
     uint32_t threadQos; // Thread quality of service for worker threads.
 #endif
@@ -91,12 +148,18 @@ public:
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
+    WorkloadClassManager* getWorkloadClassManager() { return &workloadClassManager; }
+
     static TaskScheduler* Get(const main::ClientContext& context);
 
 private:
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        const processor::ExecutionContext& context);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueueNoLock(const std::shared_ptr<Task>& task,
+        const processor::ExecutionContext& context);
 
     void removeErroringTask(uint64_t scheduledTaskID);
+    void removeTaskNoLock(uint64_t scheduledTaskID);
 
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
     static void runTask(Task* task);
@@ -106,6 +169,7 @@ private:
     bool stopWorkerThreads;
     std::mutex taskSchedulerMtx;
     uint64_t nextScheduledTaskID;
+    WorkloadClassManager workloadClassManager;
 };
 #endif
 } // namespace common
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/api.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+namespace common {
+
+enum class WorkloadPriority : uint8_t {
+    LOW = 0,
+    NORMAL = 1,
+    HIGH = 2,
+};
+
+struct KUZU_API WorkloadPriorityUtils {
+    static WorkloadPriority fromString(const std::string& str);
+    static std::string toString(WorkloadPriority priority);
+};
+
+/**
+ * A workload class groups the queries of the connections assigned to it (see the workload_class
+ * setting) and limits the resources they can use:
+ *  - priority: workers pick up tasks of higher priority classes first;
+ *  - maxNumThreads: maximum number of threads a task of a query can use;
+ *  - maxMemoryPerQuery: maximum number of bytes of intermediate memory a query can allocate;
+ *  - maxConcurrentQueries: maximum number of queries of the class executing at the same time.
+ *    Further queries wait in an admission queue until a running query finishes.
+ * A limit of 0 means unlimited.
+ */
+struct WorkloadClass {
+    static constexpr const char* DEFAULT_CLASS_NAME = "default";
+
+    std::string name;
+    WorkloadPriority priority = WorkloadPriority::NORMAL;
+    uint64_t maxNumThreads = 0;
+    uint64_t maxMemoryPerQuery = 0;
+    uint64_t maxConcurrentQueries = 0;
+
+    WorkloadClass() = default;
+    WorkloadClass(std::string name, WorkloadPriority priority, uint64_t maxNumThreads,
+        uint64_t maxMemoryPerQuery, uint64_t maxConcurrentQueries)
+        : name{std::move(name)}, priority{priority}, maxNumThreads{maxNumThreads},
+          maxMemoryPerQuery{maxMemoryPerQuery}, maxConcurrentQueries{maxConcurrentQueries} {}
+};
+
+/**
+ * Keeps the workload classes of a database and implements the admission queue of each class.
+ * Queries are admitted in FIFO order within a class.
+ */
+class KUZU_API WorkloadClassManager {
+public:
+    WorkloadClassManager();
+
+    // Creates the workload class or replaces the limits of an existing one. Queries that are
+    // already admitted keep the limits they were admitted with.
+    void setWorkloadClass(WorkloadClass workloadClass);
+    bool containsWorkloadClass(const std::string& name) const;
+    WorkloadClass getWorkloadClass(const std::string& name) const;
+    std::vector<WorkloadClass> getWorkloadClasses() const;
+
+    // Blocks until the query can be admitted to its workload class. Throws if the query is
+    // interrupted or times out while waiting. Queries executed by a connection while it is
+    // already admitted (e.g. by IMPORT DATABASE) share the admission of the outer query.
+    WorkloadClass admitQuery(const std::string& name, main::ClientContext& context);
+    void finishQuery(const std::string& name, const main::ClientContext& context);
+
+private:
+    struct WorkloadClassState {
+        WorkloadClass workloadClass;
+        uint64_t numActiveQueries = 0;
+        // Tickets of the queries waiting for admission, in arrival order.
+        std::deque<uint64_t> waitingQueries;
+
+        explicit WorkloadClassState(WorkloadClass workloadClass)
+            : workloadClass{std::move(workloadClass)} {}
+
+        bool canAdmitQuery() const {
+            return workloadClass.maxConcurrentQueries == 0 ||
+                   numActiveQueries < workloadClass.maxConcurrentQueries;
+        }
+    };
+
+    WorkloadClassState& getStateNoLock(const std::string& name);
+
+private:
+    // Interval to check for interruption and timeout while waiting for admission.
+    static constexpr uint64_t ADMISSION_WAIT_INTERVAL_IN_MS = 10;
+
+    mutable std::mutex mtx;
+    std::condition_variable cv;
+    std::unordered_map<std::string, WorkloadClassState> workloadClasses;
+    uint64_t nextTicket;
+    // Number of nested admissions of each connection that currently holds an admission.
+    std::unordered_map<const main::ClientContext*, uint64_t> numAdmissionsPerContext;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "function/gds/bfs_graph.h"
+#include "function/gds/delta_stepping.h"
 #include "gds_auxilary_state.h"
 
 namespace kuzu {
@@ -31,9 +32,15 @@ public:
         : bfsGraphManager{std::move(bfsGraphManager)} {}
 
     BFSGraphManager* getBFSGraphManager() { return bfsGraphManager.get(); }
+    DeltaSteppingBuckets* getBuckets() { return &buckets; }
+    bool hasPathLongerThan(uint64_t maxHops, const common::NodeOffsetMaskMap* outputNodeMask) {
+        return bfsGraphManager->getCurrentGraph()->hasSinglePathLongerThan(maxHops,
+            outputNodeMask);
+    }
 
     void initSource(common::nodeID_t sourceNodeID) override {
         sourceParent.setCost(0);
+        sourceParent.setIter(0);
         bfsGraphManager->getCurrentGraph()->pinTableID(sourceNodeID.tableID);
         bfsGraphManager->getCurrentGraph()->setParentList(sourceNodeID.offset, &sourceParent);
     }
@@ -49,6 +56,8 @@ public:
 private:
     std::unique_ptr<BFSGraphManager> bfsGraphManager;
     ParentList sourceParent;
+    // Only used by single weighted shortest paths.
+    DeltaSteppingBuckets buckets;
 };
 
 } // namespace function
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/mask.h"
 #include "density_state.h"
 #include "gds_object_manager.h"
 #include "graph/graph.h"
@@ -70,10 +71,14 @@ public:
         common::nodeID_t nbrNodeID, bool fwdEdge, double weight,
         ObjectBlock<ParentList>* block) = 0;
     // Used to track path for single weighted shortest path. Assume each offset has at most one
-    // parent.
+    // parent, whose iteration is the number of edges of the path.
     virtual bool tryAddSingleParentWithWeight(common::nodeID_t boundNodeID, common::relID_t edgeID,
         common::nodeID_t nbrNodeID, bool fwdEdge, double weight,
         ObjectBlock<ParentList>* block) = 0;
+    // Returns true if the single weighted shortest path to an output node has more than maxHops
+    // edges.
+    virtual bool hasSinglePathLongerThan(uint64_t maxHops,
+        const common::NodeOffsetMaskMap* outputNodeMask) = 0;
 
     virtual ParentList* getParentListHead(common::offset_t offset) = 0;
     virtual ParentList* getParentListHead(common::nodeID_t nodeID) = 0;
@@ -113,6 +118,8 @@ public:
     bool tryAddSingleParentWithWeight(common::nodeID_t boundNodeID, common::relID_t edgeID,
         common::nodeID_t nbrNodeID, bool fwdEdge, double weight,
         ObjectBlock<ParentList>* block) override;
+    bool hasSinglePathLongerThan(uint64_t maxHops,
+        const common::NodeOffsetMaskMap* outputNodeMask) override;
 
     ParentList* getParentListHead(common::offset_t offset) override;
     ParentList* getParentListHead(common::nodeID_t nodeID) override;
@@ -145,6 +152,8 @@ public:
     bool tryAddSingleParentWithWeight(common::nodeID_t boundNodeID, common::relID_t edgeID,
         common::nodeID_t nbrNodeID, bool fwdEdge, double weight,
         ObjectBlock<ParentList>* block) override;
+    bool hasSinglePathLongerThan(uint64_t maxHops,
+        const common::NodeOffsetMaskMap* outputNodeMask) override;
 
     ParentList* getParentListHead(common::offset_t offset) override;
     ParentList* getParentListHead(common::nodeID_t nodeID) override;
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+
+#include "common/enums/extend_direction.h"
+#include "common/types/internal_id_util.h"
+#include "graph/node_nbr_scanner.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace function {
+
+// An edge of a path found by a bidirectional search, together with the node it leads to.
+struct BidirectionalBFSStep {
+    common::nodeID_t nodeID;
+    common::relID_t edgeID;
+    // Whether the edge is traversed along its direction.
+    bool isFwd;
+};
+
+// Finds a shortest path between two given nodes by expanding a frontier forward from the source
+// and a frontier backward from the destination, always expanding the smaller one, until they
+// meet. Compared to a search from the source only, this visits roughly the square root of the
+// number of nodes on low-diameter graphs.
+class BidirectionalBFS {
+    struct Parent {
+        common::nodeID_t nodeID;
+        common::relID_t edgeID;
+        bool isFwd;
+    };
+
+    struct Side {
+        // Direction each frontier node is extended in, and whether edges scanned in this direction
+        // are traversed along their direction by a path from the source to the destination.
+        std::vector<std::pair<common::ExtendDirection, bool>> directions;
+        common::node_id_map_t<Parent> parents;
+        std::vector<common::nodeID_t> frontier;
+        uint16_t depth = 0;
+    };
+
+public:
+    BidirectionalBFS(graph::Graph* graph, common::ExtendDirection extendDirection,
+        uint16_t upperBound);
+
+    // Returns the steps of a shortest path from the source, excluded, to the destination, or an
+    // empty vector if the destination cannot be reached within the upper bound.
+    std::vector<BidirectionalBFSStep> search(main::ClientContext* context,
+        common::nodeID_t sourceNodeID, common::nodeID_t dstNodeID);
+
+private:
+    // Extends every node of the frontier of the given side by one edge. Returns a node reached by
+    // both sides, if any.
+    common::nodeID_t expand(main::ClientContext* context, Side& side, const Side& otherSide);
+
+    void initSide(Side& side, common::nodeID_t nodeID, bool fromSource) const;
+
+    std::vector<BidirectionalBFSStep> getPath(const Side& fwdSide, const Side& bwdSide,
+        common::nodeID_t meetingNodeID) const;
+
+private:
+    common::ExtendDirection extendDirection;
+    uint16_t upperBound;
+    graph::NodeNbrScanner scanner;
+};
+
+} // namespace function
+} // namespace kuzu
@@ -28,6 +28,20 @@ public:
 
     virtual bool terminate(common::NodeOffsetMaskMap&) { return false; }
 
+    // Edge computes of BFS-like algorithms, which activate a node from any one of its parents on
+    // the current frontier, can also run pull-based ("bottom-up") iterations. Instead of extending
+    // every node of a large frontier, a pull-based iteration scans the edges of the nodes that are
+    // not visited yet back to the current frontier, and stops at the first parent it finds.
+    virtual bool supportsPull() const { return false; }
+    // Returns true if the node is not visited yet in a pull-based iteration.
+    virtual bool needsParent(common::nodeID_t) { return false; }
+    // Looks for a parent of nodeID on the current frontier among the nbrs of the chunk. fwdEdge is
+    // true if the edges are traversed along their direction from the parent to nodeID. Returns true
+    // if a parent is found, in which case nodeID is put in the next frontier by the caller.
+    virtual bool pullEdgeCompute(common::nodeID_t, graph::NbrScanState::Chunk&, bool) {
+        return false;
+    }
+
     virtual std::unique_ptr<EdgeCompute> copy() = 0;
 };
 
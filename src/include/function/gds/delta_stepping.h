@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "common/mask.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace function {
+
+// Buckets of the delta-stepping algorithm for weighted shortest paths. Bucket i holds the nodes
+// whose tentative cost lies in [i * delta, (i + 1) * delta). Nodes of a bucket are only relaxed
+// once all earlier buckets are settled, so far fewer edges are relaxed again after the cost of
+// their bound node is lowered than with Bellman-Ford style iterations over all improved nodes.
+//
+// The edge compute of a weighted shortest path algorithm activates a node reached with a cost in
+// the current bucket, and defers the others to their bucket. Delta is tuned after the first
+// iteration from the weights of the edges relaxed from the source.
+class DeltaSteppingBuckets {
+    static constexpr uint64_t MAX_NUM_SETTLED_CHECK_NODES = 100;
+
+public:
+    bool isTuned() const { return tuned; }
+    // Records the weight of an edge relaxed before delta is tuned.
+    void addWeight(double weight);
+    // Sets delta to the mean weight of the edges relaxed so far.
+    void tune();
+
+    // Puts all nodes into a single bucket, which relaxes the edges of every improved node in each
+    // iteration like Bellman-Ford.
+    void useSingleBucket();
+
+    bool isInCurrentBucket(double cost) const {
+        return !tuned || getBucketIdx(cost) <= curBucketIdx;
+    }
+    // Nodes with a lower cost than the start of the current bucket are settled.
+    double getCurrentBucketStartCost() const {
+        return tuned && std::isfinite(delta) ? curBucketIdx * delta : 0;
+    }
+    // Returns true if all nodes of the enabled masks are settled. getCost returns the tentative
+    // cost of a node. Skips checking if there are too many nodes to finish early.
+    template<typename Func>
+    bool areSettled(const common::NodeOffsetMaskMap& maskMap, Func getCost) const {
+        if (maskMap.getNumMaskedNode() > MAX_NUM_SETTLED_CHECK_NODES) {
+            return false;
+        }
+        auto startCost = getCurrentBucketStartCost();
+        auto hasMaskedNode = false;
+        for (auto& [tableID, mask] : maskMap.getMasks()) {
+            if (!mask->isEnabled()) {
+                continue;
+            }
+            for (auto offset : mask->collectMaskedNodes(mask->getNumMaskedNodes())) {
+                hasMaskedNode = true;
+                if (!(getCost(common::nodeID_t{offset, tableID}) < startCost)) {
+                    return false;
+                }
+            }
+        }
+        return hasMaskedNode;
+    }
+    // Returns true if the node is in the output of the search, i.e. there is no enabled output
+    // mask for its table or the mask contains it.
+    static bool isOutputNode(const common::NodeOffsetMaskMap* outputNodeMask,
+        common::nodeID_t nodeID) {
+        if (outputNodeMask == nullptr || !outputNodeMask->containsTableID(nodeID.tableID)) {
+            return true;
+        }
+        auto mask = outputNodeMask->getOffsetMask(nodeID.tableID);
+        return !mask->isEnabled() || mask->isMasked(nodeID.offset);
+    }
+    // Thread-safe.
+    void defer(common::nodeID_t nodeID, double cost);
+
+    // Moves to the next non-empty bucket and returns its nodes. Returns an empty vector if all
+    // buckets are empty.
+    std::vector<common::nodeID_t> popNextBucket();
+
+private:
+    uint64_t getBucketIdx(double cost) const;
+
+private:
+    std::mutex mtx;
+    bool tuned = false;
+    double delta = 0;
+    double weightSum = 0;
+    uint64_t numWeights = 0;
+    uint64_t curBucketIdx = 0;
+    std::map<uint64_t, std::vector<common::nodeID_t>> buckets;
+};
+
+} // namespace function
+} // namespace kuzu
@@ -167,9 +167,20 @@ public:
     virtual ~FrontierPair() = default;
 
     void resetCurrentIter() { curIter = 0; }
+    // Moves back to an earlier iteration, e.g. to revisit the nodes of a BFS level by level.
+    void setCurrentIter(iteration_t iter) { curIter = iter; }
     iteration_t getCurrentIter() const { return curIter; }
 
     void setActiveNodesForNextIter() { hasActiveNodesForNextIter_.store(true); }
+    bool hasActiveNodesForNextIter() const {
+        return hasActiveNodesForNextIter_.load(std::memory_order_relaxed);
+    }
+    // Number of nodes activated in the last iteration, as counted by frontier tasks. A node
+    // activated concurrently by several threads may be counted more than once.
+    uint64_t getNumActiveNodesOnCurrentFrontier() const { return numActiveNodesOnCurrentFrontier; }
+    void addNumActiveNodesForNextIter(uint64_t numNodes) {
+        numActiveNodesForNextIter.fetch_add(numNodes, std::memory_order_relaxed);
+    }
 
     bool continueNextIter(uint16_t maxIter) {
         return hasActiveNodesForNextIter_.load(std::memory_order_relaxed) &&
@@ -210,6 +221,8 @@ protected:
     // curIter is the iteration number of the algorithm and starts from 0.
     iteration_t curIter = 0;
     std::atomic<bool> hasActiveNodesForNextIter_;
+    uint64_t numActiveNodesOnCurrentFrontier = 0;
+    std::atomic<uint64_t> numActiveNodesForNextIter = 0;
     Frontier* currentFrontier = nullptr;
     Frontier* nextFrontier = nullptr;
 };
@@ -217,7 +230,7 @@ protected:
 // Shortest path (excluding weighted shortest path )frontier implementation. Different from other
 // recursive algorithms, shortest path has the guarantee that a node will not be visited repeatedly
 // in different iteration. So we make current/next frontier reference writes to the same frontier.
-class SPFrontierPair : public FrontierPair {
+class KUZU_API SPFrontierPair : public FrontierPair {
 public:
     explicit SPFrontierPair(std::unique_ptr<DenseFrontier> denseFrontier);
 
@@ -298,7 +311,7 @@ private:
     std::shared_ptr<DenseFrontier> nextDenseFrontier;
 };
 
-class SPEdgeCompute : public EdgeCompute {
+class KUZU_API SPEdgeCompute : public EdgeCompute {
 public:
     explicit SPEdgeCompute(SPFrontierPair* frontierPair)
         : frontierPair{frontierPair}, numNodesReached{0} {}
@@ -307,6 +320,10 @@ public:
 
     bool terminate(common::NodeOffsetMaskMap& maskMap) override;
 
+    bool needsParent(common::nodeID_t nodeID) override {
+        return frontierPair->getNextFrontierValue(nodeID.offset) == FRONTIER_UNVISITED;
+    }
+
 protected:
     SPFrontierPair* frontierPair;
     // States that should be only modified with single thread
@@ -77,6 +77,8 @@ public:
         return data[pos];
     }
 
+    T* getData() const { return data.data(); }
+
 private:
     template<typename U>
     friend class AtomicObjectArray;
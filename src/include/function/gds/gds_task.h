@@ -19,6 +19,8 @@ struct FrontierTaskInfo {
     common::ExtendDirection direction;
     EdgeCompute& edgeCompute;
     std::vector<std::string> propertiesToScan;
+    // Whether to run a pull-based iteration over the nbr table, see EdgeCompute::supportsPull.
+    bool pull = false;
 
     FrontierTaskInfo(common::table_id_t srcTableID, common::table_id_t dstTableID,
         catalog::TableCatalogEntry* relGroupEntry, graph::Graph* graph,
@@ -30,7 +32,8 @@ struct FrontierTaskInfo {
     FrontierTaskInfo(const FrontierTaskInfo& other)
         : srcTableID{other.srcTableID}, dstTableID{other.dstTableID},
           relGroupEntry{other.relGroupEntry}, graph{other.graph}, direction{other.direction},
-          edgeCompute{other.edgeCompute}, propertiesToScan{other.propertiesToScan} {}
+          edgeCompute{other.edgeCompute}, propertiesToScan{other.propertiesToScan},
+          pull{other.pull} {}
 
     common::table_id_t getBoundTableID() const;
     common::table_id_t getNbrTableID() const;
@@ -56,6 +59,9 @@ public:
 
     void runSparse();
 
+private:
+    void runPull();
+
 private:
     FrontierTaskInfo info;
     std::shared_ptr<FrontierTaskSharedState> sharedState;
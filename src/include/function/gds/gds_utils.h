@@ -2,6 +2,7 @@
 
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/enums/extend_direction.h"
+#include "delta_stepping.h"
 #include "gds_state.h"
 
 namespace kuzu {
@@ -22,6 +23,14 @@ public:
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
         uint64_t maxIteration, common::NodeOffsetMaskMap* outputNodeMask,
         const std::vector<std::string>& propertiesToScan);
+    // Run edge compute for weighted shortest path with delta-stepping. The edge compute activates
+    // the nodes reached in the current bucket and defers the others to the given buckets.
+    // The hop upper bound is not applied. Returns false if the search does not finish within the
+    // iterations a frontier can record.
+    static bool runDeltaSteppingEdgeCompute(processor::ExecutionContext* context,
+        GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
+        DeltaSteppingBuckets& buckets, common::NodeOffsetMaskMap* outputNodeMask,
+        const std::vector<std::string>& propertiesToScan);
 
     // Run vertex compute without property scan
     static void runVertexCompute(processor::ExecutionContext* context, GDSDensityState densityState,
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/enums/extend_direction.h"
+#include "common/types/internal_id_util.h"
+#include "function/gds/gds_object_manager.h"
+#include "graph/graph_entry.h"
+#include "graph/node_nbr_scanner.h"
+#include "transaction/table_version_tracker.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace function {
+
+// Scans the neighbors of a node together with the ID and the weight of the edges leading to them.
+class WeightedNbrScanner {
+public:
+    WeightedNbrScanner(graph::Graph* graph, common::ExtendDirection extendDirection,
+        const std::string& weightPropertyName, const common::LogicalType& weightType);
+
+    // Calls func(nbrNodeID, edgeID, isFwd, weight) for every edge of the node in the extend
+    // direction, or in the opposite direction if reverse is set.
+    template<typename Func>
+    void scan(common::nodeID_t nodeID, bool reverse, Func func);
+
+private:
+    common::ExtendDirection extendDirection;
+    common::LogicalTypeID weightTypeID;
+    graph::NodeNbrScanner scanner;
+};
+
+// Costs of the shortest paths from and to a few landmark nodes. By the triangle inequality,
+// cost(v, t) >= cost(L, t) - cost(L, v) and cost(v, t) >= cost(v, L) - cost(t, L) for every
+// landmark L, which gives a lower bound on the cost of the shortest path between any two nodes.
+// Since the bound only depends on the triangle inequality, landmarks computed over a graph stay
+// valid for any of its subgraphs, e.g. the graph filtered by the predicates of a query.
+struct LandmarkDistances {
+    static constexpr double UNREACHABLE = std::numeric_limits<double>::infinity();
+
+    uint64_t schemaVersion = 0;
+    // Commit version of every node table and rel table of the graph at build time.
+    transaction::table_versions_t tableVersions;
+    uint64_t numLandmarks = 0;
+    // Cost of the shortest path from landmark i to a node, and from the node to landmark i, at
+    // index offset * numLandmarks + i of the table of the node. Allocated through the memory
+    // manager, so cached distances count towards the buffer pool.
+    common::table_id_map_t<ObjectArray<double>> fromLandmark;
+    common::table_id_map_t<ObjectArray<double>> toLandmark;
+
+    // Returns UNREACHABLE if the destination cannot be reached from the node.
+    double getLowerBound(common::nodeID_t nodeID, common::nodeID_t dstNodeID) const;
+};
+
+// Landmark distances of weighted graphs, built by the first weighted shortest path query with
+// landmarks enabled and reused by later queries until a transaction commits a write to one of the
+// tables of the graph. Only the most recently used distances are kept.
+class LandmarkCache {
+public:
+    static constexpr uint64_t MAX_NUM_ENTRIES = 4;
+
+    // Returns nullptr if the transaction of the context might see a different version of the
+    // graph than the latest committed one.
+    std::shared_ptr<const LandmarkDistances> getOrBuild(main::ClientContext* context,
+        const graph::NativeGraphEntry& entry, common::ExtendDirection extendDirection,
+        const std::string& weightPropertyName, const common::LogicalType& weightType,
+        uint64_t numLandmarks);
+
+private:
+    std::mutex mtx;
+    // Keys and distances in order of their last use, most recent first.
+    std::list<std::pair<std::string, std::shared_ptr<const LandmarkDistances>>> entries;
+};
+
+// An edge of a path found by an A* search, together with the node it leads to.
+struct AStarStep {
+    common::nodeID_t nodeID;
+    common::relID_t edgeID;
+    // Whether the edge is traversed along its direction.
+    bool isFwd;
+    double weight;
+};
+
+// A* search for a weighted shortest path between two given nodes, guided by landmark lower bounds
+// (ALT, Goldberg and Harrelson). Nodes are expanded in increasing order of their cost from the
+// source plus their lower bound to the destination, so nodes leading away from the destination
+// are rarely expanded.
+class LandmarkAStar {
+    struct Label {
+        double cost;
+        common::nodeID_t parentNodeID;
+        common::relID_t edgeID;
+        bool isFwd;
+        double weight;
+    };
+
+public:
+    LandmarkAStar(graph::Graph* graph, common::ExtendDirection extendDirection,
+        const std::string& weightPropertyName, const common::LogicalType& weightType,
+        std::shared_ptr<const LandmarkDistances> landmarks);
+
+    // Returns the steps of a shortest path from the source, excluded, to the destination, or an
+    // empty vector if the destination cannot be reached.
+    std::vector<AStarStep> search(main::ClientContext* context, common::nodeID_t sourceNodeID,
+        common::nodeID_t dstNodeID);
+
+private:
+    WeightedNbrScanner scanner;
+    std::shared_ptr<const LandmarkDistances> landmarks;
+};
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "common/enums/extend_direction.h"
+#include "gds_object_manager.h"
+#include "graph/node_nbr_scanner.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace function {
+
+// Multi-source BFS (Then et al., "The More the Merrier: Efficient Multi-Source Graph Traversal").
+// Up to 64 sources are traversed at once. Every node keeps a bitset of the sources that have
+// reached it, and the neighbors of a frontier node are scanned once for all the sources that
+// reached it in the previous iteration, instead of once per source.
+class MultiSourceBFS {
+    // Bitsets of the sources that have reached each node of a table, that reached it in the last
+    // iteration, and that reach it in the current iteration.
+    struct NodeBitsets {
+        ObjectArray<uint64_t> seen;
+        ObjectArray<uint64_t> visit;
+        ObjectArray<uint64_t> visitNext;
+    };
+
+public:
+    static constexpr uint64_t MAX_NUM_SOURCES = 64;
+
+    // Returns false to stop the traversal.
+    using reach_func_t =
+        std::function<bool(common::idx_t sourceIdx, common::nodeID_t nodeID, uint16_t length)>;
+
+    MultiSourceBFS(main::ClientContext* context, graph::Graph* graph,
+        common::ExtendDirection extendDirection, uint16_t upperBound);
+
+    // Calls func once for every pair of source and node reached from it within the upper bound,
+    // in increasing order of length. The sources themselves are not reported.
+    void run(const std::vector<common::nodeID_t>& sourceNodeIDs, const reach_func_t& func);
+
+private:
+    void reset();
+    void extend(common::nodeID_t boundNodeID, uint64_t bits, std::vector<common::nodeID_t>& next);
+
+private:
+    main::ClientContext* context;
+    common::ExtendDirection extendDirection;
+    uint16_t upperBound;
+    graph::NodeNbrScanner scanner;
+    common::table_id_map_t<NodeBitsets> bitsets;
+    // Nodes reached by any source, whose bitsets are cleared before the next run.
+    std::vector<common::nodeID_t> reachedNodes;
+};
+
+} // namespace function
+} // namespace kuzu
@@ -3,7 +3,11 @@
 #include "binder/expression/expression.h"
 #include "common/enums/extend_direction.h"
 #include "common/enums/path_semantic.h"
+#include "function/gds/bidirectional_bfs.h"
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_state.h"
+#include "function/gds/landmarks.h"
+#include "function/gds/multi_source_bfs.h"
 #include "graph/graph_entry.h"
 #include "processor/operator/recursive_extend_shared_state.h"
 #include "rj_output_writer.h"
@@ -54,6 +58,42 @@ public:
         const RJBindData& bindData, GDSComputeState& computeState, common::nodeID_t sourceNodeID,
         processor::RecursiveExtendSharedState* sharedState) = 0;
 
+    // Algorithms tracking a single shortest path per destination can find the path to a single
+    // bound destination with a bidirectional search instead of a search from the source only.
+    virtual bool supportsBidirectionalSearch() const { return false; }
+    // Records an edge of the path found by a bidirectional search as the edge compute of the
+    // algorithm would. The frontier pair of the compute state has been updated by the caller.
+    virtual void addBidirectionalSearchEdge(GDSComputeState&, common::nodeID_t,
+        const BidirectionalBFSStep&) {}
+
+    // Weighted shortest path algorithms whose edge compute defers nodes to delta-stepping buckets
+    // return the buckets of the compute state.
+    virtual DeltaSteppingBuckets* getDeltaSteppingBuckets(GDSComputeState&) const {
+        return nullptr;
+    }
+    // Delta-stepping ignores the hop upper bound. Returns true if the shortest path it found to an
+    // output node has more than maxHops edges, in which case the search has to be repeated with
+    // bounded iterations.
+    virtual bool hasPathLongerThan(GDSComputeState&, uint64_t /*maxHops*/,
+        const common::NodeOffsetMaskMap* /*outputNodeMask*/) const {
+        return false;
+    }
+
+    // Algorithms tracking a single weighted shortest path per destination can find the path to a
+    // single bound destination with an A* search guided by landmarks.
+    virtual bool supportsAStarSearch() const { return false; }
+    // Records an edge of the path found by an A* search as the edge compute of the algorithm
+    // would. The frontier pair of the compute state has been updated by the caller.
+    virtual void addAStarSearchEdge(GDSComputeState&, common::nodeID_t, const AStarStep&) {}
+
+    // Algorithms reporting only the length of a shortest path to each destination can traverse
+    // from a batch of sources at once with a multi-source BFS.
+    virtual bool supportsMultiSourceSearch() const { return false; }
+    // Runs the multi-source BFS from the given sources and writes the reached destinations.
+    virtual void runMultiSourceSearch(processor::ExecutionContext*, const RJBindData&,
+        MultiSourceBFS&, const std::vector<common::nodeID_t>&,
+        processor::RecursiveExtendSharedState*) {}
+
     virtual std::unique_ptr<RJAlgorithm> copy() const = 0;
 };
 
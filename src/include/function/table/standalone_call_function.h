@@ -29,5 +29,11 @@ struct DropProjectedGraphFunction {
     static function_set getFunctionSet();
 };
 
+struct CreateWorkloadClassFunction {
+    static constexpr const char* name = "CREATE_WORKLOAD_CLASS";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
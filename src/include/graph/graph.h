@@ -94,6 +94,9 @@ public:
             return std::span(reinterpret_cast<const T*>(propertyVectors[propertyIndex]->getData()),
                 nodeIDs.size());
         }
+        bool isNull(size_t propertyIndex, size_t idx) const {
+            return propertyVectors[propertyIndex]->isNull(idx);
+        }
 
     private:
         KUZU_API Chunk(std::span<const common::nodeID_t> nodeIDs,
@@ -198,6 +201,16 @@ public:
     // Get all possible (srcTable, dstTable, relTable)s.
     virtual std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) = 0;
 
+    // Switches rel scans to a node numbering chosen by the graph for locality, e.g. by descending
+    // degree. Afterwards, offsets passed to and returned by rel scans are in that numbering, and
+    // getOriginalOffset maps them back. Vertex scans keep storage offsets. Returns false if the
+    // graph keeps storage offsets.
+    virtual bool useNodeOrder() { return false; }
+
+    virtual common::offset_t getOriginalOffset(common::table_id_t, common::offset_t offset) const {
+        return offset;
+    }
+
     // Prepares scan on the specified relationship table (works for backwards and forwards scans)
     virtual std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
         common::oid_t relTableID, common::table_id_t nbrTableID,
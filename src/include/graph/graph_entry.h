@@ -6,6 +6,7 @@
 
 namespace kuzu {
 namespace graph {
+class MaterializedGraphCache;
 
 struct NativeGraphEntryTableInfo {
     catalog::TableCatalogEntry* entry;
@@ -25,6 +26,8 @@ struct NativeGraphEntryTableInfo {
 struct KUZU_API NativeGraphEntry {
     std::vector<NativeGraphEntryTableInfo> nodeInfos;
     std::vector<NativeGraphEntryTableInfo> relInfos;
+    // Set if the graph is a projected graph created with materialization enabled.
+    std::shared_ptr<MaterializedGraphCache> materializedGraph;
 
     NativeGraphEntry() = default;
     NativeGraphEntry(std::vector<catalog::TableCatalogEntry*> nodeEntries,
@@ -36,6 +39,8 @@ struct KUZU_API NativeGraphEntry {
     std::vector<common::table_id_t> getNodeTableIDs() const;
     std::vector<catalog::TableCatalogEntry*> getRelEntries() const;
     std::vector<catalog::TableCatalogEntry*> getNodeEntries() const;
+    // IDs of all node tables and rel groups of the graph.
+    common::table_id_set_t getTableIDs() const;
 
     const NativeGraphEntryTableInfo& getRelInfo(common::table_id_t tableID) const;
 
@@ -43,7 +48,8 @@ struct KUZU_API NativeGraphEntry {
 
 private:
     NativeGraphEntry(const NativeGraphEntry& other)
-        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos} {}
+        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos},
+          materializedGraph{other.materializedGraph} {}
 };
 
 } // namespace graph
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/data_chunk/data_chunk.h"
+#include "common/enums/rel_direction.h"
+#include "common/mask.h"
+#include "common/types/types.h"
+#include "function/gds/gds_object_manager.h"
+#include "graph.h"
+#include "graph_entry.h"
+#include "on_disk_graph.h"
+#include "transaction/table_version_tracker.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+
+namespace graph {
+
+// Values of a fixed-size rel property, stored in the order of the neighbors of a CSRAdjList.
+struct CSRPropertyColumn {
+    std::string name;
+    common::LogicalType type;
+    uint32_t numBytesPerValue;
+    function::ObjectArray<uint8_t> values;
+    // 1 if the value at the position is null.
+    function::ObjectArray<uint8_t> nulls;
+    bool hasNull = false;
+
+    CSRPropertyColumn(std::string name, common::LogicalType type);
+};
+
+// Numbering of the nodes of one table by descending degree. The CSR is stored in this order, so
+// the high-degree nodes that most neighbor lists point at are close together.
+struct CSRNodeOrder {
+    function::ObjectArray<common::offset_t> newToOld;
+    function::ObjectArray<common::offset_t> oldToNew;
+
+    // Offsets the order does not cover keep their number.
+    common::offset_t getNewOffset(common::offset_t oldOffset) const {
+        return oldOffset < oldToNew.getSize() ? oldToNew.get(oldOffset) : oldOffset;
+    }
+    common::offset_t getOldOffset(common::offset_t newOffset) const {
+        return newOffset < newToOld.getSize() ? newToOld.get(newOffset) : newOffset;
+    }
+};
+
+// Adjacency of one rel table in one direction in compressed sparse row format. All arrays are
+// allocated through the memory manager, so a materialized graph counts towards the buffer pool.
+struct CSRAdjList {
+    // Neighbors of the bound node numbered i in the bound node order are stored in
+    // [csrOffsets[i], csrOffsets[i + 1]).
+    function::ObjectArray<common::offset_t> csrOffsets;
+    // Numbered in the neighbor node order. Padded with DEFAULT_VECTOR_CAPACITY entries, so that
+    // the neighbors starting at any position can be exposed as a full vector without copying.
+    function::ObjectArray<common::nodeID_t> nbrNodes;
+    std::vector<CSRPropertyColumn> properties;
+    common::offset_t numEdges = 0;
+    const CSRNodeOrder* boundOrder = nullptr;
+    const CSRNodeOrder* nbrOrder = nullptr;
+
+    common::offset_t getNumBoundNodes() const { return csrOffsets.getSize() - 1; }
+    common::idx_t getPropertyIdx(const std::string& name) const;
+};
+
+struct CSRRelTable {
+    // Indexed by RelDirectionUtils::relDirectionToKeyIdx. Null if the direction is not stored.
+    std::array<std::unique_ptr<CSRAdjList>, 2> adjLists;
+};
+
+// Immutable in-memory snapshot of the rels of a projected graph.
+struct CSRGraphData {
+    uint64_t schemaVersion = 0;
+    // Commit version of every node table and rel group of the graph at build time.
+    transaction::table_versions_t tableVersions;
+    common::table_id_map_t<CSRNodeOrder> nodeOrders;
+    std::unordered_map<common::oid_t, CSRRelTable> relTables;
+};
+
+// Holds the materialized CSR of a projected graph created with `materialize := true`. The CSR is
+// built by the first algorithm run over the graph and reused by later runs until a transaction
+// commits a write to one of the graph's tables.
+class MaterializedGraphCache {
+public:
+    // Returns nullptr if the transaction of the context might see a different version of the
+    // graph than the latest committed one, in which case the graph should be scanned from disk.
+    std::shared_ptr<const CSRGraphData> getOrBuild(main::ClientContext* context,
+        const NativeGraphEntry& entry);
+
+private:
+    std::mutex mtx;
+    std::shared_ptr<const CSRGraphData> data;
+};
+
+class MaterializedGraphNbrScanState final : public NbrScanState {
+public:
+    MaterializedGraphNbrScanState(main::ClientContext* context, const CSRRelTable& relTable,
+        const std::vector<std::string>& relProperties, common::SemiMask* nbrNodeMask,
+        bool useNodeOrder);
+
+    Chunk getChunk() override {
+        return createChunk(std::span(nbrNodes, common::DEFAULT_VECTOR_CAPACITY),
+            propertyVectors.state->getSelVectorUnsafe(), std::span(propertyVectors.valueVectors));
+    }
+    bool next() override;
+
+    void startScan(common::RelDataDirection direction, common::offset_t boundOffset);
+
+private:
+    const CSRRelTable& relTable;
+    common::SemiMask* nbrNodeMask;
+    bool useNodeOrder;
+    // Neighbors mapped back to storage offsets if the node order is not used.
+    std::vector<common::nodeID_t> nbrNodeBuffer;
+    // Column index of each scanned property in the adjacency lists of either direction.
+    std::array<std::vector<common::idx_t>, 2> propertyIdxs;
+    common::DataChunk propertyVectors;
+
+    const CSRAdjList* adjList = nullptr;
+    const std::vector<common::idx_t>* currentPropertyIdxs = nullptr;
+    const common::nodeID_t* nbrNodes = nullptr;
+    common::offset_t nextPos = 0;
+    common::offset_t endPos = 0;
+};
+
+// Graph backed by a materialized CSR. Scans that request rel properties that are not materialized,
+// and all vertex scans, are delegated to the on-disk graph. Rel scans map the CSR node order back
+// to storage offsets, unless the algorithm switches to the node order.
+class KUZU_API MaterializedGraph final : public Graph {
+public:
+    MaterializedGraph(main::ClientContext* context, NativeGraphEntry entry,
+        std::shared_ptr<const CSRGraphData> data);
+
+    NativeGraphEntry* getGraphEntry() override { return onDiskGraph.getGraphEntry(); }
+
+    void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) {
+        nodeOffsetMaskMap = maskMap;
+        onDiskGraph.setNodeOffsetMask(maskMap);
+    }
+
+    std::vector<common::table_id_t> getNodeTableIDs() const override {
+        return onDiskGraph.getNodeTableIDs();
+    }
+
+    common::table_id_map_t<common::offset_t> getMaxOffsetMap(
+        transaction::Transaction* transaction) const override {
+        return onDiskGraph.getMaxOffsetMap(transaction);
+    }
+
+    common::offset_t getMaxOffset(transaction::Transaction* transaction,
+        common::table_id_t id) const override {
+        return onDiskGraph.getMaxOffset(transaction, id);
+    }
+
+    common::offset_t getNumNodes(transaction::Transaction* transaction) const override {
+        return onDiskGraph.getNumNodes(transaction);
+    }
+
+    std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) override {
+        return onDiskGraph.getRelInfos(srcTableID);
+    }
+
+    bool useNodeOrder() override;
+    common::offset_t getOriginalOffset(common::table_id_t tableID,
+        common::offset_t offset) const override;
+
+    std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
+        common::oid_t relTableID, common::table_id_t nbrTableID,
+        std::vector<std::string> relProperties, bool randomLookup = true) override;
+
+    EdgeIterator scanFwd(common::nodeID_t nodeID, NbrScanState& state) override;
+    EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) override;
+
+    std::unique_ptr<VertexScanState> prepareVertexScan(catalog::TableCatalogEntry* tableEntry,
+        const std::vector<std::string>& propertiesToScan) override {
+        return onDiskGraph.prepareVertexScan(tableEntry, propertiesToScan);
+    }
+    VertexIterator scanVertices(common::offset_t beginOffset, common::offset_t endOffsetExclusive,
+        VertexScanState& state) override {
+        return onDiskGraph.scanVertices(beginOffset, endOffsetExclusive, state);
+    }
+
+private:
+    main::ClientContext* context;
+    OnDiskGraph onDiskGraph;
+    std::shared_ptr<const CSRGraphData> data;
+    common::NodeOffsetMaskMap* nodeOffsetMaskMap = nullptr;
+    bool nodeOrderUsed = false;
+};
+
+} // namespace graph
+} // namespace kuzu
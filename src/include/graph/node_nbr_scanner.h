@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/assert.h"
+#include "common/enums/extend_direction.h"
+#include "graph/graph.h"
+#include "graph/graph_entry.h"
+
+namespace kuzu {
+namespace graph {
+
+// Scans the neighbors of one node at a time over all the rels of a graph. Used by algorithms that
+// extend from a few given nodes instead of running frontier-based edge computes over all nodes.
+class NodeNbrScanner {
+    struct RelScan {
+        GraphRelInfo relInfo;
+        std::unique_ptr<NbrScanState> fwdScanState;
+        std::unique_ptr<NbrScanState> bwdScanState;
+    };
+
+public:
+    // Only scans in the given direction are prepared.
+    NodeNbrScanner(Graph* graph, common::ExtendDirection extendDirection,
+        const std::vector<std::string>& relProperties)
+        : graph{graph} {
+        for (auto& nodeInfo : graph->getGraphEntry()->nodeInfos) {
+            for (auto& relInfo : graph->getRelInfos(nodeInfo.entry->getTableID())) {
+                std::unique_ptr<NbrScanState> fwdScanState, bwdScanState;
+                if (extendDirection != common::ExtendDirection::BWD) {
+                    fwdScanState = graph->prepareRelScan(*relInfo.relGroupEntry,
+                        relInfo.relTableID, relInfo.dstTableID, relProperties);
+                }
+                if (extendDirection != common::ExtendDirection::FWD) {
+                    bwdScanState = graph->prepareRelScan(*relInfo.relGroupEntry,
+                        relInfo.relTableID, relInfo.srcTableID, relProperties);
+                }
+                relScans.push_back(
+                    RelScan{relInfo, std::move(fwdScanState), std::move(bwdScanState)});
+            }
+        }
+    }
+
+    // Calls func(chunk, isFwd) on every chunk of neighbors of the node in the given direction,
+    // where isFwd is whether the edges of the chunk are scanned along their direction.
+    template<typename Func>
+    void scanChunks(common::nodeID_t nodeID, common::ExtendDirection direction, Func func) {
+        for (auto& relScan : relScans) {
+            if (direction != common::ExtendDirection::BWD &&
+                relScan.relInfo.srcTableID == nodeID.tableID) {
+                KU_ASSERT(relScan.fwdScanState != nullptr);
+                for (auto chunk : graph->scanFwd(nodeID, *relScan.fwdScanState)) {
+                    func(chunk, true /* isFwd */);
+                }
+            }
+            if (direction != common::ExtendDirection::FWD &&
+                relScan.relInfo.dstTableID == nodeID.tableID) {
+                KU_ASSERT(relScan.bwdScanState != nullptr);
+                for (auto chunk : graph->scanBwd(nodeID, *relScan.bwdScanState)) {
+                    func(chunk, false /* isFwd */);
+                }
+            }
+        }
+    }
+
+    // Calls func(nbrNodeID) on every neighbor of the node in the given direction.
+    template<typename Func>
+    void scan(common::nodeID_t nodeID, common::ExtendDirection direction, Func func) {
+        scanChunks(nodeID, direction, [&](const NbrScanState::Chunk& chunk, bool) {
+            chunk.forEach([&](auto neighbors, auto, auto i) { func(neighbors[i]); });
+        });
+    }
+
+private:
+    Graph* graph;
+    std::vector<RelScan> relScans;
+};
+
+} // namespace graph
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,7 @@
 
 namespace kuzu {
 namespace graph {
+class MaterializedGraphCache;
 
 enum class GraphEntryType : uint8_t {
     NATIVE = 0,
@@ -41,6 +43,8 @@ struct ParsedNativeGraphTableInfo {
 struct KUZU_API ParsedNativeGraphEntry : ParsedGraphEntry {
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    // Shared by all algorithm runs over the graph. Null if the graph is not materialized.
+    std::shared_ptr<MaterializedGraphCache> materializedGraph;
 
     ParsedNativeGraphEntry(std::vector<ParsedNativeGraphTableInfo> nodeInfos,
         std::vector<ParsedNativeGraphTableInfo> relInfos)
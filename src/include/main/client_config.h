@@ -4,6 +4,7 @@
 #include <string>
 
 #include "common/enums/path_semantic.h"
+#include "common/task_system/workload_class.h"
 
 namespace kuzu {
 namespace main {
@@ -23,6 +24,10 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    static constexpr bool ENABLE_INTER_PIPELINE_PARALLELISM = true;
+    static constexpr bool ENABLE_ADAPTIVE_REOPTIMIZATION = false;
+    static constexpr bool ENABLE_PLAN_CACHE = true;
+    static constexpr uint64_t WEIGHTED_SHORTEST_PATH_LANDMARKS = 0;
 };
 
 struct ClientConfig {
@@ -57,6 +62,21 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // If independent pipelines of a query can be executed concurrently.
+    bool enableInterPipelineParallelism = ClientConfigDefault::ENABLE_INTER_PIPELINE_PARALLELISM;
+    // If a read-only query is re-planned when the cardinality of a pipeline breaker turns out to be
+    // far off its estimate.
+    bool enableAdaptiveReoptimization = ClientConfigDefault::ENABLE_ADAPTIVE_REOPTIMIZATION;
+    // If compiled plans are shared with the other connections of the database through its plan
+    // cache.
+    bool enablePlanCache = ClientConfigDefault::ENABLE_PLAN_CACHE;
+    // Number of landmarks used to guide an A* search for weighted shortest paths to a single bound
+    // destination. 0 disables the A* search.
+    uint64_t weightedShortestPathLandmarks = ClientConfigDefault::WEIGHTED_SHORTEST_PATH_LANDMARKS;
+    // Workload class the queries of the connection are admitted to.
+    std::string workloadClass = common::WorkloadClass::DEFAULT_CLASS_NAME;
+    // Thread limit of the workload class, cached so that it is not looked up for every task.
+    uint64_t workloadClassMaxNumThreads = 0;
 };
 
 } // namespace main
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 #include "common/arrow/arrow_result_config.h"
 #include "common/timer.h"
@@ -40,6 +41,7 @@ class StorageManager;
 
 namespace processor {
 class ImportDB;
+class StreamingResultCollectorSharedState;
 class WarningContext;
 } // namespace processor
 
@@ -148,12 +150,22 @@ public:
     void cleanUp();
 
     struct QueryConfig {
+        // 16 vectors of the default vector capacity.
+        static constexpr uint64_t DEFAULT_MAX_NUM_BUFFERED_TUPLES = 32768;
+
         QueryResultType resultType;
         common::ArrowResultConfig arrowConfig;
+        // Number of tuples a streaming result buffers before the query waits for the client.
+        uint64_t maxNumBufferedTuples;
 
-        QueryConfig() : resultType{QueryResultType::FTABLE}, arrowConfig{} {}
+        QueryConfig()
+            : resultType{QueryResultType::FTABLE}, arrowConfig{},
+              maxNumBufferedTuples{DEFAULT_MAX_NUM_BUFFERED_TUPLES} {}
         QueryConfig(QueryResultType resultType, common::ArrowResultConfig arrowConfig)
-            : resultType{resultType}, arrowConfig{arrowConfig} {}
+            : resultType{resultType}, arrowConfig{arrowConfig},
+              maxNumBufferedTuples{DEFAULT_MAX_NUM_BUFFERED_TUPLES} {}
+        QueryConfig(QueryResultType resultType, uint64_t maxNumBufferedTuples)
+            : resultType{resultType}, arrowConfig{}, maxNumBufferedTuples{maxNumBufferedTuples} {}
     };
 
     std::unique_ptr<QueryResult> query(std::string_view queryStatement,
@@ -199,6 +211,31 @@ private:
         bool shouldCommitNewTransaction,
         std::unordered_map<std::string, std::shared_ptr<common::Value>> inputParams = {});
 
+    // Whether statements of the connection only depend on state that the catalog version and the
+    // table versions of the database track, so that they can share the database-wide caches.
+    bool canUseDatabaseCaches() const;
+    // Whether statements of the connection can be served from and added to the plan cache of the
+    // database.
+    bool canUsePlanCache() const;
+    std::string getPlanCacheKey(const std::string& normalizedQuery,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& params) const;
+    std::optional<PrepareResult> prepareFromPlanCacheNoLock(const std::string& planCacheKey,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& params);
+    void addToPlanCacheNoLock(const std::string& planCacheKey, uint64_t schemaVersion,
+        const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement) const;
+    bool canUseResultCache() const;
+    std::string getResultCacheKey(const std::string& normalizedQuery,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& params) const;
+    std::unique_ptr<QueryResult> queryFromResultCacheNoLock(const std::string& resultCacheKey,
+        uint64_t schemaVersion) const;
+    // Executes the statement and caches its result if the result only depends on the tables it
+    // reads. An empty key disables caching.
+    std::unique_ptr<QueryResult> executeWithResultCacheNoLock(const std::string& resultCacheKey,
+        uint64_t schemaVersion, PreparedStatement* preparedStatement,
+        CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
+        QueryConfig queryConfig = {});
+
     template<typename T, typename... Args>
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> params,
@@ -216,6 +253,19 @@ private:
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
 
     bool canExecuteWriteQuery() const;
+    // Whether the query can be aborted and re-planned if a cardinality estimate turns out to be
+    // badly wrong during its execution.
+    bool canReoptimize(const PreparedStatement& preparedStatement) const;
+
+    bool canStreamResult(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement) const;
+    // Maps the plan in the calling thread and executes it in a background thread that pushes the
+    // result tuples to the returned StreamingQueryResult.
+    std::unique_ptr<QueryResult> startStreamingQueryNoLock(
+        const PreparedStatement& preparedStatement, const CachedPreparedStatement& cachedStatement,
+        uint64_t queryID, const QueryConfig& queryConfig);
+    // Cancels the query whose result is being streamed, if any, and waits for it to finish.
+    void finishStreamingQueryNoLock();
 
     std::unique_ptr<QueryResult> handleFailedExecution(std::optional<uint64_t> queryID,
         const std::exception& e) const;
@@ -245,6 +295,13 @@ private:
     std::unique_ptr<processor::WarningContext> warningContext;
     // Graph entries
     std::unique_ptr<graph::GraphEntrySet> graphEntrySet;
+    // Thread executing the query whose result is being streamed, and the queue it pushes to.
+    std::thread streamingQueryThread;
+    std::shared_ptr<processor::StreamingResultCollectorSharedState> streamingResultState;
+    // Actual cardinalities observed by aborted executions of the current query, keyed by node.
+    std::unordered_map<std::string, common::cardinality_t> cardinalityFeedback;
+    // Number of times the current query was re-planned.
+    uint64_t numReoptimizations = 0;
     // Whether the query can access internal tables/sequences or not.
     bool useInternalCatalogEntry_ = false;
     // Whether the transaction should be rolled back on destruction. If the parent database is
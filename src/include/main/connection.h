@@ -49,6 +49,22 @@ public:
 
     KUZU_API std::unique_ptr<QueryResult> queryAsArrow(std::string_view query, int64_t chunkSize);
 
+    /**
+     * @brief Executes the given query and streams its result: tuples can be read while the query is
+     * still executing, and the query pauses while maxNumBufferedTuples tuples are waiting to be
+     * read. Only read-only single statement queries are streamed, other queries return a
+     * materialized result. Executing another statement on this connection closes the stream.
+     * Tuples of a streamed result can only be read once, and getNumTuples() buffers all remaining
+     * tuples.
+     * @param query The query to execute.
+     * @param maxNumBufferedTuples The number of tuples buffered before the query waits for the
+     * client.
+     * @return the result of the query.
+     */
+    KUZU_API std::unique_ptr<QueryResult> queryAsStream(std::string_view query,
+        uint64_t maxNumBufferedTuples =
+            ClientContext::QueryConfig::DEFAULT_MAX_NUM_BUFFERED_TUPLES);
+
     /**
      * @brief Prepares the given query and returns the prepared statement.
      * @param query The query to prepare.
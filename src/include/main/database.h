@@ -30,8 +30,18 @@ namespace storage {
 class StorageExtension;
 } // namespace storage
 
+namespace function {
+class LandmarkCache;
+} // namespace function
+
+namespace transaction {
+class TableVersionTracker;
+} // namespace transaction
+
 namespace main {
 class DatabaseManager;
+class PlanCache;
+class QueryResultCache;
 /**
  * @brief Stores runtime configuration for creating or opening a Database
  */
@@ -161,6 +171,16 @@ public:
 
     common::VirtualFileSystem* getVFS() { return vfs.get(); }
 
+    PlanCache* getPlanCache() { return planCache.get(); }
+
+    QueryResultCache* getQueryResultCache() { return queryResultCache.get(); }
+
+    function::LandmarkCache* getLandmarkCache() { return landmarkCache.get(); }
+
+    transaction::TableVersionTracker* getTableVersionTracker() {
+        return tableVersionTracker.get();
+    }
+
 private:
     using construct_bm_func_t =
         std::function<std::unique_ptr<storage::BufferManager>(const Database&)>;
@@ -189,6 +209,7 @@ private:
     std::unique_ptr<catalog::Catalog> catalog;
     std::unique_ptr<storage::StorageManager> storageManager;
     std::unique_ptr<transaction::TransactionManager> transactionManager;
+    std::unique_ptr<transaction::TableVersionTracker> tableVersionTracker;
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<DatabaseManager> databaseManager;
     std::unique_ptr<extension::ExtensionManager> extensionManager;
@@ -198,6 +219,11 @@ private:
     std::vector<std::unique_ptr<extension::BinderExtension>> binderExtensions;
     std::vector<std::unique_ptr<extension::PlannerExtension>> plannerExtensions;
     std::vector<std::unique_ptr<extension::MapperExtension>> mapperExtensions;
+    // Declared last so that cached plans and results are released before the state they
+    // reference.
+    std::unique_ptr<PlanCache> planCache;
+    std::unique_ptr<QueryResultCache> queryResultCache;
+    std::unique_ptr<function::LandmarkCache> landmarkCache;
 };
 
 } // namespace main
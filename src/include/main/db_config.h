@@ -66,6 +66,8 @@ struct DBConfig {
     bool throwOnWalReplayFailure;
     bool enableChecksums;
     bool enableSpillingToDisk;
+    // Memory budget in bytes for cached query results. Zero disables the result cache.
+    uint64_t resultCacheSize;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/enums/statement_type.h"
+#include "common/types/value/value.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace parser {
+class Statement;
+}
+namespace binder {
+class Expression;
+}
+
+namespace main {
+
+// Compiled form of a query shared by all connections of a database. The logical plan is read-only
+// once cached; each execution maps it to its own physical plan.
+struct PlanCacheEntry {
+    // Schema version of the catalog the plan was compiled against.
+    uint64_t schemaVersion = 0;
+    std::shared_ptr<parser::Statement> parsedStatement;
+    planner::LogicalPlan logicalPlan;
+    std::vector<std::shared_ptr<binder::Expression>> columns;
+    bool readOnly = true;
+    bool deterministic = false;
+    // Whether the plan depends on the parameter values it was compiled with, which are kept in
+    // parameterValues.
+    bool parameterValuesUsed = false;
+    std::unordered_map<std::string, std::shared_ptr<common::Value>> parameterValues;
+    common::StatementType statementType = common::StatementType::QUERY;
+};
+
+// Database-wide LRU cache of compiled read-only query plans, keyed by normalized query text,
+// parameter types and the client settings that affect planning. Plans keep parameters as
+// expressions that take the values of each execution, so one plan serves all values of the same
+// types. Plans that read parameter values while compiling, e.g. to fold a LIMIT count, are only
+// reused for the values they were compiled with. Entries compiled against an older schema version
+// of the catalog are dropped on lookup.
+class PlanCache {
+public:
+    static constexpr uint64_t MAX_NUM_ENTRIES = 1024;
+
+    // Collapses whitespace outside of literals and strips trailing semicolons so that queries
+    // differing only in formatting share an entry.
+    static std::string normalizeQuery(std::string_view query);
+    static std::string getKey(const std::string& normalizedQuery,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters,
+        const std::string& settings);
+
+    std::shared_ptr<const PlanCacheEntry> lookup(const std::string& key, uint64_t schemaVersion,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters);
+    void insert(const std::string& key, std::shared_ptr<const PlanCacheEntry> entry);
+    void clear();
+
+    uint64_t getNumEntries();
+    uint64_t getNumHits();
+
+private:
+    using lru_list_t = std::list<std::string>;
+    struct Slot {
+        std::shared_ptr<const PlanCacheEntry> entry;
+        lru_list_t::iterator lruIt;
+    };
+
+    void eraseNoLock(const std::string& key);
+
+private:
+    std::mutex mtx;
+    // Most recently used keys first.
+    lru_list_t lruList;
+    std::unordered_map<std::string, Slot> slots;
+    uint64_t numHits = 0;
+};
+
+} // namespace main
+} // namespace kuzu
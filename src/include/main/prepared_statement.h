@@ -31,6 +31,14 @@ struct CachedPreparedStatement {
     std::shared_ptr<parser::Statement> parsedStatement;
     std::unique_ptr<planner::LogicalPlan> logicalPlan;
     std::vector<std::shared_ptr<binder::Expression>> columns;
+    // Whether re-running the statement over unchanged data gives the same result.
+    bool deterministic = false;
+    // Whether compiling the statement read the values of its parameters, e.g. to fold a LIMIT
+    // count. Such a plan is only valid for the values it was compiled with.
+    bool parameterValuesUsed = false;
+    // Normalized text of the query the statement was prepared from. Empty if the statement cannot
+    // be looked up in the plan cache.
+    std::string normalizedQuery;
 
     CachedPreparedStatement();
     ~CachedPreparedStatement();
@@ -17,6 +17,7 @@ namespace main {
 enum class QueryResultType {
     FTABLE = 0,
     ARROW = 1,
+    STREAMING = 2,
 };
 
 /**
@@ -71,7 +72,8 @@ public:
      */
     KUZU_API QueryResult* getNextQueryResult();
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streaming result, waits until the query has
+     * produced all of its tuples.
      */
     KUZU_API virtual uint64_t getNumTuples() const = 0;
     /**
@@ -87,6 +89,8 @@ public:
     KUZU_API virtual std::shared_ptr<processor::FlatTuple> getNext() = 0;
     /**
      * @brief Resets the result tuple iterator.
+     * @throws RuntimeException if the result is a streaming result, whose tuples can only be read
+     * once.
      */
     KUZU_API virtual void resetIterator() = 0;
     /**
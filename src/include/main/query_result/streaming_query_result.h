@@ -0,0 +1,67 @@
+#pragma once
+
+#include <deque>
+
+#include "main/query_result.h"
+
+namespace kuzu {
+namespace processor {
+class FactorizedTable;
+class FactorizedTableIterator;
+class StreamingResultCollectorSharedState;
+} // namespace processor
+
+namespace main {
+
+/**
+ * @brief StreamingQueryResult returns the tuples of a query while the query is still executing.
+ * Tuples can only be iterated once, so resetIterator() is not supported. Destroying the result, or
+ * executing another statement on the same connection, cancels the query if it is still running.
+ */
+class StreamingQueryResult : public QueryResult {
+    static constexpr QueryResultType type_ = QueryResultType::STREAMING;
+
+public:
+    explicit StreamingQueryResult(
+        std::shared_ptr<processor::StreamingResultCollectorSharedState> sharedState);
+    ~StreamingQueryResult() override;
+
+    // Waits for the query to finish and buffers the tuples that have not been read yet, so it
+    // gives up the bounded memory usage of streaming.
+    uint64_t getNumTuples() const override;
+
+    bool hasNext() const override;
+
+    std::shared_ptr<processor::FlatTuple> getNext() override;
+
+    // Throws a RuntimeException, since tuples that have been read are not kept.
+    void resetIterator() override;
+
+    // Consumes all remaining tuples.
+    std::string toString() const override;
+
+    bool hasNextArrowChunk() override;
+
+    std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
+
+private:
+    // Returns the next table of tuples, or nullptr once all tables have been consumed.
+    std::shared_ptr<processor::FactorizedTable> nextTable() const;
+
+private:
+    std::shared_ptr<processor::StreamingResultCollectorSharedState> sharedState;
+    // Table currently being consumed. Fetching the next table from the queue does not change the
+    // logical state of the result, so hasNext() can stay const.
+    mutable std::shared_ptr<processor::FactorizedTable> table;
+    mutable std::unique_ptr<processor::FactorizedTableIterator> iterator;
+    mutable bool exhausted = false;
+    // Tables popped from the queue by getNumTuples() that have not been consumed yet.
+    mutable std::deque<std::shared_ptr<processor::FactorizedTable>> drainedTables;
+    // Whether the queue has returned all tables of the query.
+    mutable bool drained = false;
+    // Number of tuples in the tables popped from the queue so far.
+    mutable uint64_t numTuples = 0;
+};
+
+} // namespace main
+} // namespace kuzu
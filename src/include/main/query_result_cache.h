@@ -0,0 +1,71 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+#include "transaction/table_version_tracker.h"
+
+namespace kuzu {
+namespace processor {
+class FactorizedTable;
+}
+
+namespace main {
+
+struct QueryResultCacheEntry {
+    std::shared_ptr<processor::FactorizedTable> table;
+    std::vector<std::string> columnNames;
+    std::vector<common::LogicalType> columnTypes;
+    uint64_t schemaVersion = 0;
+    // Versions of the tables the result was computed from.
+    transaction::table_versions_t tableVersions;
+    uint64_t memoryUsage = 0;
+    uint64_t numHits = 0;
+};
+
+// Database-wide LRU cache of materialized results of read-only queries. A result is only served
+// while the versions of all tables it read are unchanged. The total size of cached results is
+// bounded by a memory budget.
+class QueryResultCache {
+public:
+    explicit QueryResultCache(transaction::TableVersionTracker& tableVersionTracker)
+        : tableVersionTracker{tableVersionTracker} {}
+
+    std::shared_ptr<const QueryResultCacheEntry> lookup(const std::string& key,
+        uint64_t schemaVersion);
+    // Entries whose table versions are already outdated, or that do not fit into the budget, are
+    // not inserted.
+    void insert(const std::string& key, std::shared_ptr<const QueryResultCacheEntry> entry,
+        uint64_t memoryBudget);
+    void clear();
+
+    uint64_t getNumEntries();
+    uint64_t getMemoryUsage();
+    uint64_t getNumHits();
+
+private:
+    using lru_list_t = std::list<std::string>;
+    struct Slot {
+        std::shared_ptr<const QueryResultCacheEntry> entry;
+        lru_list_t::iterator lruIt;
+    };
+
+    void eraseNoLock(const std::string& key);
+
+private:
+    transaction::TableVersionTracker& tableVersionTracker;
+    std::mutex mtx;
+    // Most recently used keys first.
+    lru_list_t lruList;
+    std::unordered_map<std::string, Slot> slots;
+    uint64_t memoryUsage = 0;
+    uint64_t numHits = 0;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -43,6 +43,14 @@ public:
 
     void incrementExecutionTime(double increment);
 
+    /**
+     * @return the number of times the query was re-planned during execution because a hash join
+     * build side was far off its estimate (see enable_adaptive_reoptimization).
+     */
+    KUZU_API uint64_t getNumReoptimizations() const;
+
+    void incrementNumReoptimizations();
+
     /**
      * @return true if the query is executed with EXPLAIN.
      */
@@ -55,6 +63,7 @@ public:
 
 private:
     double executionTime = 0;
+    uint64_t numReoptimizations = 0;
     PreparedSummary preparedSummary;
 };
 
@@ -47,6 +47,13 @@ struct SparseFrontierThresholdSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct WeightedShortestPathLandmarksSetting {
+    static constexpr auto name = "weighted_shortest_path_landmarks";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct EnableSemiMaskSetting {
     static constexpr auto name = "enable_semi_mask";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -145,5 +152,40 @@ struct EnableInternalCatalogSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct EnableInterPipelineParallelismSetting {
+    static constexpr auto name = "enable_inter_pipeline_parallelism";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct EnableAdaptiveReoptimizationSetting {
+    static constexpr auto name = "enable_adaptive_reoptimization";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct EnablePlanCacheSetting {
+    static constexpr auto name = "enable_plan_cache";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ResultCacheSizeSetting {
+    static constexpr auto name = "result_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct WorkloadClassSetting {
+    static constexpr auto name = "workload_class";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 } // namespace main
 } // namespace kuzu
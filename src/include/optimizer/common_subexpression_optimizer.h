@@ -0,0 +1,36 @@
+#pragma once
+
+#include "binder/expression/expression.h"
+#include "logical_operator_visitor.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// Evaluates function expressions that repeat within a projection or a filter, or that are shared
+// by a projection and the filter directly below it, only once. Such expressions are computed by a
+// projection appended below and referenced by the operators above.
+class CommonSubexpressionOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitProjectionReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+
+    // Evaluates the expressions repeating in the predicate of a filter that is not followed by a
+    // projection.
+    std::shared_ptr<planner::LogicalOperator> rewriteFilter(
+        std::shared_ptr<planner::LogicalOperator> op);
+    // Appends projections evaluating the given expressions between op and its first child. An
+    // expression containing another one is evaluated by a later projection so that it can reference
+    // the result of the earlier one.
+    static void preAppendProjections(planner::LogicalOperator* op,
+        binder::expression_vector expressions);
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -9,27 +9,24 @@ class ClientContext;
 namespace optimizer {
 
 struct PredicateSet {
-    binder::expression_vector equalityPredicates;
-    binder::expression_vector nonEqualityPredicates;
+    // Predicates in their planned evaluation order.
+    binder::expression_vector predicates;
 
     PredicateSet() = default;
     EXPLICIT_COPY_DEFAULT_MOVE(PredicateSet);
 
-    bool isEmpty() const { return equalityPredicates.empty() && nonEqualityPredicates.empty(); }
-    void clear() {
-        equalityPredicates.clear();
-        nonEqualityPredicates.clear();
-    }
+    bool isEmpty() const { return predicates.empty(); }
+    void clear() { predicates.clear(); }
 
     void addPredicate(std::shared_ptr<binder::Expression> predicate);
+    // Adds the predicate of a filter planned below all collected predicates.
+    void addPredicateBefore(std::shared_ptr<binder::Expression> predicate);
     std::shared_ptr<binder::Expression> popNodePKEqualityComparison(
         const binder::Expression& nodeID);
     binder::expression_vector getAllPredicates();
 
 private:
-    PredicateSet(const PredicateSet& other)
-        : equalityPredicates{other.equalityPredicates},
-          nonEqualityPredicates{other.nonEqualityPredicates} {}
+    PredicateSet(const PredicateSet& other) : predicates{other.predicates} {}
 };
 
 class FilterPushDownOptimizer {
@@ -67,7 +64,8 @@ private:
         const std::shared_ptr<planner::LogicalOperator>& op);
 
     // Finish the current push down optimization by apply remaining predicates as a single filter.
-    // And heuristically reorder equality predicates first in the filter.
+    // And heuristically reorder equality predicates first in the filter if no predicate can raise
+    // an error.
     std::shared_ptr<planner::LogicalOperator> finishPushDown(
         std::shared_ptr<planner::LogicalOperator> op);
     std::shared_ptr<planner::LogicalOperator> appendFilters(
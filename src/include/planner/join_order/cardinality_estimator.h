@@ -17,6 +17,15 @@ namespace planner {
 
 class LogicalAggregate;
 
+// Degrees of the bound nodes of the rels extended from a node, derived from the degree stats of
+// the rel tables and scaled to their current number of rels.
+struct ExtensionDegrees {
+    // Average number of rels of a bound node that has rels.
+    double avgDegree = 0;
+    // Expected number of rels of a bound node reached through a rel.
+    double excessDegree = 0;
+};
+
 class CardinalityEstimator {
 public:
     explicit CardinalityEstimator(main::ClientContext* context) : context{context} {}
@@ -26,6 +35,12 @@ public:
     KUZU_API void init(const binder::NodeExpression& node);
 
     void rectifyCardinality(const binder::Expression& nodeID, cardinality_t card);
+    // Actual cardinalities of filtered node scans observed by a previous execution of the query,
+    // keyed by the unique name of the node. They replace the domain of the node and the estimated
+    // selectivity of the predicates on it.
+    void setCardinalityFeedback(std::unordered_map<std::string, cardinality_t> feedback) {
+        cardinalityFeedback = std::move(feedback);
+    }
 
     cardinality_t estimateScanNode(const LogicalOperator& op) const;
     cardinality_t estimateHashJoin(const std::vector<binder::expression_pair>& joinConditions,
@@ -50,13 +65,16 @@ private:
         const std::vector<common::table_id_t>& tableIDs) const;
     cardinality_t getNumRels(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
+    std::optional<ExtensionDegrees> getExtensionDegrees(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode,
+        const transaction::Transaction* transaction) const;
 
 private:
     main::ClientContext* context;
-    // TODO(Guodong): Extend this to cover rel tables.
     std::unordered_map<common::table_id_t, storage::TableStats> nodeTableStats;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
     std::unordered_map<std::string, cardinality_t> nodeIDName2dom;
+    std::unordered_map<std::string, cardinality_t> cardinalityFeedback;
 };
 
 } // namespace planner
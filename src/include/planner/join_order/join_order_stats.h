@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace planner {
+
+// Summary of the join order enumeration of a statement, reported by EXPLAIN.
+struct JoinOrderStats {
+    // Number of query graphs planned with dynamic programming over connected subgraphs.
+    uint64_t numQueryGraphsPlannedWithDP = 0;
+    // Number of query graphs too large for dynamic programming, planned greedily.
+    uint64_t numQueryGraphsPlannedGreedily = 0;
+    // Number of candidate joins between two connected subgraphs that were planned.
+    uint64_t numJoinsEnumerated = 0;
+    double enumerationTimeMS = 0;
+
+    std::string toString() const;
+};
+
+} // namespace planner
+} // namespace kuzu
@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "common/enums/explain_type.h"
+#include "planner/join_order/join_order_stats.h"
 #include "planner/operator/logical_operator.h"
 
 namespace kuzu {
@@ -13,9 +14,9 @@ class LogicalExplain final : public LogicalOperator {
 
 public:
     LogicalExplain(std::shared_ptr<LogicalOperator> child, common::ExplainType explainType,
-        binder::expression_vector innerResultColumns)
+        binder::expression_vector innerResultColumns, JoinOrderStats joinOrderStats = {})
         : LogicalOperator{type_, std::move(child)}, explainType{explainType},
-          innerResultColumns{std::move(innerResultColumns)} {}
+          innerResultColumns{std::move(innerResultColumns)}, joinOrderStats{joinOrderStats} {}
 
     void computeSchema();
     void computeFactorizedSchema() override;
@@ -27,13 +28,17 @@ public:
 
     binder::expression_vector getInnerResultColumns() const { return innerResultColumns; }
 
+    const JoinOrderStats& getJoinOrderStats() const { return joinOrderStats; }
+
     std::unique_ptr<LogicalOperator> copy() override {
-        return std::make_unique<LogicalExplain>(children[0], explainType, innerResultColumns);
+        return std::make_unique<LogicalExplain>(children[0], explainType, innerResultColumns,
+            joinOrderStats);
     }
 
 private:
     common::ExplainType explainType;
     binder::expression_vector innerResultColumns;
+    JoinOrderStats joinOrderStats;
 };
 
 } // namespace planner
@@ -6,6 +6,7 @@
 #include "common/enums/extend_direction.h"
 #include "common/enums/join_type.h"
 #include "planner/join_order/cardinality_estimator.h"
+#include "planner/join_order/join_order_stats.h"
 #include "planner/join_order_enumerator_context.h"
 #include "planner/operator/logical_plan.h"
 #include "planner/operator/sip/semi_mask_target_type.h"
@@ -172,6 +173,10 @@ public:
     void planLevel(uint32_t level);
     void planLevelExactly(uint32_t level);
     void planLevelApproximately(uint32_t level);
+    // Plan query graphs too large for dp
+    bool planGreedily();
+    void planJoin(const binder::SubqueryGraph& subgraph,
+        const binder::SubqueryGraph& otherSubgraph);
 
     // Plan worst case optimal join
     void planWCOJoin(uint32_t leftLevel, uint32_t rightLevel);
@@ -314,6 +319,7 @@ public:
 
     const CardinalityEstimator& getCardinalityEstimator() const { return cardinalityEstimator; }
     CardinalityEstimator& getCardinliatyEstimatorUnsafe() { return cardinalityEstimator; }
+    const JoinOrderStats& getJoinOrderStats() const { return joinOrderStats; }
 
     // Get operators
     static std::shared_ptr<LogicalOperator> getTableFunctionCall(
@@ -345,6 +351,7 @@ private:
     PropertyExprCollection propertyExprCollection;
     CardinalityEstimator cardinalityEstimator;
     JoinOrderEnumeratorContext context;
+    JoinOrderStats joinOrderStats;
     std::vector<extension::PlannerExtension*> plannerExtensions;
 };
 
@@ -9,6 +9,9 @@ namespace kuzu {
 namespace planner {
 
 const uint64_t MAX_LEVEL_TO_PLAN_EXACTLY = 7;
+// Query graphs with more variables (nodes and rels) than this are planned greedily instead of with
+// dynamic programming.
+const uint64_t MAX_NUM_VARIABLES_TO_PLAN_WITH_DP = 20;
 
 // Different from vanilla dp algorithm where one optimal plan is kept per subgraph, we keep multiple
 // plans each with a different factorization structure. The following example will explain our
@@ -61,7 +64,9 @@ public:
 
     std::vector<binder::SubqueryGraph> getSubqueryGraphs();
 
-    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
+    // If limitNumSubgraphs is set, plans of new subgraphs are dropped once the level is full.
+    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan,
+        bool limitNumSubgraphs);
 
     void clear() { subgraph2Plans.clear(); }
 
@@ -87,6 +92,10 @@ public:
 
     void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
 
+    // Dynamic programming keeps a bounded number of subgraphs per level. Greedy enumeration only
+    // keeps the subgraphs it tries, so it lifts the bound to never lose the join it picks.
+    void setLimitNumSubgraphs(bool limit) { limitNumSubgraphs = limit; }
+
     void clear();
 
 private:
@@ -99,6 +108,7 @@ private:
 
 private:
     std::vector<DPLevel> dpLevels;
+    bool limitNumSubgraphs = true;
 };
 
 } // namespace planner
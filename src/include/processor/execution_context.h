@@ -1,21 +1,36 @@
 #pragma once
 
 #include "common/profiler.h"
+#include "common/task_system/workload_class.h"
+#include "common/types/value/value.h"
 
 namespace kuzu {
 namespace main {
 class ClientContext;
 }
+namespace storage {
+class QueryMemoryTracker;
+}
 namespace processor {
 
 struct KUZU_API ExecutionContext {
     uint64_t queryID;
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // Priority of the workload class the query is admitted to.
+    common::WorkloadPriority priority;
+    // Tracks the intermediate memory of the query if its workload class limits it.
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker;
+    // If the query can be aborted and re-planned when a cardinality estimate turns out to be wrong.
+    bool enableReoptimization;
+    // Parameter values of the execution. Cached plans keep the values they were compiled with.
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterValues;
 
     ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext,
         uint64_t queryID)
-        : queryID{queryID}, profiler{profiler}, clientContext{clientContext} {}
+        : queryID{queryID}, profiler{profiler}, clientContext{clientContext},
+          priority{common::WorkloadPriority::NORMAL}, memoryTracker{nullptr},
+          enableReoptimization{false}, parameterValues{nullptr} {}
 };
 
 } // namespace processor
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "binder/expression/expression.h"
+#include "common/types/value/value.h"
 #include "expression_evaluator/expression_evaluator.h"
 #include "processor/result/result_set_descriptor.h"
 
@@ -13,6 +14,11 @@ public:
     explicit ExpressionMapper(const planner::Schema* schema) : schema{schema} {}
     ExpressionMapper(const planner::Schema* schema, evaluator::ExpressionEvaluator* parent)
         : schema{schema}, parentEvaluator{parent} {}
+    // Parameters are evaluated to the values of the execution rather than the values they were
+    // bound with, so that a cached plan can be executed with new values.
+    ExpressionMapper(const planner::Schema* schema,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterValues)
+        : schema{schema}, parameterValues{parameterValues} {}
 
     std::unique_ptr<evaluator::ExpressionEvaluator> getEvaluator(
         std::shared_ptr<binder::Expression> expression);
@@ -23,8 +29,8 @@ private:
     static std::unique_ptr<evaluator::ExpressionEvaluator> getLiteralEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
-    static std::unique_ptr<evaluator::ExpressionEvaluator> getParameterEvaluator(
-        std::shared_ptr<binder::Expression> expression);
+    std::unique_ptr<evaluator::ExpressionEvaluator> getParameterEvaluator(
+        std::shared_ptr<binder::Expression> expression) const;
 
     std::unique_ptr<evaluator::ExpressionEvaluator> getReferenceEvaluator(
         std::shared_ptr<binder::Expression> expression) const;
@@ -54,6 +60,8 @@ private:
     const planner::Schema* schema = nullptr;
     // TODO: comment
     evaluator::ExpressionEvaluator* parentEvaluator = nullptr;
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterValues =
+        nullptr;
 };
 
 } // namespace processor
@@ -76,6 +76,7 @@ private:
 
     void iterateResultSet(common::ArrowRowBatch* inputBatch);
     bool fillRowBatch(common::ArrowRowBatch& rowBatch);
+    void fillRowBatchColumnar(std::unique_ptr<common::ArrowRowBatch>& rowBatch);
 
 private:
     std::shared_ptr<ArrowResultCollectorSharedState> sharedState;
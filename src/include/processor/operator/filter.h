@@ -1,5 +1,6 @@
 #pragma once
 
+#include "binder/expression/expression.h"
 #include "expression_evaluator/expression_evaluator.h"
 #include "processor/operator/filtering_operator.h"
 #include "processor/operator/physical_operator.h"
@@ -8,10 +9,10 @@ namespace kuzu {
 namespace processor {
 
 struct FilterPrintInfo final : OPPrintInfo {
-    std::shared_ptr<binder::Expression> expression;
+    binder::expression_vector expressions;
 
-    explicit FilterPrintInfo(std::shared_ptr<binder::Expression> expression)
-        : expression{std::move(expression)} {}
+    explicit FilterPrintInfo(binder::expression_vector expressions)
+        : expressions{std::move(expressions)} {}
 
     std::string toString() const override;
 
@@ -21,33 +22,81 @@ struct FilterPrintInfo final : OPPrintInfo {
 
 private:
     FilterPrintInfo(const FilterPrintInfo& other)
-        : OPPrintInfo{other}, expression{other.expression} {}
+        : OPPrintInfo{other}, expressions{other.expressions} {}
 };
 
+// Selectivity and evaluation cost of a conjunct, sampled during execution.
+struct FilterConjunctStats {
+    uint64_t numInputTuples = 0;
+    uint64_t numOutputTuples = 0;
+    uint64_t numNanoseconds = 0;
+
+    void update(uint64_t numInput, uint64_t numOutput, uint64_t nanoseconds) {
+        numInputTuples += numInput;
+        numOutputTuples += numOutput;
+        numNanoseconds += nanoseconds;
+    }
+    // Conjuncts with a lower rank, i.e. a lower cost per eliminated tuple, are evaluated first.
+    double getRank() const;
+    // Halves all statistics so that recent samples weigh more.
+    void decay();
+};
+
+// Evaluates the conjuncts of consecutive filters that select on the same data chunk. Each thread
+// periodically samples the selectivity and cost of every conjunct and reorders them so that cheap
+// and selective conjuncts shrink the selection vector before expensive ones are evaluated.
+// Conjuncts are only reordered if none of them can raise an error. Otherwise, a conjunct could be
+// moved in front of the one guarding it, e.g. 10 / x > 1 in front of x <> 0, and they are
+// evaluated in their planned order. PROFILE reports the number of tuples each conjunct was
+// evaluated on, in planned order.
 class Filter final : public PhysicalOperator, public SelVectorOverWriter {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::FILTER;
+    // Every SAMPLING_INTERVAL-th input chunk is sampled, starting with the first one. Conjuncts are
+    // reordered after the first sample, so that short scans benefit as well, and then every
+    // REORDER_INTERVAL samples.
+    static constexpr uint64_t SAMPLING_INTERVAL = 16;
+    static constexpr uint64_t REORDER_INTERVAL = 32;
 
 public:
-    Filter(std::unique_ptr<evaluator::ExpressionEvaluator> expressionEvaluator,
+    Filter(evaluator::evaluator_vector_t expressionEvaluators, bool canReorder,
         uint32_t dataChunkToSelectPos, std::unique_ptr<PhysicalOperator> child, uint32_t id,
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
-          expressionEvaluator{std::move(expressionEvaluator)},
-          dataChunkToSelectPos(dataChunkToSelectPos) {}
+          expressionEvaluators{std::move(expressionEvaluators)}, canReorder{canReorder},
+          dataChunkToSelectPos(dataChunkToSelectPos), numInputChunks{0}, numSamples{0} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return make_unique<Filter>(expressionEvaluator->copy(), dataChunkToSelectPos,
-            children[0]->copy(), id, printInfo->copy());
+        return make_unique<Filter>(copyVector(expressionEvaluators), canReorder,
+            dataChunkToSelectPos, children[0]->copy(), id, printInfo->copy());
     }
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
+private:
+    std::string getConjunctInputsMetricKey(uint32_t conjunctIdx) const {
+        return "conjunctInputs-" + std::to_string(id) + "-" + std::to_string(conjunctIdx);
+    }
+
+    bool select();
+    bool selectAndSample();
+    void reorderConjuncts();
+
 private:
-    std::unique_ptr<evaluator::ExpressionEvaluator> expressionEvaluator;
+    evaluator::evaluator_vector_t expressionEvaluators;
+    bool canReorder;
     uint32_t dataChunkToSelectPos;
     std::shared_ptr<common::DataChunkState> state;
+    // Indices into expressionEvaluators in evaluation order.
+    std::vector<uint32_t> evaluationOrder;
+    std::vector<FilterConjunctStats> conjunctStats;
+    std::vector<common::NumericMetric*> conjunctInputs;
+    uint64_t numInputChunks;
+    uint64_t numSamples;
 };
 
 struct NodeLabelFilterInfo {
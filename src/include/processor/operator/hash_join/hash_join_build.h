@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <optional>
 
 #include "binder/expression/expression.h"
 #include "join_hash_table.h"
@@ -72,6 +73,14 @@ private:
           tableSchema{other.tableSchema.copy()} {}
 };
 
+// Estimated cardinality of a build side that only scans and filters a single node, checked against
+// the actual number of build tuples when adaptive re-optimization is enabled.
+struct BuildCardinalityCheck {
+    // Unique name of the scanned node.
+    std::string nodeName;
+    common::cardinality_t estimatedCardinality;
+};
+
 class HashJoinBuild : public Sink {
 public:
     HashJoinBuild(PhysicalOperatorType operatorType,
@@ -83,6 +92,8 @@ public:
 
     std::shared_ptr<HashJoinSharedState> getSharedState() const { return sharedState; }
 
+    void setCardinalityCheck(BuildCardinalityCheck check) { cardinalityCheck = std::move(check); }
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     void executeInternal(ExecutionContext* context) override;
@@ -90,8 +101,10 @@ public:
     void finalizeInternal(ExecutionContext* context) override;
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return make_unique<HashJoinBuild>(operatorType, sharedState, info.copy(),
+        auto result = make_unique<HashJoinBuild>(operatorType, sharedState, info.copy(),
             children[0]->copy(), id, printInfo->copy());
+        result->cardinalityCheck = cardinalityCheck;
+        return result;
     }
 
 protected:
@@ -101,10 +114,12 @@ protected:
 
 private:
     void setKeyState(common::DataChunkState* state);
+    void checkCardinality(common::cardinality_t numTuples) const;
 
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
     HashJoinBuildInfo info;
+    std::optional<BuildCardinalityCheck> cardinalityCheck;
 
     std::vector<common::ValueVector*> keyVectors;
     // State of unFlat key(s). If all keys are flat, it points to any flat key state.
@@ -26,6 +26,27 @@ struct ProbeState {
     common::sel_t nextMatchedTupleIdx;
 };
 
+// Mark and count joins produce a single value per probe tuple that only depends on its key. For
+// node ID keys, the value is memoized in a small direct-mapped cache so that probe tuples repeating
+// a key, e.g. outer tuples of a correlated subquery sharing a node, skip the hash table.
+struct ProbeMemo {
+    static constexpr uint64_t NUM_SLOTS = 4096;
+
+    struct Slot {
+        common::internalID_t key{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
+        int64_t value = 0;
+    };
+
+    std::vector<Slot> slots;
+    common::NumericMetric* numLookups;
+    common::NumericMetric* numHits;
+
+    ProbeMemo(common::NumericMetric* numLookups, common::NumericMetric* numHits)
+        : slots(NUM_SLOTS), numLookups{numLookups}, numHits{numHits} {}
+
+    Slot& getSlot(common::internalID_t key);
+};
+
 struct ProbeDataInfo {
 public:
     ProbeDataInfo(std::vector<DataPos> keysDataPos, std::vector<DataPos> payloadsOutPos)
@@ -83,7 +104,16 @@ public:
             children[0]->copy(), id, printInfo->copy());
     }
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 private:
+    std::string getMemoLookupsMetricKey() const { return "memoLookups-" + std::to_string(id); }
+    std::string getMemoHitsMetricKey() const { return "memoHits-" + std::to_string(id); }
+    bool canMemoize() const;
+    bool getNextTuplesWithMemo(ExecutionContext* context);
+    int64_t probeMarkOrCount();
+
     bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -117,6 +147,7 @@ private:
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
     common::SelectionVector hashSelVec;
+    std::unique_ptr<ProbeMemo> memo;
 };
 
 } // namespace processor
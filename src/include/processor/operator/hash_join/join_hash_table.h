@@ -31,9 +31,10 @@ public:
         common::SelectionVector& hashSelVec, common::ValueVector* tmpHashResultVector,
         uint8_t** probedTuples);
     // All key vectors must be flat. Thus input is a tuple, multiple matches can be found for the
-    // given key tuple.
+    // given key tuple. Stops after maxNumMatches matches.
     common::sel_t matchFlatKeys(const std::vector<common::ValueVector*>& keyVectors,
-        uint8_t** probedTuples, uint8_t** matchedTuples);
+        uint8_t** probedTuples, uint8_t** matchedTuples,
+        common::sel_t maxNumMatches = common::DEFAULT_VECTOR_CAPACITY);
     // Input is multiple tuples, at most one match exist for each key.
     common::sel_t matchUnFlatKey(common::ValueVector* keyVector, uint8_t** probedTuples,
         uint8_t** matchedTuples, common::SelectionVector& matchedTuplesSelVector);
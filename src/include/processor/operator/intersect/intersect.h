@@ -54,10 +54,11 @@ public:
 private:
     // For each build side, probe its HT and return a vector of matched flat tuples.
     void probeHTs();
-    // Left is always the one with less num of values.
-    static void twoWayIntersect(common::nodeID_t* leftNodeIDs, common::SelectionVector& lSelVector,
-        common::nodeID_t* rightNodeIDs, common::SelectionVector& rSelVector);
+    // Intersects all lists at once. The smallest list is always the first one.
     void intersectLists(const std::vector<common::overflow_value_t>& listsToIntersect);
+    static bool hasNextMatchCandidate(
+        const std::vector<common::overflow_value_t>& listsToIntersect,
+        const std::vector<uint64_t>& positions);
     void populatePayloads(const std::vector<uint8_t*>& tuples,
         const std::vector<uint32_t>& listIdxes);
     bool hasNextTuplesToIntersect();
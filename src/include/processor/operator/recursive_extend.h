@@ -45,7 +45,16 @@ public:
             printInfo->copy());
     }
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 private:
+    // Number of sources whose delta-stepping search found a path longer than the hop upper bound
+    // and was repeated with bounded iterations.
+    std::string getDeltaSteppingFallbacksMetricKey() const {
+        return "deltaSteppingFallbacks-" + std::to_string(id);
+    }
+
     std::unique_ptr<function::RJAlgorithm> function;
     function::RJBindData bindData;
     std::shared_ptr<RecursiveExtendSharedState> sharedState;
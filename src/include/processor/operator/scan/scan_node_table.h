@@ -30,10 +30,12 @@ public:
     common::SemiMask* getSemiMask() const { return semiMask.get(); }
 
 private:
-    std::mutex mtx;
     storage::NodeTable* table;
-    common::node_group_idx_t currentCommittedGroupIdx;
-    common::node_group_idx_t currentUnCommittedGroupIdx;
+    // Morsels (node groups) are claimed with atomic increments instead of a lock, so scanning
+    // threads do not serialize on the shared state. The counters can run past the number of node
+    // groups once the scan is exhausted.
+    std::atomic<common::node_group_idx_t> currentCommittedGroupIdx;
+    std::atomic<common::node_group_idx_t> currentUnCommittedGroupIdx;
     common::node_group_idx_t numCommittedNodeGroups;
     common::node_group_idx_t numUnCommittedNodeGroups;
     std::unique_ptr<common::SemiMask> semiMask;
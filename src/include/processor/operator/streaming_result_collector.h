@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+
+#include "processor/operator/sink.h"
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Bounded queue between the final pipeline of a query, which pushes tables of result tuples while
+// it executes, and the StreamingQueryResult consuming them. Producers wait while the queue holds
+// maxNumBufferedTuples tuples or more (back-pressure). The consumer can cancel the query by closing
+// the queue.
+class StreamingResultCollectorSharedState {
+public:
+    explicit StreamingResultCollectorSharedState(uint64_t maxNumBufferedTuples)
+        : maxNumBufferedTuples{maxNumBufferedTuples} {}
+
+    // Waits at most timeoutInMS for space in the queue. Returns false if the table is not pushed,
+    // either because the queue is still full or because it has been cancelled.
+    bool push(std::shared_ptr<FactorizedTable> table, uint64_t timeoutInMS);
+    void finish();
+    void finishWithError(std::string errorMessage);
+
+    // Blocks until a table is available. Returns nullptr once all tables of a finished query have
+    // been consumed, and throws if the query failed.
+    std::shared_ptr<FactorizedTable> pop();
+    // Blocks until a table is available or the query is finished.
+    void waitForResult();
+    bool hasError() const;
+    std::string getErrorMessage() const;
+
+    void cancel();
+    // Lock-free, so the consumer can check it for every tuple.
+    bool isCancelled() const { return cancelled; }
+    void throwIfCancelled() const;
+
+private:
+    struct BufferedTable {
+        std::shared_ptr<FactorizedTable> table;
+        uint64_t numTuples;
+    };
+
+    mutable std::mutex mtx;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    uint64_t maxNumBufferedTuples;
+    uint64_t numBufferedTuples = 0;
+    std::deque<BufferedTable> tables;
+    bool finished = false;
+    std::atomic<bool> cancelled = false;
+    std::string errorMessage;
+};
+
+struct StreamingResultCollectorInfo {
+    FactorizedTableSchema tableSchema;
+    std::vector<DataPos> payloadPositions;
+
+    StreamingResultCollectorInfo(FactorizedTableSchema tableSchema,
+        std::vector<DataPos> payloadPositions)
+        : tableSchema{std::move(tableSchema)}, payloadPositions{std::move(payloadPositions)} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(StreamingResultCollectorInfo);
+
+private:
+    StreamingResultCollectorInfo(const StreamingResultCollectorInfo& other)
+        : tableSchema{other.tableSchema.copy()}, payloadPositions{other.payloadPositions} {}
+};
+
+class StreamingResultCollector final : public Sink {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RESULT_COLLECTOR;
+    // Interval to check for interruption while waiting for the consumer to free up the queue.
+    static constexpr uint64_t PUSH_WAIT_INTERVAL_IN_MS = 10;
+
+public:
+    StreamingResultCollector(StreamingResultCollectorInfo info,
+        std::shared_ptr<StreamingResultCollectorSharedState> sharedState,
+        std::unique_ptr<PhysicalOperator> child, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : Sink{type_, std::move(child), id, std::move(printInfo)}, info{std::move(info)},
+          sharedState{std::move(sharedState)} {}
+
+    void executeInternal(ExecutionContext* context) override;
+
+    // Tuples are handed over to the consumer while the query executes, so there is no result left
+    // once execution finishes.
+    std::unique_ptr<main::QueryResult> getQueryResult() const override { return nullptr; }
+
+    std::shared_ptr<StreamingResultCollectorSharedState> getSharedState() const {
+        return sharedState;
+    }
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<StreamingResultCollector>(info.copy(), sharedState,
+            children[0]->copy(), id, printInfo->copy());
+    }
+
+private:
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    void pushLocalTable(ExecutionContext* context);
+
+private:
+    StreamingResultCollectorInfo info;
+    std::shared_ptr<StreamingResultCollectorSharedState> sharedState;
+    std::vector<common::ValueVector*> payloadVectors;
+    std::unordered_set<uint32_t> payloadChunkPositions;
+    std::unique_ptr<FactorizedTable> localTable;
+    // Unflat payload vectors are appended as a single factorized tuple, so the size of the local
+    // table is tracked in flat tuples.
+    uint64_t numLocalFlatTuples = 0;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <mutex>
+#include <atomic>
 
 #include "binder/expression/expression.h"
 #include "processor/operator/physical_operator.h"
@@ -48,24 +48,25 @@ struct UnionAllScanMorsel {
         : table{table}, startTupleIdx{startTupleIdx}, numTuples{numTuples} {}
 };
 
+// Morsels of all tables are numbered consecutively and claimed with an atomic increment, so
+// scanning threads do not serialize on the shared state.
 class UnionAllScanSharedState {
 public:
     UnionAllScanSharedState(std::vector<std::shared_ptr<FactorizedTable>> tables,
         uint64_t maxMorselSize)
-        : tables{std::move(tables)}, maxMorselSize{maxMorselSize}, tableIdx{0},
-          nextTupleIdxToScan{0} {}
+        : tables{std::move(tables)}, maxMorselSize{maxMorselSize}, nextMorselIdx{0} {}
 
-    std::unique_ptr<UnionAllScanMorsel> getMorsel();
+    // Must be called once the tables are fully populated.
+    void initialize();
 
-private:
-    std::unique_ptr<UnionAllScanMorsel> getMorselNoLock(FactorizedTable* table);
+    std::unique_ptr<UnionAllScanMorsel> getMorsel();
 
 private:
-    std::mutex mtx;
     std::vector<std::shared_ptr<FactorizedTable>> tables;
     uint64_t maxMorselSize;
-    uint64_t tableIdx;
-    uint64_t nextTupleIdxToScan;
+    // Index of the first morsel of each table, followed by the total number of morsels.
+    std::vector<uint64_t> morselStartIdxPerTable;
+    std::atomic<uint64_t> nextMorselIdx;
 };
 
 class UnionAllScan : public PhysicalOperator {
@@ -79,6 +80,8 @@ public:
 
     bool isSource() const final { return true; }
 
+    void initGlobalStateInternal(ExecutionContext* context) final;
+
     void initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* context) final;
 
     bool getNextTuplesInternal(ExecutionContext* context) final;
@@ -62,7 +62,7 @@ public:
 
     std::unique_ptr<PhysicalPlan> getPhysicalPlan(const planner::LogicalPlan* logicalPlan,
         const binder::expression_vector& expressions, main::QueryResultType resultType,
-        common::ArrowResultConfig arrowConfig);
+        common::ArrowResultConfig arrowConfig, uint64_t maxNumBufferedTuples = 0);
 
     uint32_t getOperatorID() { return physicalOperatorID++; }
 
@@ -173,6 +173,9 @@ public:
     std::unique_ptr<PhysicalOperator> createArrowResultCollector(
         common::ArrowResultConfig arrowConfig, const binder::expression_vector& expressions,
         planner::Schema* schema, std::unique_ptr<PhysicalOperator> prevOperator);
+    std::unique_ptr<PhysicalOperator> createStreamingResultCollector(uint64_t maxNumBufferedTuples,
+        const binder::expression_vector& expressions, planner::Schema* schema,
+        std::unique_ptr<PhysicalOperator> prevOperator);
 
     // Scan fTable
     std::unique_ptr<PhysicalOperator> createFTableScan(const binder::expression_vector& exprs,
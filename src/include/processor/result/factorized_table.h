@@ -72,6 +72,13 @@ public:
     DataBlock* getLastBlock() { return blocks.back().get(); }
 
     void merge(DataBlockCollection& other);
+    uint64_t getMemoryUsage() const {
+        uint64_t memoryUsage = 0;
+        for (auto& block : blocks) {
+            memoryUsage += block->getSizedData().size();
+        }
+        return memoryUsage;
+    }
     void preventDestruction() const {
         for (auto& block : blocks) {
             block->preventDestruction();
@@ -141,6 +148,8 @@ public:
     uint64_t getNumTuples() const { return numTuples; }
     uint64_t getTotalNumFlatTuples() const;
     uint64_t getNumFlatTuples(ft_tuple_idx_t tupleIdx) const;
+    // Number of bytes held by the tuple blocks and the overflow buffer of the table.
+    uint64_t getMemoryUsage() const;
 
     const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() {
         return flatTupleBlockCollection->getBlocks();
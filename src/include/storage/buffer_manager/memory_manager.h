@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <stack>
 
+#include "common/copy_constructors.h"
 #include "common/system_config.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/spill_result.h"
@@ -25,8 +27,29 @@ class ChunkedNodeGroup;
 template<class T>
 class MmAllocator;
 
+/*
+ * Tracks the intermediate memory allocated on behalf of a single query and enforces the memory
+ * limit of its workload class. Buffers keep a reference to the tracker they were charged to, as
+ * they can outlive the query (e.g. in a materialized query result).
+ */
+class KUZU_API QueryMemoryTracker {
+public:
+    explicit QueryMemoryTracker(uint64_t memoryLimit) : memoryLimit{memoryLimit}, usedMemory{0} {}
+
+    // Throws if the allocation would exceed the memory limit of the query.
+    void reserve(uint64_t size);
+    void release(uint64_t size) { usedMemory.fetch_sub(size, std::memory_order_relaxed); }
+
+    uint64_t getUsedMemory() const { return usedMemory.load(std::memory_order_relaxed); }
+
+private:
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> usedMemory;
+};
+
 class MemoryBuffer {
     friend class Spiller;
+    friend class MemoryManager;
 
 public:
     KUZU_API MemoryBuffer(MemoryManager* mm, common::page_idx_t blockIdx, uint8_t* buffer,
@@ -58,6 +81,7 @@ private:
     MemoryManager* mm;
     common::page_idx_t pageIdx;
     bool evicted;
+    std::shared_ptr<QueryMemoryTracker> memoryTracker;
 };
 
 /*
@@ -93,7 +117,13 @@ public:
 
     static MemoryManager* Get(const main::ClientContext& context);
 
+    // Buffers allocated by the calling thread are charged to the given tracker until it is
+    // replaced. Pass nullptr to stop tracking.
+    static void setQueryMemoryTracker(std::shared_ptr<QueryMemoryTracker> memoryTracker);
+    static std::shared_ptr<QueryMemoryTracker> getQueryMemoryTracker();
+
 private:
+    std::unique_ptr<MemoryBuffer> allocateBufferInternal(bool initializeToZero, uint64_t size);
     void freeBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     void updateUsedMemoryForFreedBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     std::span<uint8_t> mallocBuffer(bool initializeToZero, uint64_t size);
@@ -106,5 +136,22 @@ private:
     std::mutex allocatorLock;
 };
 
+// Charges the buffers allocated by the current thread to the given tracker while it is in scope,
+// and restores the previous tracker of the thread afterwards.
+class QueryMemoryTrackerScope {
+public:
+    explicit QueryMemoryTrackerScope(std::shared_ptr<QueryMemoryTracker> memoryTracker)
+        : prevMemoryTracker{MemoryManager::getQueryMemoryTracker()} {
+        MemoryManager::setQueryMemoryTracker(std::move(memoryTracker));
+    }
+    DELETE_COPY_AND_MOVE(QueryMemoryTrackerScope);
+    ~QueryMemoryTrackerScope() {
+        MemoryManager::setQueryMemoryTracker(std::move(prevMemoryTracker));
+    }
+
+private:
+    std::shared_ptr<QueryMemoryTracker> prevMemoryTracker;
+};
+
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+// Values of a column that occur more than once in its sample, with the estimated fraction of
+// non-null values they account for.
+struct MostCommonValues {
+    static constexpr uint64_t MAX_NUM_VALUES = 32;
+
+    std::vector<std::pair<common::hash_t, double>> values;
+    // Sum of the frequencies of all most common values.
+    double totalFrequency = 0;
+
+    std::optional<double> getFrequency(common::hash_t hash) const;
+};
+
+// Equi-depth histogram over the numeric values of a column. Each bucket [bounds[i], bounds[i+1]]
+// holds the same fraction of non-null values.
+struct EquiDepthHistogram {
+    static constexpr uint64_t MAX_NUM_BUCKETS = 64;
+
+    std::vector<double> bounds;
+
+    bool empty() const { return bounds.empty(); }
+    // Estimated fraction of non-null values smaller than (or equal to if inclusive) value.
+    double getFractionLessThan(double value, bool inclusive) const;
+};
+
+// Uniform sample of the non-null values of a column, maintained with reservoir sampling as values
+// are inserted and merged when stats of different node groups are combined. The sample keeps the
+// hash of each value and, for numeric columns, the value itself so that both most common values
+// and histograms can be derived from it.
+class ColumnSample {
+public:
+    static constexpr uint64_t CAPACITY = 1024;
+
+    struct Entry {
+        common::hash_t hash;
+        double value;
+    };
+
+    ColumnSample() : ColumnSample{false /* hasNumericValues */} {}
+    explicit ColumnSample(bool hasNumericValues)
+        : hasNumericValues_{hasNumericValues}, numValues{0}, randomState{0} {}
+
+    bool hasNumericValues() const { return hasNumericValues_; }
+    common::cardinality_t getNumValues() const { return numValues; }
+    bool empty() const { return entries.empty(); }
+
+    void insert(common::hash_t hash, double value);
+    void merge(const ColumnSample& other);
+
+    MostCommonValues getMostCommonValues() const;
+    EquiDepthHistogram getHistogram() const;
+
+    void serialize(common::Serializer& serializer) const;
+    static ColumnSample deserialize(common::Deserializer& deserializer);
+
+private:
+    // Splitmix64, so that samples are reproducible and cheap to maintain during COPY.
+    uint64_t nextRandom();
+
+private:
+    bool hasNumericValues_;
+    // Number of non-null values inserted into the sample so far.
+    common::cardinality_t numValues;
+    uint64_t randomState;
+    std::vector<Entry> entries;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -5,6 +5,7 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
+#include "storage/stats/column_sample.h"
 #include "storage/stats/hyperloglog.h"
 
 namespace kuzu {
@@ -17,6 +18,10 @@ public:
     EXPLICIT_COPY_DEFAULT_MOVE(ColumnStats);
 
     common::cardinality_t getNumDistinctValues() const { return hll ? hll->count() : 0; }
+    // Number of non-null values the sample was drawn from. 0 if the column is not sampled.
+    common::cardinality_t getNumNonNullValues() const {
+        return sample ? sample->getNumValues() : 0;
+    }
 
     void update(const common::ValueVector* vector);
 
@@ -25,8 +30,27 @@ public:
             KU_ASSERT(other.hll);
             hll->merge(*other.hll);
         };
+        if (sample) {
+            KU_ASSERT(other.sample);
+            sample->merge(*other.sample);
+        }
     }
 
+    // Derives the most common values and the histogram of the column from its sample. Called once
+    // a COPY has merged its stats and when the stats are checkpointed or loaded, so that the
+    // estimates below do not sort the sample for every filter. Until then, the estimates use the
+    // previously built distribution.
+    void buildValueDistribution();
+
+    // Estimated fraction of non-null values equal to value, based on the most common values of
+    // the column and, for other values, on its number of distinct values. The value must be of the
+    // same type as the column.
+    std::optional<double> estimateEqualitySelectivity(const common::Value& value) const;
+    // Estimated fraction of non-null values smaller (or greater) than value, based on the
+    // histogram of the column. Only available for numeric columns.
+    std::optional<double> estimateRangeSelectivity(const common::Value& value, bool lessThan,
+        bool inclusive) const;
+
     void serialize(common::Serializer& serializer) const {
         serializer.writeDebuggingInfo("has_hll");
         serializer.serializeValue(hll.has_value());
@@ -34,6 +58,12 @@ public:
             serializer.writeDebuggingInfo("hll");
             hll->serialize(serializer);
         }
+        serializer.writeDebuggingInfo("has_sample");
+        serializer.serializeValue(sample.has_value());
+        if (sample) {
+            serializer.writeDebuggingInfo("sample");
+            sample->serialize(serializer);
+        }
     }
 
     static ColumnStats deserialize(common::Deserializer& deserializer) {
@@ -46,14 +76,29 @@ public:
             deserializer.validateDebuggingInfo(info, "hll");
             columnStats.hll = HyperLogLog::deserialize(deserializer);
         }
+        deserializer.validateDebuggingInfo(info, "has_sample");
+        bool hasSample = false;
+        deserializer.deserializeValue(hasSample);
+        if (hasSample) {
+            deserializer.validateDebuggingInfo(info, "sample");
+            columnStats.sample = ColumnSample::deserialize(deserializer);
+        }
+        columnStats.buildValueDistribution();
         return columnStats;
     }
 
 private:
-    ColumnStats(const ColumnStats& other) : hll{other.hll}, hashes{nullptr} {}
+    ColumnStats(const ColumnStats& other)
+        : hll{other.hll}, sample{other.sample}, mostCommonValues{other.mostCommonValues},
+          histogram{other.histogram}, hashes{nullptr} {}
 
 private:
     std::optional<HyperLogLog> hll;
+    // Sample from which most common values and histograms are derived.
+    std::optional<ColumnSample> sample;
+    // Derived from the sample by buildValueDistribution().
+    MostCommonValues mostCommonValues;
+    EquiDepthHistogram histogram;
     // Preallocated vector for hash values.
     std::unique_ptr<common::ValueVector> hashes;
 };
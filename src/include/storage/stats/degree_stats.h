@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+// Distribution of the number of rels of the bound nodes of a rel table in one direction. Nodes
+// without rels are not tracked. Degrees are bucketed into a log2 histogram: bucket i counts the
+// nodes whose degree is in [2^i, 2^(i+1)).
+class DegreeStats {
+public:
+    static constexpr uint64_t NUM_BUCKETS = 64;
+
+    DegreeStats() : numNodes{0}, numRels{0}, sumOfSquaredDegrees{0}, maxDegree{0}, histogram{} {}
+
+    void add(common::length_t degree);
+    // Removing a degree keeps the max degree, which then becomes an upper bound.
+    void remove(common::length_t degree);
+    void merge(const DegreeStats& other);
+    // Removes the degrees merged from the given stats. Also keeps the max degree.
+    void subtract(const DegreeStats& other);
+
+    bool empty() const { return numNodes == 0; }
+    common::cardinality_t getNumNodes() const { return numNodes; }
+    common::cardinality_t getNumRels() const { return numRels; }
+    uint64_t getMaxDegree() const { return maxDegree; }
+    double getAvgDegree() const {
+        return numNodes == 0 ? 0 : static_cast<double>(numRels) / static_cast<double>(numNodes);
+    }
+    // Expected degree of a node reached by following a random rel, i.e. E[d^2] / E[d]. This is
+    // larger than the average degree when a few hub nodes own most of the rels.
+    double getExcessDegree() const {
+        return numRels == 0 ? 0 : sumOfSquaredDegrees / static_cast<double>(numRels);
+    }
+    // Approximate degree below which the given fraction of nodes fall.
+    uint64_t getDegreeAtPercentile(double percentile) const;
+    const std::array<uint64_t, NUM_BUCKETS>& getHistogram() const { return histogram; }
+
+    void serialize(common::Serializer& serializer) const;
+    static DegreeStats deserialize(common::Deserializer& deserializer);
+
+private:
+    static uint64_t getBucketIdx(common::length_t degree);
+
+private:
+    common::cardinality_t numNodes;
+    common::cardinality_t numRels;
+    double sumOfSquaredDegrees;
+    uint64_t maxDegree;
+    std::array<uint64_t, NUM_BUCKETS> histogram;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "common/types/types.h"
 #include "storage/stats/column_stats.h"
+#include "storage/stats/degree_stats.h"
 
 namespace kuzu::common {
 class LogicalType;
@@ -27,6 +28,7 @@ public:
 
     void merge(const std::vector<common::column_id_t>& columnIDs, const TableStats& other) {
         cardinality += other.cardinality;
+        degreeStats.merge(other.degreeStats);
         KU_ASSERT(columnIDs.size() == other.columnStats.size());
         for (auto i = 0u; i < columnIDs.size(); ++i) {
             auto columnID = columnIDs[i];
@@ -42,12 +44,29 @@ public:
         return columnStats[columnID].getNumDistinctValues();
     }
 
+    const ColumnStats& getColumnStats(common::column_id_t columnID) const {
+        KU_ASSERT(columnID < columnStats.size());
+        return columnStats[columnID];
+    }
+
+    // Only maintained for the CSR node groups of rel tables, for the direction they are stored in.
+    const DegreeStats& getDegreeStats() const { return degreeStats; }
+    void setDegreeStats(DegreeStats degreeStats_) { degreeStats = std::move(degreeStats_); }
+    void mergeDegreeStats(const DegreeStats& other) { degreeStats.merge(other); }
+    void subtractDegreeStats(const DegreeStats& other) { degreeStats.subtract(other); }
+
     void update(const std::vector<common::ValueVector*>& vectors,
         size_t numColumns = std::numeric_limits<size_t>::max());
     void update(const std::vector<common::column_id_t>& columnIDs,
         const std::vector<common::ValueVector*>& vectors,
         size_t numColumns = std::numeric_limits<size_t>::max());
 
+    void buildValueDistributions() {
+        for (auto& stats : columnStats) {
+            stats.buildValueDistribution();
+        }
+    }
+
     ColumnStats& addNewColumn(const common::LogicalType& dataType) {
         columnStats.emplace_back(dataType);
         return columnStats.back();
@@ -63,6 +82,7 @@ private:
     // Note: cardinality is the estimated number of rows in the table. It is not always up-to-date.
     common::cardinality_t cardinality;
     std::vector<ColumnStats> columnStats;
+    DegreeStats degreeStats;
 };
 
 } // namespace storage
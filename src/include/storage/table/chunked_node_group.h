@@ -200,8 +200,9 @@ public:
         const NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInChunk,
         common::sel_t posInOutput) const;
 
-    void update(const transaction::Transaction* transaction, common::row_idx_t rowIdxInChunk,
-        common::column_id_t columnID, const common::ValueVector& propertyVector);
+    void update(const transaction::Transaction* transaction, common::table_id_t tableID,
+        common::row_idx_t rowIdxInChunk, common::column_id_t columnID,
+        const common::ValueVector& propertyVector);
 
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInChunk);
 
@@ -161,8 +161,9 @@ public:
     void lookup(const transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t rowInChunk, common::ValueVector& output,
         common::sel_t posInOutputVector) const;
-    void update(const transaction::Transaction* transaction, common::offset_t offsetInChunk,
-        const common::ValueVector& values);
+    // The ID of the node table or rel group the chunk belongs to is recorded in the undo buffer.
+    void update(const transaction::Transaction* transaction, common::table_id_t tableID,
+        common::offset_t offsetInChunk, const common::ValueVector& values);
 
     uint64_t getEstimatedMemoryUsage() const {
         if (getResidencyState() == ResidencyState::ON_DISK) {
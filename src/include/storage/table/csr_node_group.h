@@ -6,6 +6,7 @@
 #include "common/constants.h"
 #include "common/system_config.h"
 #include "storage/enums/csr_node_group_scan_source.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/table/csr_chunked_node_group.h"
 #include "storage/table/node_group.h"
 
@@ -151,6 +152,8 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<InMemChunkedCSRHeader> oldHeader;
     std::unique_ptr<InMemChunkedCSRHeader> newHeader;
+    // Degree stats of the rel table, updated with the csr lengths changed by the checkpoint.
+    DegreeStats* degreeStats = nullptr;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm,
@@ -199,9 +202,9 @@ public:
         std::span<const ColumnChunk*> chunks, common::row_idx_t startRowInChunks,
         common::row_idx_t numRows);
 
-    void update(const transaction::Transaction* transaction, CSRNodeGroupScanSource source,
-        common::row_idx_t rowIdxInGroup, common::column_id_t columnID,
-        const common::ValueVector& propertyVector);
+    void update(const transaction::Transaction* transaction, common::table_id_t tableID,
+        CSRNodeGroupScanSource source, common::row_idx_t rowIdxInGroup,
+        common::column_id_t columnID, const common::ValueVector& propertyVector);
     bool delete_(const transaction::Transaction* transaction, CSRNodeGroupScanSource source,
         common::row_idx_t rowIdxInGroup);
 
@@ -218,6 +221,12 @@ public:
         KU_ASSERT(chunkedNodeGroup->getFormat() == NodeGroupDataFormat::CSR);
         persistentChunkGroup = std::move(chunkedNodeGroup);
     }
+    // Degrees of the bound nodes in the persistent chunked group flushed by COPY. They are merged
+    // into the degree stats of the table right away and subtracted again if the COPY rolls back.
+    const DegreeStats& getCopiedDegreeStats() const { return copiedDegreeStats; }
+    void setCopiedDegreeStats(DegreeStats degreeStats) {
+        copiedDegreeStats = std::move(degreeStats);
+    }
 
     void serialize(common::Serializer& serializer) override;
 
@@ -285,6 +294,7 @@ private:
 private:
     std::unique_ptr<ChunkedNodeGroup> persistentChunkGroup;
     std::unique_ptr<CSRIndex> csrIndex;
+    DegreeStats copiedDegreeStats;
 };
 
 } // namespace storage
@@ -159,8 +159,9 @@ public:
     bool lookupMultiple(const transaction::Transaction* transaction,
         const TableScanState& state) const;
 
-    void update(const transaction::Transaction* transaction, common::row_idx_t rowIdxInGroup,
-        common::column_id_t columnID, const common::ValueVector& propertyVector);
+    void update(const transaction::Transaction* transaction, common::table_id_t tableID,
+        common::row_idx_t rowIdxInGroup, common::column_id_t columnID,
+        const common::ValueVector& propertyVector);
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInGroup);
 
     bool hasDeletions(const transaction::Transaction* transaction) const;
@@ -96,6 +96,26 @@ public:
         auto lock = nodeGroups.lock();
         this->stats.merge(columnIDs, stats);
     }
+    void buildValueDistributions() {
+        auto lock = nodeGroups.lock();
+        stats.buildValueDistributions();
+    }
+    DegreeStats getDegreeStats() const {
+        auto lock = nodeGroups.lock();
+        return stats.getDegreeStats();
+    }
+    void setDegreeStats(DegreeStats degreeStats) {
+        auto lock = nodeGroups.lock();
+        stats.setDegreeStats(std::move(degreeStats));
+    }
+    void mergeDegreeStats(const DegreeStats& degreeStats) {
+        auto lock = nodeGroups.lock();
+        stats.mergeDegreeStats(degreeStats);
+    }
+    void subtractDegreeStats(const DegreeStats& degreeStats) {
+        auto lock = nodeGroups.lock();
+        stats.subtractDegreeStats(degreeStats);
+    }
 
     void serialize(common::Serializer& ser);
     void deserialize(common::Deserializer& deSer, MemoryManager& memoryManager);
@@ -100,6 +100,7 @@ public:
         common::row_idx_t numRows, common::transaction_t commitTS) const override;
     void rollbackInsert(main::ClientContext* context, common::node_group_idx_t nodeGroupIdx,
         common::row_idx_t startRow, common::row_idx_t numRows) const override;
+    common::table_id_t getTableID() const override;
 
 private:
     NodeTable* table;
@@ -203,6 +204,8 @@ public:
     void mergeStats(const std::vector<common::column_id_t>& columnIDs, const TableStats& stats) {
         nodeGroups->mergeStats(columnIDs, stats);
     }
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void buildValueDistributions() { nodeGroups->buildValueDistributions(); }
 
     void serialize(common::Serializer& serializer) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
@@ -34,6 +34,7 @@ public:
         common::row_idx_t numRows, common::transaction_t commitTS) const override;
     void rollbackInsert(main::ClientContext* context, common::node_group_idx_t nodeGroupIdx,
         common::row_idx_t startRow, common::row_idx_t numRows) const override;
+    common::table_id_t getTableID() const override;
 
 private:
     RelTableData* relTableData;
@@ -48,6 +49,7 @@ public:
         common::row_idx_t numRows, common::transaction_t commitTS) const override;
     void rollbackInsert(main::ClientContext* context, common::node_group_idx_t nodeGroupIdx,
         common::row_idx_t startRow, common::row_idx_t numRows) const override;
+    common::table_id_t getTableID() const override;
 
 private:
     RelTableData* relTableData;
@@ -95,6 +97,10 @@ public:
     common::RelMultiplicity getMultiplicity() const { return multiplicity; }
 
     TableStats getStats() const { return nodeGroups->getStats(); }
+    DegreeStats getDegreeStats() const { return nodeGroups->getDegreeStats(); }
+    void mergeDegreeStats(const DegreeStats& degreeStats) const {
+        nodeGroups->mergeDegreeStats(degreeStats);
+    }
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
     void checkpoint(const std::vector<common::column_id_t>& columnIDs,
@@ -111,8 +117,10 @@ public:
     }
 
     void rollbackGroupCollectionInsert(common::row_idx_t numRows_, bool isPersistent);
+    void rollbackCopiedDegreeStats(common::node_group_idx_t nodeGroupIdx);
 
     common::RelDataDirection getDirection() const { return direction; }
+    common::table_id_t getRelGroupID() const;
 
 private:
     void initCSRHeaderColumns(FileHandle* dataFH);
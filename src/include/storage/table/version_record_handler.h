@@ -23,6 +23,9 @@ public:
 
     virtual void rollbackInsert(main::ClientContext* context, common::node_group_idx_t nodeGroupIdx,
         common::row_idx_t startRow, common::row_idx_t numRows) const;
+
+    // Returns the ID of the node table or rel group the records belong to.
+    virtual common::table_id_t getTableID() const = 0;
 };
 
 } // namespace storage
@@ -87,10 +87,13 @@ public:
         common::row_idx_t numRows, const VersionRecordHandler* versionRecordHandler);
     void createDeleteInfo(common::node_group_idx_t nodeGroupIdx, common::row_idx_t startRow,
         common::row_idx_t numRows, const VersionRecordHandler* versionRecordHandler);
-    void createVectorUpdateInfo(UpdateInfo* updateInfo, common::idx_t vectorIdx,
-        VectorUpdateInfo* vectorUpdateInfo, common::transaction_t version);
+    void createVectorUpdateInfo(common::table_id_t tableID, UpdateInfo* updateInfo,
+        common::idx_t vectorIdx, VectorUpdateInfo* vectorUpdateInfo,
+        common::transaction_t version);
 
     void commit(common::transaction_t commitTS) const;
+    // Returns the node tables and rel groups whose rows are inserted, updated or deleted.
+    common::table_id_set_t getWrittenTableIDs() const;
     void rollback(main::ClientContext* context) const;
 
 private:
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace transaction {
+class Transaction;
+
+// Commit version of each of a set of tables, sorted by table ID. The version of a table is the
+// commit timestamp of the last transaction that wrote it, or 0 if it has not been written since the
+// database was opened.
+using table_versions_t = std::vector<std::pair<common::table_id_t, uint64_t>>;
+
+// Tracks the commit version of every table. Caches of data computed from tables, e.g. query results
+// or materialized graphs, keep the versions of the tables they read and are outdated once any of
+// them changes.
+class TableVersionTracker {
+public:
+    // Records the tables written by a committing transaction. Called under the transaction
+    // manager lock, so a transaction started afterwards sees the new versions.
+    void commitWrites(const common::table_id_set_t& tableIDs, common::transaction_t commitTS);
+
+    table_versions_t getTableVersions(const common::table_id_set_t& tableIDs);
+    bool isUpToDate(const table_versions_t& tableVersions);
+
+    // Returns false if the transaction may see a different version of the tables than the given
+    // versions, i.e. if it can write or if one of the versions was committed after it started.
+    static bool isVisible(const Transaction& transaction, const table_versions_t& tableVersions);
+
+private:
+    uint64_t getTableVersionNoLock(common::table_id_t tableID) const;
+
+private:
+    std::mutex mtx;
+    std::unordered_map<common::table_id_t, uint64_t> tableVersions;
+};
+
+} // namespace transaction
+} // namespace kuzu
@@ -140,8 +140,9 @@ public:
         common::row_idx_t numRows, const storage::VersionRecordHandler* versionRecordHandler) const;
     void pushDeleteInfo(common::node_group_idx_t nodeGroupIdx, common::row_idx_t startRow,
         common::row_idx_t numRows, const storage::VersionRecordHandler* versionRecordHandler) const;
-    void pushVectorUpdateInfo(storage::UpdateInfo& updateInfo, common::idx_t vectorIdx,
-        storage::VectorUpdateInfo& vectorUpdateInfo, common::transaction_t version) const;
+    void pushVectorUpdateInfo(common::table_id_t tableID, storage::UpdateInfo& updateInfo,
+        common::idx_t vectorIdx, storage::VectorUpdateInfo& vectorUpdateInfo,
+        common::transaction_t version) const;
 
     static Transaction* Get(const main::ClientContext& context);
 
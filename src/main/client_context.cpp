@@ -1,8 +1,13 @@
 #include "main/client_context.h"
 
+#include <algorithm>
+
 #include "binder/binder.h"
+#include "binder/expression/node_rel_expression.h"
+#include "binder/visitor/deterministic_statement_analyzer.h"
 #include "common/exception/checkpoint.h"
 #include "common/exception/connection.h"
+#include "common/exception/reoptimization.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/random_engine.h"
@@ -15,16 +20,25 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/query_result/materialized_query_result.h"
+#include "main/query_result/streaming_query_result.h"
+#include "main/query_result_cache.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
+#include "planner/operator/extend/base_logical_extend.h"
+#include "planner/operator/extend/logical_recursive_extend.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
+#include "processor/operator/streaming_result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/storage_manager.h"
+#include "transaction/table_version_tracker.h"
 #include "transaction/transaction_context.h"
 #include <processor/warning_context.h>
 
@@ -74,6 +88,7 @@ ClientContext::ClientContext(Database* database) : localDatabase{database} {
 }
 
 ClientContext::~ClientContext() {
+    finishStreamingQueryNoLock();
     if (preventTransactionRollbackOnDestruction) {
         return;
     }
@@ -120,6 +135,9 @@ void ClientContext::setMaxNumThreadForExec(uint64_t numThreads) {
 }
 
 uint64_t ClientContext::getMaxNumThreadForExec() const {
+    if (clientConfig.workloadClassMaxNumThreads != 0) {
+        return std::min(clientConfig.numThreads, clientConfig.workloadClassMaxNumThreads);
+    }
     return clientConfig.numThreads;
 }
 
@@ -265,6 +283,28 @@ void ClientContext::cleanUp() {
 std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_view query,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     std::unique_lock lck{mtx};
+    finishStreamingQueryNoLock();
+    // The binder deals with the parameter values as shared ptrs
+    // Copy the params to a new map that matches the format that the binder expects
+    std::unordered_map<std::string, std::shared_ptr<Value>> inputParamsTmp;
+    for (auto& [key, value] : inputParams) {
+        inputParamsTmp.insert(std::make_pair(key, std::make_shared<Value>(*value)));
+    }
+    const auto normalizedQuery = PlanCache::normalizeQuery(query);
+    std::string planCacheKey;
+    if (canUsePlanCache()) {
+        planCacheKey = getPlanCacheKey(normalizedQuery, inputParamsTmp);
+        auto cachedResult = prepareFromPlanCacheNoLock(planCacheKey, inputParamsTmp);
+        if (cachedResult.has_value()) {
+            auto preparedStatement = std::move(cachedResult->preparedStatement);
+            cachedResult->cachedPreparedStatement->normalizedQuery = normalizedQuery;
+            preparedStatement->cachedPreparedStatementName =
+                cachedPreparedStatementManager.addStatement(
+                    std::move(cachedResult->cachedPreparedStatement));
+            return preparedStatement;
+        }
+    }
+    const auto schemaVersion = Catalog::Get(*this)->getSchemaVersion();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -276,14 +316,12 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_
             "Connection Exception: We do not support prepare multiple statements.");
     }
 
-    // The binder deals with the parameter values as shared ptrs
-    // Copy the params to a new map that matches the format that the binder expects
-    std::unordered_map<std::string, std::shared_ptr<Value>> inputParamsTmp;
-    for (auto& [key, value] : inputParams) {
-        inputParamsTmp.insert(std::make_pair(key, std::make_shared<Value>(*value)));
-    }
     auto [preparedStatement, cachedStatement] = prepareNoLock(parsedStatements[0],
         true /*shouldCommitNewTransaction*/, std::move(inputParamsTmp));
+    cachedStatement->normalizedQuery = normalizedQuery;
+    if (!planCacheKey.empty()) {
+        addToPlanCacheNoLock(planCacheKey, schemaVersion, *preparedStatement, *cachedStatement);
+    }
     preparedStatement->cachedPreparedStatementName =
         cachedPreparedStatementManager.addStatement(std::move(cachedStatement));
     useInternalCatalogEntry_ = false;
@@ -311,6 +349,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
     // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
@@ -328,12 +367,39 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     }
     // LCOV_EXCL_STOP
     auto cachedStatement = cachedPreparedStatementManager.getCachedStatement(name);
+    const auto schemaVersion = Catalog::Get(*this)->getSchemaVersion();
+    std::string resultCacheKey;
+    if (!cachedStatement->normalizedQuery.empty() && canUseResultCache()) {
+        resultCacheKey =
+            getResultCacheKey(cachedStatement->normalizedQuery, preparedStatement->parameterMap);
+        auto cachedResult = queryFromResultCacheNoLock(resultCacheKey, schemaVersion);
+        if (cachedResult != nullptr) {
+            return cachedResult;
+        }
+    }
+    std::string planCacheKey;
+    if (!cachedStatement->normalizedQuery.empty() && canUsePlanCache()) {
+        planCacheKey =
+            getPlanCacheKey(cachedStatement->normalizedQuery, preparedStatement->parameterMap);
+        auto cachedResult =
+            prepareFromPlanCacheNoLock(planCacheKey, preparedStatement->parameterMap);
+        if (cachedResult.has_value()) {
+            return executeWithResultCacheNoLock(resultCacheKey, schemaVersion,
+                cachedResult->preparedStatement.get(), cachedResult->cachedPreparedStatement.get(),
+                queryID);
+        }
+    }
     // rebind
     auto [newPreparedStatement, newCachedStatement] =
         prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
             preparedStatement->parameterMap);
+    if (!planCacheKey.empty()) {
+        addToPlanCacheNoLock(planCacheKey, schemaVersion, *newPreparedStatement,
+            *newCachedStatement);
+    }
     useInternalCatalogEntry_ = false;
-    return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+    return executeWithResultCacheNoLock(resultCacheKey, schemaVersion, newPreparedStatement.get(),
+        newCachedStatement.get(), queryID);
 }
 
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
@@ -344,20 +410,53 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
 
 std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
+    finishStreamingQueryNoLock();
+    const auto schemaVersion = Catalog::Get(*this)->getSchemaVersion();
+    std::string resultCacheKey;
+    // Cached results are materialized, so arrow and streaming results bypass the cache.
+    if (config.resultType == QueryResultType::FTABLE && canUseResultCache()) {
+        resultCacheKey = getResultCacheKey(PlanCache::normalizeQuery(query), {} /* params */);
+        auto cachedResult = queryFromResultCacheNoLock(resultCacheKey, schemaVersion);
+        if (cachedResult != nullptr) {
+            return cachedResult;
+        }
+    }
+    std::string planCacheKey;
+    if (canUsePlanCache()) {
+        planCacheKey = getPlanCacheKey(PlanCache::normalizeQuery(query), {} /* params */);
+        auto cachedResult = prepareFromPlanCacheNoLock(planCacheKey, {} /* params */);
+        if (cachedResult.has_value()) {
+            auto queryResult = executeWithResultCacheNoLock(resultCacheKey, schemaVersion,
+                cachedResult->preparedStatement.get(), cachedResult->cachedPreparedStatement.get(),
+                queryID, config);
+            useInternalCatalogEntry_ = false;
+            return queryResult;
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
     } catch (std::exception& exception) {
         return QueryResult::getQueryResultWithError(exception.what());
     }
+    if (parsedStatements.size() > 1 && config.resultType == QueryResultType::STREAMING) {
+        // A streaming result would be closed by the execution of the next statement.
+        config.resultType = QueryResultType::FTABLE;
+    }
     std::unique_ptr<QueryResult> queryResult;
     QueryResult* lastResult = nullptr;
     double internalCompilingTime = 0.0, internalExecutionTime = 0.0;
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
-        auto currentQueryResult =
-            executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+        if (!planCacheKey.empty() && parsedStatements.size() == 1) {
+            addToPlanCacheNoLock(planCacheKey, schemaVersion, *preparedStatement,
+                *cachedStatement);
+        }
+        // Only a query consisting of a single statement is cached under its text.
+        auto currentQueryResult = executeWithResultCacheNoLock(
+            parsedStatements.size() == 1 ? resultCacheKey : "", schemaVersion,
+            preparedStatement.get(), cachedStatement.get(), queryID, config);
         if (!currentQueryResult->isSuccess()) {
             if (!lastResult) {
                 queryResult = std::move(currentQueryResult);
@@ -467,10 +566,16 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
                 preparedStatement->unknownParameters = expressionBinder->getUnknownParameters();
                 preparedStatement->parameterMap = expressionBinder->getKnownParameters();
                 cachedStatement->columns = boundStatement->getStatementResult()->getColumns();
+                auto deterministicAnalyzer = DeterministicStatementAnalyzer();
+                deterministicAnalyzer.visit(*boundStatement);
+                cachedStatement->deterministic = deterministicAnalyzer.isDeterministic();
                 auto planner = Planner(this);
+                planner.getCardinliatyEstimatorUnsafe().setCardinalityFeedback(
+                    cardinalityFeedback);
                 auto bestPlan = planner.planStatement(*boundStatement);
                 optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
                 cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
+                cachedStatement->parameterValuesUsed = expressionBinder->isParameterValueUsed();
             },
             preparedStatement->isReadOnly(),
             preparedStatement->getStatementType() == StatementType::TRANSACTION,
@@ -486,6 +591,231 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
     return {std::move(preparedStatement), std::move(cachedStatement)};
 }
 
+bool ClientContext::canUseDatabaseCaches() const {
+    // Statements of a manual transaction may see changes that are not committed yet. Scan
+    // replacements and attached databases resolve names against state the catalog does not track.
+    return transactionContext->isAutoTransaction() && !transactionContext->hasActiveTransaction() &&
+           !useInternalCatalogEntry() && scanReplacements.empty() && remoteDatabase == nullptr &&
+           DatabaseManager::Get(*this)->getAttachedDatabases().empty() &&
+           cardinalityFeedback.empty();
+}
+
+bool ClientContext::canUsePlanCache() const {
+    return clientConfig.enablePlanCache && canUseDatabaseCaches();
+}
+
+std::string ClientContext::getPlanCacheKey(const std::string& normalizedQuery,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& params) const {
+    // Settings that change how a statement is bound or planned.
+    auto settings = stringFormat("{}|{}|{}|{}|{}|{}|{}|{}|{}|{}", clientConfig.homeDirectory,
+        clientConfig.fileSearchPath, clientConfig.enableSemiMask, clientConfig.enableZoneMap,
+        clientConfig.varLengthMaxDepth, clientConfig.sparseFrontierThreshold,
+        PathSemanticUtils::toString(clientConfig.recursivePatternSemantic),
+        clientConfig.recursivePatternCardinalityScaleFactor, clientConfig.disableMapKeyCheck,
+        clientConfig.enablePlanOptimizer);
+    return PlanCache::getKey(normalizedQuery, params, settings);
+}
+
+std::optional<ClientContext::PrepareResult> ClientContext::prepareFromPlanCacheNoLock(
+    const std::string& planCacheKey,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& params) {
+    auto prepareTimer = TimeMetric(true /* enable */);
+    prepareTimer.start();
+    const auto entry = localDatabase->getPlanCache()->lookup(planCacheKey,
+        Catalog::Get(*this)->getSchemaVersion(), params);
+    if (entry == nullptr) {
+        return std::nullopt;
+    }
+    auto preparedStatement = std::make_unique<PreparedStatement>();
+    preparedStatement->readOnly = entry->readOnly;
+    preparedStatement->preparedSummary.statementType = entry->statementType;
+    preparedStatement->parameterMap = params;
+    try {
+        validateTransaction(entry->readOnly, entry->parsedStatement->requireTransaction());
+    } catch (std::exception& exception) {
+        preparedStatement->success = false;
+        preparedStatement->errMsg = exception.what();
+    }
+    auto cachedStatement = std::make_unique<CachedPreparedStatement>();
+    cachedStatement->parsedStatement = entry->parsedStatement;
+    cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(entry->logicalPlan.copy());
+    cachedStatement->columns = entry->columns;
+    cachedStatement->deterministic = entry->deterministic;
+    cachedStatement->parameterValuesUsed = entry->parameterValuesUsed;
+    prepareTimer.stop();
+    preparedStatement->preparedSummary.compilingTime = prepareTimer.getElapsedTimeMS();
+    return PrepareResult{std::move(preparedStatement), std::move(cachedStatement)};
+}
+
+// Table functions bind against state outside of the catalog, e.g. files, settings or projected
+// graphs of the connection.
+static bool containsTableFunctionCall(const LogicalOperator& op) {
+    if (op.getOperatorType() == LogicalOperatorType::TABLE_FUNCTION_CALL) {
+        return true;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        if (containsTableFunctionCall(*op.getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ClientContext::addToPlanCacheNoLock(const std::string& planCacheKey, uint64_t schemaVersion,
+    const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) const {
+    // Only read-only queries are cached.
+    if (!preparedStatement.isSuccess() ||
+        preparedStatement.getStatementType() != StatementType::QUERY ||
+        !preparedStatement.isReadOnly() || !preparedStatement.getUnknownParameters().empty() ||
+        cachedStatement.parsedStatement->isInternal() || cachedStatement.useInternalCatalogEntry ||
+        containsTableFunctionCall(cachedStatement.logicalPlan->getLastOperatorRef())) {
+        return;
+    }
+    for (auto& [name, value] : preparedStatement.parameterMap) {
+        if (value->getDataType().getLogicalTypeID() == LogicalTypeID::POINTER) {
+            // Pointer parameters refer to objects owned by the client, e.g. dataframes.
+            return;
+        }
+    }
+    auto entry = std::make_shared<PlanCacheEntry>();
+    entry->schemaVersion = schemaVersion;
+    entry->parsedStatement = cachedStatement.parsedStatement;
+    entry->logicalPlan = cachedStatement.logicalPlan->copy();
+    entry->columns = cachedStatement.columns;
+    entry->readOnly = preparedStatement.isReadOnly();
+    entry->deterministic = cachedStatement.deterministic;
+    entry->parameterValuesUsed = cachedStatement.parameterValuesUsed;
+    if (cachedStatement.parameterValuesUsed) {
+        // Copy the values, which are updated in place when the statement is executed again.
+        for (auto& [name, value] : preparedStatement.parameterMap) {
+            entry->parameterValues.emplace(name, std::make_shared<Value>(*value));
+        }
+    }
+    entry->statementType = preparedStatement.getStatementType();
+    localDatabase->getPlanCache()->insert(planCacheKey, std::move(entry));
+}
+
+bool ClientContext::canUseResultCache() const {
+    return localDatabase->getConfig().resultCacheSize > 0 && canUseDatabaseCaches();
+}
+
+std::string ClientContext::getResultCacheKey(const std::string& normalizedQuery,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& params) const {
+    auto key = getPlanCacheKey(normalizedQuery, params);
+    // Unlike plans, results differ for every parameter value.
+    std::vector<std::string> parameterValues;
+    parameterValues.reserve(params.size());
+    for (auto& [name, value] : params) {
+        parameterValues.push_back(name + "=" + value->toString());
+    }
+    std::sort(parameterValues.begin(), parameterValues.end());
+    for (auto& parameterValue : parameterValues) {
+        key += '\0';
+        key += parameterValue;
+    }
+    return key;
+}
+
+std::unique_ptr<QueryResult> ClientContext::queryFromResultCacheNoLock(
+    const std::string& resultCacheKey, uint64_t schemaVersion) const {
+    auto lookupTimer = TimeMetric(true /* enable */);
+    lookupTimer.start();
+    const auto entry = localDatabase->getQueryResultCache()->lookup(resultCacheKey, schemaVersion);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    auto result = std::make_unique<MaterializedQueryResult>(entry->columnNames,
+        LogicalType::copy(entry->columnTypes), entry->table);
+    lookupTimer.stop();
+    auto summary = std::make_unique<QuerySummary>(
+        PreparedSummary{lookupTimer.getElapsedTimeMS(), StatementType::QUERY});
+    result->setQuerySummary(std::move(summary));
+    return result;
+}
+
+// Collects the node tables and rel groups read by the plan. Returns false if the plan reads state
+// whose changes are not tracked per table.
+static bool collectReadTables(const LogicalOperator& op, table_id_set_t& tableIDs) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        for (auto tableID : op.constCast<LogicalScanNodeTable>().getTableIDs()) {
+            tableIDs.insert(tableID);
+        }
+    } break;
+    case LogicalOperatorType::EXTEND: {
+        auto& extend = op.constCast<BaseLogicalExtend>();
+        for (auto& expr : std::vector<std::shared_ptr<NodeOrRelExpression>>{extend.getBoundNode(),
+                 extend.getNbrNode(), extend.getRel()}) {
+            for (auto tableID : expr->getTableIDs()) {
+                tableIDs.insert(tableID);
+            }
+        }
+    } break;
+    case LogicalOperatorType::RECURSIVE_EXTEND: {
+        auto& graphEntry = op.constCast<LogicalRecursiveExtend>().getBindData().graphEntry;
+        for (auto tableID : graphEntry.getNodeTableIDs()) {
+            tableIDs.insert(tableID);
+        }
+        for (auto entry : graphEntry.getRelEntries()) {
+            tableIDs.insert(entry->getTableID());
+        }
+    } break;
+    case LogicalOperatorType::TABLE_FUNCTION_CALL:
+    case LogicalOperatorType::STANDALONE_CALL:
+    case LogicalOperatorType::EXTENSION:
+    case LogicalOperatorType::EXTENSION_CLAUSE:
+        return false;
+    default:
+        break;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        if (!collectReadTables(*op.getChild(i), tableIDs)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeWithResultCacheNoLock(
+    const std::string& resultCacheKey, uint64_t schemaVersion, PreparedStatement* preparedStatement,
+    CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
+    QueryConfig queryConfig) {
+    table_id_set_t tableIDs;
+    if (resultCacheKey.empty() || queryConfig.resultType != QueryResultType::FTABLE ||
+        !preparedStatement->isSuccess() ||
+        preparedStatement->getStatementType() != StatementType::QUERY ||
+        !preparedStatement->isReadOnly() || !preparedStatement->getUnknownParameters().empty() ||
+        !cachedStatement->deterministic || cachedStatement->logicalPlan->isProfile() ||
+        cachedStatement->parsedStatement->isInternal() ||
+        cachedStatement->useInternalCatalogEntry ||
+        !collectReadTables(cachedStatement->logicalPlan->getLastOperatorRef(), tableIDs)) {
+        return executeNoLock(preparedStatement, cachedStatement, queryID, queryConfig);
+    }
+    for (auto& [name, value] : preparedStatement->parameterMap) {
+        if (value->getDataType().getLogicalTypeID() == LogicalTypeID::POINTER) {
+            return executeNoLock(preparedStatement, cachedStatement, queryID, queryConfig);
+        }
+    }
+    // Versions are taken before the read transaction starts, so a write committed in between makes
+    // the result outdated on insertion rather than going unnoticed.
+    auto tableVersions = localDatabase->getTableVersionTracker()->getTableVersions(tableIDs);
+    auto result = executeNoLock(preparedStatement, cachedStatement, queryID, queryConfig);
+    if (!result->isSuccess() || result->getType() != QueryResultType::FTABLE) {
+        return result;
+    }
+    auto entry = std::make_shared<QueryResultCacheEntry>();
+    entry->table = result->cast<MaterializedQueryResult>().getFactorizedTableShared();
+    entry->columnNames = result->getColumnNames();
+    entry->columnTypes = result->getColumnDataTypes();
+    entry->schemaVersion = schemaVersion;
+    entry->tableVersions = std::move(tableVersions);
+    entry->memoryUsage = entry->table->getMemoryUsage();
+    localDatabase->getQueryResultCache()->insert(resultCacheKey, std::move(entry),
+        localDatabase->getConfig().resultCacheSize);
+    return result;
+}
+
 std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* preparedStatement,
     CachedPreparedStatement* cachedStatement, std::optional<uint64_t> queryID,
     QueryConfig queryConfig) {
@@ -498,6 +828,29 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::unique_ptr<QueryResult> result;
+    if (queryConfig.resultType == QueryResultType::STREAMING &&
+        !canStreamResult(*preparedStatement, *cachedStatement)) {
+        queryConfig.resultType = QueryResultType::FTABLE;
+    }
+    if (queryConfig.resultType == QueryResultType::STREAMING) {
+        if (!queryID) {
+            queryID = localDatabase->getNextQueryID();
+        }
+        try {
+            result = startStreamingQueryNoLock(*preparedStatement, *cachedStatement, *queryID,
+                queryConfig);
+        } catch (std::exception& e) {
+            useInternalCatalogEntry_ = false;
+            return handleFailedExecution(queryID, e);
+        }
+        executingTimer.stop();
+        result->setColumnNames(cachedStatement->getColumnNames());
+        result->setColumnTypes(cachedStatement->getColumnTypes());
+        auto summary = std::make_unique<QuerySummary>(preparedStatement->preparedSummary);
+        summary->setExecutionTime(executingTimer.getElapsedTimeMS());
+        result->setQuerySummary(std::move(summary));
+        return result;
+    }
     try {
         bool isTransactionStatement =
             preparedStatement->getStatementType() == StatementType::TRANSACTION;
@@ -511,6 +864,8 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                 }
                 const auto executionContext =
                     std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+                executionContext->enableReoptimization = canReoptimize(*preparedStatement);
+                executionContext->parameterValues = &preparedStatement->parameterMap;
                 auto mapper = PlanMapper(executionContext.get());
                 const auto physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
                     cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig);
@@ -529,6 +884,24 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
             preparedStatement->isReadOnly(), isTransactionStatement,
             TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
                 !isTransactionStatement /*shouldCommitAutoTransaction*/));
+    } catch (ReoptimizationException& e) {
+        // A hash join build side was far off its estimate. Re-plan the query with its actual
+        // cardinality and run it again from the start.
+        KU_ASSERT(queryID.has_value());
+        progressBar->endProgress(queryID.value());
+        cardinalityFeedback[e.getNodeName()] = e.getCardinality();
+        numReoptimizations++;
+        auto [newPreparedStatement, newCachedStatement] =
+            prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
+                preparedStatement->parameterMap);
+        result = executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID,
+            queryConfig);
+        if (result->getQuerySummary() != nullptr) {
+            result->getQuerySummaryUnsafe()->incrementNumReoptimizations();
+        }
+        cardinalityFeedback.clear();
+        numReoptimizations = 0;
+        return result;
     } catch (std::exception& e) {
         useInternalCatalogEntry_ = false;
         return handleFailedExecution(queryID, e);
@@ -544,6 +917,90 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     return result;
 }
 
+bool ClientContext::canReoptimize(const PreparedStatement& preparedStatement) const {
+    // Aborting an execution rolls back its transaction, so only read-only queries running in their
+    // own auto transaction are re-optimized.
+    return clientConfig.enableAdaptiveReoptimization && preparedStatement.isReadOnly() &&
+           preparedStatement.getStatementType() == StatementType::QUERY &&
+           transactionContext->isAutoTransaction() &&
+           numReoptimizations < PlannerKnobs::MAX_NUM_REOPTIMIZATIONS;
+}
+
+bool ClientContext::canStreamResult(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedStatement) const {
+#ifdef __SINGLE_THREADED__
+    return false;
+#else
+    return preparedStatement.getStatementType() == StatementType::QUERY &&
+           preparedStatement.isReadOnly() && !cachedStatement.logicalPlan->isProfile();
+#endif
+}
+
+std::unique_ptr<QueryResult> ClientContext::startStreamingQueryNoLock(
+    const PreparedStatement& preparedStatement, const CachedPreparedStatement& cachedStatement,
+    uint64_t queryID, const QueryConfig& queryConfig) {
+    auto profiler = std::make_unique<Profiler>();
+    auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, queryID);
+    std::unique_ptr<PhysicalPlan> physicalPlan;
+    // The transaction is committed by the background thread once the query finishes.
+    TransactionHelper::runFuncInTransaction(
+        *transactionContext,
+        [&]() -> void {
+            executionContext->parameterValues = &preparedStatement.parameterMap;
+            auto mapper = PlanMapper(executionContext.get());
+            physicalPlan = mapper.getPhysicalPlan(cachedStatement.logicalPlan.get(),
+                cachedStatement.columns, queryConfig.resultType, queryConfig.arrowConfig,
+                queryConfig.maxNumBufferedTuples);
+            // Parameter values are copied into the evaluators; the statement may be destroyed
+            // while the query is still streaming.
+            executionContext->parameterValues = nullptr;
+        },
+        true /* readOnlyStatement */, false /* isTransactionStatement */,
+        TransactionHelper::TransactionCommitAction::NOT_COMMIT);
+    auto sharedState =
+        physicalPlan->lastOperator->ptrCast<StreamingResultCollector>()->getSharedState();
+    streamingResultState = sharedState;
+    streamingQueryThread = std::thread([this, profiler = std::move(profiler),
+                                           executionContext = std::move(executionContext),
+                                           physicalPlan = std::move(physicalPlan), sharedState]() {
+        try {
+            TransactionHelper::runFuncInTransaction(
+                *transactionContext,
+                [&]() -> void {
+                    localDatabase->queryProcessor->execute(physicalPlan.get(),
+                        executionContext.get());
+                },
+                true /* readOnlyStatement */, false /* isTransactionStatement */,
+                TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
+                    true /*shouldCommitAutoTransaction*/));
+            sharedState->finish();
+        } catch (std::exception& e) {
+            progressBar->endProgress(executionContext->queryID);
+            sharedState->finishWithError(e.what());
+        }
+        const auto memoryManager = storage::MemoryManager::Get(*this);
+        memoryManager->getBufferManager()->getSpillerOrSkip(
+            [](auto& spiller) { spiller.clearFile(); });
+    });
+    // Errors raised before the first tuple is produced are reported as a failed query result.
+    sharedState->waitForResult();
+    if (sharedState->hasError()) {
+        auto errorMessage = sharedState->getErrorMessage();
+        finishStreamingQueryNoLock();
+        return QueryResult::getQueryResultWithError(errorMessage);
+    }
+    return std::make_unique<StreamingQueryResult>(std::move(sharedState));
+}
+
+void ClientContext::finishStreamingQueryNoLock() {
+    if (!streamingQueryThread.joinable()) {
+        return;
+    }
+    streamingResultState->cancel();
+    streamingQueryThread.join();
+    streamingResultState.reset();
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(std::optional<uint64_t> queryID,
     const std::exception& e) const {
     const auto memoryManager = storage::MemoryManager::Get(*this);
@@ -61,6 +61,15 @@ std::unique_ptr<QueryResult> Connection::queryAsArrow(std::string_view query, in
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::queryAsStream(std::string_view query,
+    uint64_t maxNumBufferedTuples) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto queryResult = clientContext->query(query, std::nullopt,
+        {QueryResultType::STREAMING, maxNumBufferedTuples});
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 std::unique_ptr<QueryResult> Connection::queryWithID(std::string_view queryStatement,
     uint64_t queryID) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
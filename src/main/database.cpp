@@ -5,8 +5,11 @@
 #include "extension/mapper_extension.h"
 #include "extension/planner_extension.h"
 #include "extension/transformer_extension.h"
+#include "function/gds/landmarks.h"
 #include "main/client_context.h"
 #include "main/database_manager.h"
+#include "main/plan_cache.h"
+#include "main/query_result_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 #if defined(_WIN32)
@@ -22,6 +25,7 @@
 #include "storage/storage_extension.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
+#include "transaction/table_version_tracker.h"
 #include "transaction/transaction_manager.h"
 
 using namespace kuzu::catalog;
@@ -124,7 +128,11 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
     storageManager = std::make_unique<StorageManager>(databasePath, dbConfig.readOnly,
         dbConfig.enableChecksums, *memoryManager, dbConfig.enableCompression, vfs.get());
     transactionManager = std::make_unique<TransactionManager>(storageManager->getWAL());
+    tableVersionTracker = std::make_unique<TableVersionTracker>();
     databaseManager = std::make_unique<DatabaseManager>();
+    planCache = std::make_unique<PlanCache>();
+    queryResultCache = std::make_unique<QueryResultCache>(*tableVersionTracker);
+    landmarkCache = std::make_unique<function::LandmarkCache>();
 
     extensionManager = std::make_unique<extension::ExtensionManager>();
     dbLifeCycleManager = std::make_shared<DatabaseLifeCycleManager>();
@@ -0,0 +1,148 @@
+#include "main/plan_cache.h"
+
+#include <algorithm>
+
+#include "binder/expression/expression.h" // IWYU pragma: keep
+#include "parser/statement.h"             // IWYU pragma: keep
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace main {
+
+static bool isWhiteSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+std::string PlanCache::normalizeQuery(std::string_view query) {
+    std::string result;
+    result.reserve(query.size());
+    char quote = 0;
+    bool pendingSpace = false;
+    for (auto i = 0u; i < query.size(); i++) {
+        const auto c = query[i];
+        if (quote != 0) {
+            result.push_back(c);
+            if (c == '\\' && quote != '`' && i + 1 < query.size()) {
+                result.push_back(query[++i]);
+            } else if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        if (c == '/' && i + 1 < query.size() && (query[i + 1] == '/' || query[i + 1] == '*')) {
+            // Whitespace is significant in comments, so such queries are only matched verbatim.
+            return std::string(query);
+        }
+        if (isWhiteSpace(c)) {
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            result.push_back(' ');
+            pendingSpace = false;
+        }
+        if (c == '\'' || c == '"' || c == '`') {
+            quote = c;
+        }
+        result.push_back(c);
+    }
+    while (!result.empty() && (result.back() == ';' || result.back() == ' ')) {
+        result.pop_back();
+    }
+    return result;
+}
+
+std::string PlanCache::getKey(const std::string& normalizedQuery,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters,
+    const std::string& settings) {
+    std::vector<std::string> parameterTypes;
+    parameterTypes.reserve(parameters.size());
+    for (auto& [name, value] : parameters) {
+        // Binding resolves functions and casts by the types of the parameters.
+        parameterTypes.push_back(name + ":" + value->getDataType().toString());
+    }
+    std::sort(parameterTypes.begin(), parameterTypes.end());
+    auto key = normalizedQuery;
+    key += '\0';
+    for (auto& parameterType : parameterTypes) {
+        key += parameterType;
+        key += '\0';
+    }
+    key += '\0';
+    key += settings;
+    return key;
+}
+
+static bool hasSameValues(const std::unordered_map<std::string, std::shared_ptr<Value>>& left,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& right) {
+    if (left.size() != right.size()) {
+        return false;
+    }
+    for (auto& [name, value] : left) {
+        if (!right.contains(name) || !(*value == *right.at(name))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const PlanCacheEntry> PlanCache::lookup(const std::string& key,
+    uint64_t schemaVersion,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters) {
+    std::unique_lock lck{mtx};
+    if (!slots.contains(key)) {
+        return nullptr;
+    }
+    auto& slot = slots.at(key);
+    if (slot.entry->schemaVersion != schemaVersion) {
+        eraseNoLock(key);
+        return nullptr;
+    }
+    if (slot.entry->parameterValuesUsed &&
+        !hasSameValues(slot.entry->parameterValues, parameters)) {
+        // The caller compiles the statement for its values and replaces the entry.
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, slot.lruIt);
+    numHits++;
+    return slot.entry;
+}
+
+void PlanCache::insert(const std::string& key, std::shared_ptr<const PlanCacheEntry> entry) {
+    std::unique_lock lck{mtx};
+    if (slots.contains(key)) {
+        eraseNoLock(key);
+    }
+    while (slots.size() >= MAX_NUM_ENTRIES) {
+        const auto lruKey = lruList.back();
+        eraseNoLock(lruKey);
+    }
+    lruList.push_front(key);
+    slots.insert({key, Slot{std::move(entry), lruList.begin()}});
+}
+
+void PlanCache::clear() {
+    std::unique_lock lck{mtx};
+    slots.clear();
+    lruList.clear();
+}
+
+uint64_t PlanCache::getNumEntries() {
+    std::unique_lock lck{mtx};
+    return slots.size();
+}
+
+uint64_t PlanCache::getNumHits() {
+    std::unique_lock lck{mtx};
+    return numHits;
+}
+
+void PlanCache::eraseNoLock(const std::string& key) {
+    KU_ASSERT(slots.contains(key));
+    lruList.erase(slots.at(key).lruIt);
+    slots.erase(key);
+}
+
+} // namespace main
+} // namespace kuzu
@@ -0,0 +1,143 @@
+#include "main/query_result/streaming_query_result.h"
+
+#include "common/arrow/arrow_row_batch.h"
+#include "common/exception/runtime.h"
+#include "processor/operator/streaming_result_collector.h"
+#include "processor/result/factorized_table.h"
+#include "processor/result/flat_tuple.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+StreamingQueryResult::StreamingQueryResult(
+    std::shared_ptr<StreamingResultCollectorSharedState> sharedState)
+    : QueryResult{type_}, sharedState{std::move(sharedState)} {}
+
+StreamingQueryResult::~StreamingQueryResult() {
+    sharedState->cancel();
+    if (!dbLifeCycleManager) {
+        return;
+    }
+    if (table) {
+        table->setPreventDestruction(dbLifeCycleManager->isDatabaseClosed);
+    }
+    for (auto& drainedTable : drainedTables) {
+        drainedTable->setPreventDestruction(dbLifeCycleManager->isDatabaseClosed);
+    }
+}
+
+uint64_t StreamingQueryResult::getNumTuples() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    while (!drained) {
+        auto drainedTable = sharedState->pop();
+        if (drainedTable == nullptr) {
+            drained = true;
+        } else {
+            numTuples += drainedTable->getTotalNumFlatTuples();
+            drainedTables.push_back(std::move(drainedTable));
+        }
+    }
+    return numTuples;
+}
+
+std::shared_ptr<FactorizedTable> StreamingQueryResult::nextTable() const {
+    if (!drainedTables.empty()) {
+        auto result = std::move(drainedTables.front());
+        drainedTables.pop_front();
+        return result;
+    }
+    if (drained) {
+        return nullptr;
+    }
+    auto result = sharedState->pop();
+    if (result == nullptr) {
+        drained = true;
+    } else {
+        numTuples += result->getTotalNumFlatTuples();
+    }
+    return result;
+}
+
+bool StreamingQueryResult::hasNext() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    // Cancelling the query discards the tables that have not been read, so the rest of the table
+    // being read is not returned either. Tuples buffered by getNumTuples() stay readable.
+    if (!drained) {
+        sharedState->throwIfCancelled();
+    }
+    while (!exhausted && (iterator == nullptr || !iterator->hasNext())) {
+        iterator.reset();
+        table = nextTable();
+        if (table == nullptr) {
+            exhausted = true;
+        } else {
+            iterator = std::make_unique<FactorizedTableIterator>(*table);
+        }
+    }
+    return !exhausted;
+}
+
+std::shared_ptr<FlatTuple> StreamingQueryResult::getNext() {
+    if (!hasNext()) {
+        throw RuntimeException(
+            "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
+    }
+    iterator->getNext(*tuple);
+    return tuple;
+}
+
+void StreamingQueryResult::resetIterator() {
+    throw RuntimeException("Cannot reset the iterator of a streaming query result, whose tuples "
+                           "can only be read once. Use Connection::query to get a result that can "
+                           "be iterated multiple times.");
+}
+
+std::string StreamingQueryResult::toString() const {
+    checkDatabaseClosedOrThrow();
+    if (!isSuccess()) {
+        return errMsg;
+    }
+    std::string result;
+    // print header
+    for (auto i = 0u; i < columnNames.size(); ++i) {
+        if (i != 0) {
+            result += "|";
+        }
+        result += columnNames[i];
+    }
+    result += "\n";
+    auto tuple_ = FlatTuple(this->columnTypes);
+    while (hasNext()) {
+        iterator->getNext(tuple_);
+        result += tuple_.toString();
+    }
+    return result;
+}
+
+bool StreamingQueryResult::hasNextArrowChunk() {
+    return hasNext();
+}
+
+std::unique_ptr<ArrowArray> StreamingQueryResult::getNextArrowChunk(int64_t chunkSize) {
+    checkDatabaseClosedOrThrow();
+    auto rowBatch =
+        std::make_unique<ArrowRowBatch>(columnTypes, chunkSize, false /* fallbackExtensionTypes */);
+    auto rowBatchSize = 0u;
+    while (rowBatchSize < chunkSize) {
+        if (!hasNext()) {
+            break;
+        }
+        iterator->getNext(*tuple);
+        rowBatch->append(*tuple);
+        rowBatchSize++;
+    }
+    return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
+}
+
+} // namespace main
+} // namespace kuzu
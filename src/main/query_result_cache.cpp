@@ -0,0 +1,76 @@
+#include "main/query_result_cache.h"
+
+#include "processor/result/factorized_table.h" // IWYU pragma: keep
+
+namespace kuzu {
+namespace main {
+
+std::shared_ptr<const QueryResultCacheEntry> QueryResultCache::lookup(const std::string& key,
+    uint64_t schemaVersion) {
+    std::unique_lock lck{mtx};
+    if (!slots.contains(key)) {
+        return nullptr;
+    }
+    auto& slot = slots.at(key);
+    if (slot.entry->schemaVersion != schemaVersion ||
+        !tableVersionTracker.isUpToDate(slot.entry->tableVersions)) {
+        eraseNoLock(key);
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, slot.lruIt);
+    numHits++;
+    return slot.entry;
+}
+
+void QueryResultCache::insert(const std::string& key,
+    std::shared_ptr<const QueryResultCacheEntry> entry, uint64_t memoryBudget) {
+    std::unique_lock lck{mtx};
+    if (slots.contains(key)) {
+        eraseNoLock(key);
+    }
+    if (entry->memoryUsage > memoryBudget ||
+        !tableVersionTracker.isUpToDate(entry->tableVersions)) {
+        return;
+    }
+    while (memoryUsage + entry->memoryUsage > memoryBudget) {
+        const auto lruKey = lruList.back();
+        eraseNoLock(lruKey);
+    }
+    memoryUsage += entry->memoryUsage;
+    lruList.push_front(key);
+    slots.insert({key, Slot{std::move(entry), lruList.begin()}});
+}
+
+void QueryResultCache::clear() {
+    std::unique_lock lck{mtx};
+    slots.clear();
+    lruList.clear();
+    memoryUsage = 0;
+}
+
+uint64_t QueryResultCache::getNumEntries() {
+    std::unique_lock lck{mtx};
+    return slots.size();
+}
+
+uint64_t QueryResultCache::getMemoryUsage() {
+    std::unique_lock lck{mtx};
+    return memoryUsage;
+}
+
+uint64_t QueryResultCache::getNumHits() {
+    std::unique_lock lck{mtx};
+    return numHits;
+}
+
+void QueryResultCache::eraseNoLock(const std::string& key) {
+    KU_ASSERT(slots.contains(key));
+    auto& slot = slots.at(key);
+    KU_ASSERT(memoryUsage >= slot.entry->memoryUsage);
+    memoryUsage -= slot.entry->memoryUsage;
+    lruList.erase(slot.lruIt);
+    slots.erase(key);
+}
+
+} // namespace main
+} // namespace kuzu
@@ -27,6 +27,14 @@ void QuerySummary::incrementExecutionTime(double increment) {
     executionTime += increment;
 }
 
+uint64_t QuerySummary::getNumReoptimizations() const {
+    return numReoptimizations;
+}
+
+void QuerySummary::incrementNumReoptimizations() {
+    numReoptimizations++;
+}
+
 bool QuerySummary::isExplain() const {
     return preparedSummary.statementType == StatementType::EXPLAIN;
 }
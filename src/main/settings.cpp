@@ -2,8 +2,11 @@
 
 #include "common/exception/runtime.h"
 #include "common/task_system/progress_bar.h"
+#include "common/task_system/task_scheduler.h"
 #include "main/client_context.h"
+#include "main/database.h"
 #include "main/db_config.h"
+#include "main/query_result_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
@@ -68,6 +71,20 @@ common::Value SparseFrontierThresholdSetting::getSetting(const ClientContext* co
     return common::Value(context->getClientConfig()->sparseFrontierThreshold);
 }
 
+void WeightedShortestPathLandmarksSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto numLandmarks = parameter.getValue<int64_t>();
+    if (numLandmarks < 0 || numLandmarks > 64) {
+        throw common::RuntimeException("The number of landmarks must be between 0 and 64.");
+    }
+    context->getClientConfigUnsafe()->weightedShortestPathLandmarks = numLandmarks;
+}
+
+common::Value WeightedShortestPathLandmarksSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->weightedShortestPathLandmarks);
+}
+
 void EnableSemiMaskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->enableSemiMask = parameter.getValue<bool>();
@@ -197,6 +214,63 @@ common::Value EnableInternalCatalogSetting::getSetting(const ClientContext* cont
     return common::Value::createValue(context->getClientConfig()->enableInternalCatalog);
 }
 
+void EnableInterPipelineParallelismSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enableInterPipelineParallelism = parameter.getValue<bool>();
+}
+
+common::Value EnableInterPipelineParallelismSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->enableInterPipelineParallelism);
+}
+
+void EnableAdaptiveReoptimizationSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enableAdaptiveReoptimization = parameter.getValue<bool>();
+}
+
+common::Value EnableAdaptiveReoptimizationSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->enableAdaptiveReoptimization);
+}
+
+void EnablePlanCacheSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enablePlanCache = parameter.getValue<bool>();
+}
+
+common::Value EnablePlanCacheSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->enablePlanCache);
+}
+
+void ResultCacheSizeSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto resultCacheSize = parameter.getValue<int64_t>();
+    if (resultCacheSize < 0) {
+        throw common::RuntimeException("Result cache size cannot be negative.");
+    }
+    context->getDBConfigUnsafe()->resultCacheSize = resultCacheSize;
+    // Results cached under the previous budget are dropped rather than evicted one by one.
+    context->getDatabase()->getQueryResultCache()->clear();
+}
+
+common::Value ResultCacheSizeSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getDBConfig()->resultCacheSize);
+}
+
+void WorkloadClassSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    auto workloadClass = common::TaskScheduler::Get(*context)
+                             ->getWorkloadClassManager()
+                             ->getWorkloadClass(parameter.getValue<std::string>());
+    context->getClientConfigUnsafe()->workloadClass = workloadClass.name;
+    context->getClientConfigUnsafe()->workloadClassMaxNumThreads = workloadClass.maxNumThreads;
+}
+
+common::Value WorkloadClassSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->workloadClass);
+}
+
 void SpillToDiskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getDBConfigUnsafe()->enableSpillingToDisk = parameter.getValue<bool>();
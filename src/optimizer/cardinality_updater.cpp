@@ -61,6 +61,11 @@ void CardinalityUpdater::visitOperatorSwitchWithDefault(planner::LogicalOperator
         visitAggregate(op);
         break;
     }
+    case planner::LogicalOperatorType::PATH_PROPERTY_PROBE: {
+        // The recursive extend below it is a source without an estimate. Keep the number of paths
+        // estimated when the recursive join was planned.
+        break;
+    }
     default: {
         visitOperatorDefault(op);
         break;
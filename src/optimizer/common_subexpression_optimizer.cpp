@@ -0,0 +1,192 @@
+#include "optimizer/common_subexpression_optimizer.h"
+
+#include "binder/expression_visitor.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_projection.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+// Counts the occurrences of function expressions that are not yet in the scope of the input
+// schema. The children of CASE expressions are not visited because they are evaluated
+// conditionally, and neither are lambda functions whose bodies depend on the lambda variables.
+class CommonSubexpressionCollector {
+public:
+    explicit CommonSubexpressionCollector(const Schema& schema) : schema{schema} {}
+
+    void collect(const std::shared_ptr<Expression>& expression) {
+        if (schema.isExpressionInScope(*expression) || !canVisitChildren(*expression)) {
+            return;
+        }
+        if (isCandidate(*expression)) {
+            if (!numOccurrences.contains(expression)) {
+                numOccurrences.insert({expression, 0});
+                candidates.push_back(expression);
+            }
+            if (++numOccurrences.at(expression) > 1) {
+                // The children have been counted with the first occurrence.
+                return;
+            }
+        }
+        for (auto& child : expression->getChildren()) {
+            collect(child);
+        }
+    }
+
+    bool hasCollected(const std::shared_ptr<Expression>& expression) const {
+        return numOccurrences.contains(expression);
+    }
+
+    expression_vector getCommonExpressions() const {
+        expression_vector result;
+        for (auto& candidate : candidates) {
+            if (numOccurrences.at(candidate) > 1) {
+                result.push_back(candidate);
+            }
+        }
+        return result;
+    }
+
+private:
+    static bool canVisitChildren(const Expression& expression) {
+        const auto type = expression.expressionType;
+        if (type != ExpressionType::FUNCTION && !ExpressionTypeUtil::isBoolean(type) &&
+            !ExpressionTypeUtil::isComparison(type) && !ExpressionTypeUtil::isNullOperator(type)) {
+            return false;
+        }
+        for (auto& child : expression.getChildren()) {
+            if (child->expressionType == ExpressionType::LAMBDA) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool isCandidate(const Expression& expression) {
+        return expression.expressionType == ExpressionType::FUNCTION &&
+               !ConstantExpressionVisitor::isConstant(expression) &&
+               !ExpressionVisitor::isNonDeterministic(expression);
+    }
+
+private:
+    const Schema& schema;
+    expression_map<uint64_t> numOccurrences;
+    // Candidates in the order of their first occurrence.
+    expression_vector candidates;
+};
+
+void CommonSubexpressionOptimizer::rewrite(LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<LogicalOperator> CommonSubexpressionOptimizer::visitOperator(
+    const std::shared_ptr<LogicalOperator>& op) {
+    // bottom-up traversal
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    if (op->getOperatorType() != LogicalOperatorType::PROJECTION) {
+        // A filter below a projection is rewritten together with the projection.
+        for (auto i = 0u; i < op->getNumChildren(); ++i) {
+            if (op->getChild(i)->getOperatorType() == LogicalOperatorType::FILTER) {
+                op->setChild(i, rewriteFilter(op->getChild(i)));
+            }
+        }
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+std::shared_ptr<LogicalOperator> CommonSubexpressionOptimizer::rewriteFilter(
+    std::shared_ptr<LogicalOperator> op) {
+    auto& filter = op->constCast<LogicalFilter>();
+    auto expressionsInScope = filter.getChild(0)->getSchema()->getExpressionsInScope();
+    auto collector = CommonSubexpressionCollector(*filter.getChild(0)->getSchema());
+    collector.collect(filter.getPredicate());
+    auto expressionsToEvaluate = collector.getCommonExpressions();
+    if (expressionsToEvaluate.empty()) {
+        return op;
+    }
+    preAppendProjections(op.get(), expressionsToEvaluate);
+    op->computeFlatSchema();
+    // Project the evaluated expressions out again so that the operators above see the same scope.
+    auto projection = std::make_shared<LogicalProjection>(expressionsInScope, op);
+    projection->computeFlatSchema();
+    return projection;
+}
+
+std::shared_ptr<LogicalOperator> CommonSubexpressionOptimizer::visitProjectionReplace(
+    std::shared_ptr<LogicalOperator> op) {
+    auto& projection = op->constCast<LogicalProjection>();
+    auto child = projection.getChild(0);
+    if (child->getOperatorType() == LogicalOperatorType::FILTER) {
+        // The filter evaluates its predicate on every input tuple anyway, so expressions that
+        // repeat in the predicate or that it shares with the projection are evaluated below it.
+        auto& filter = child->constCast<LogicalFilter>();
+        auto filterCollector = CommonSubexpressionCollector(*filter.getChild(0)->getSchema());
+        filterCollector.collect(filter.getPredicate());
+        auto collector = CommonSubexpressionCollector(*filter.getChild(0)->getSchema());
+        collector.collect(filter.getPredicate());
+        for (auto& expression : projection.getExpressionsToProject()) {
+            collector.collect(expression);
+        }
+        expression_vector expressionsToEvaluate;
+        for (auto& expression : collector.getCommonExpressions()) {
+            if (filterCollector.hasCollected(expression)) {
+                expressionsToEvaluate.push_back(expression);
+            }
+        }
+        if (!expressionsToEvaluate.empty()) {
+            preAppendProjections(child.get(), expressionsToEvaluate);
+            child->computeFlatSchema();
+        }
+    }
+    auto collector = CommonSubexpressionCollector(*child->getSchema());
+    for (auto& expression : projection.getExpressionsToProject()) {
+        collector.collect(expression);
+    }
+    preAppendProjections(op.get(), collector.getCommonExpressions());
+    return op;
+}
+
+static bool containsAny(const Expression& expression, const expression_set& expressions) {
+    for (auto& child : expression.getChildren()) {
+        if (expressions.contains(child) || containsAny(*child, expressions)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommonSubexpressionOptimizer::preAppendProjections(LogicalOperator* op,
+    expression_vector expressions) {
+    while (!expressions.empty()) {
+        auto pendingExpressions = expression_set{expressions.begin(), expressions.end()};
+        expression_vector expressionsToEvaluate;
+        expression_vector expressionsToDefer;
+        for (auto& expression : expressions) {
+            if (containsAny(*expression, pendingExpressions)) {
+                expressionsToDefer.push_back(expression);
+            } else {
+                expressionsToEvaluate.push_back(expression);
+            }
+        }
+        KU_ASSERT(!expressionsToEvaluate.empty());
+        auto child = op->getChild(0);
+        auto expressionsToProject = child->getSchema()->getExpressionsInScope();
+        expressionsToProject.insert(expressionsToProject.end(), expressionsToEvaluate.begin(),
+            expressionsToEvaluate.end());
+        auto projection = std::make_shared<LogicalProjection>(expressionsToProject, child);
+        projection->computeFlatSchema();
+        op->setChild(0, std::move(projection));
+        expressions = std::move(expressionsToDefer);
+    }
+}
+
+} // namespace optimizer
+} // namespace kuzu
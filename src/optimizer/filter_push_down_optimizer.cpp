@@ -1,5 +1,6 @@
 #include "optimizer/filter_push_down_optimizer.h"
 
+#include "binder/expression/expression_util.h"
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
@@ -70,7 +71,8 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitFilterReplace(
         }
         // Ignore if literal is True.
     } else {
-        predicateSet.addPredicate(predicate);
+        // Filters are visited top-down, so this filter is evaluated before the collected ones.
+        predicateSet.addPredicateBefore(predicate);
     }
     return visitOperator(filter.getChild(0));
 }
@@ -103,7 +105,11 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     auto buildSchema = op->getChild(1)->getSchema();
     expression_vector predicates;
     std::vector<join_condition_t> joinConditions;
-    for (auto& predicate : remainingPSet.equalityPredicates) {
+    for (auto& predicate : remainingPSet.predicates) {
+        if (predicate->expressionType != ExpressionType::EQUALS) {
+            predicates.push_back(predicate);
+            continue;
+        }
         auto left = predicate->getChild(0);
         auto right = predicate->getChild(1);
         // TODO(Xiyang): this can only rewrite left = right, we should also be able to do
@@ -127,8 +133,6 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     hashJoin->getSIPInfoUnsafe().position = SemiMaskPosition::PROHIBIT;
     hashJoin->computeFlatSchema();
     // Apply remaining predicates.
-    predicates.insert(predicates.end(), remainingPSet.nonEqualityPredicates.begin(),
-        remainingPSet.nonEqualityPredicates.end());
     if (predicates.empty()) {
         return hashJoin;
     }
@@ -189,6 +193,7 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
     // Apply index scan
     auto tableIDs = scan.getTableIDs();
     std::shared_ptr<Expression> primaryKeyEqualityComparison = nullptr;
+    auto predicates = predicateSet.predicates;
     if (tableIDs.size() == 1) {
         primaryKeyEqualityComparison = predicateSet.popNodePKEqualityComparison(*nodeID);
     }
@@ -200,8 +205,8 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             scan.setExtraInfo(std::move(extraInfo));
             scan.computeFlatSchema();
         } else {
-            // Cannot rewrite and add predicate back.
-            predicateSet.addPredicate(primaryKeyEqualityComparison);
+            // Cannot rewrite and add predicate back at its position.
+            predicateSet.predicates = std::move(predicates);
         }
     }
     return finishPushDown(op);
@@ -275,11 +280,11 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::appendFilter(
 }
 
 void PredicateSet::addPredicate(std::shared_ptr<Expression> predicate) {
-    if (predicate->expressionType == ExpressionType::EQUALS) {
-        equalityPredicates.push_back(std::move(predicate));
-    } else {
-        nonEqualityPredicates.push_back(std::move(predicate));
-    }
+    predicates.push_back(std::move(predicate));
+}
+
+void PredicateSet::addPredicateBefore(std::shared_ptr<Expression> predicate) {
+    predicates.insert(predicates.begin(), std::move(predicate));
 }
 
 static bool isNodePrimaryKey(const Expression& expression, const Expression& nodeID) {
@@ -298,8 +303,11 @@ static bool isNodePrimaryKey(const Expression& expression, const Expression& nod
 std::shared_ptr<Expression> PredicateSet::popNodePKEqualityComparison(const Expression& nodeID) {
     // We pop when the first primary key equality comparison is found.
     auto resultPredicateIdx = INVALID_IDX;
-    for (auto i = 0u; i < equalityPredicates.size(); ++i) {
-        auto predicate = equalityPredicates[i];
+    for (auto i = 0u; i < predicates.size(); ++i) {
+        auto predicate = predicates[i];
+        if (predicate->expressionType != ExpressionType::EQUALS) {
+            continue;
+        }
         if (isNodePrimaryKey(*predicate->getChild(0), nodeID)) {
             resultPredicateIdx = i;
             break;
@@ -314,17 +322,31 @@ std::shared_ptr<Expression> PredicateSet::popNodePKEqualityComparison(const Expr
         }
     }
     if (resultPredicateIdx != INVALID_IDX) {
-        auto result = equalityPredicates[resultPredicateIdx];
-        equalityPredicates.erase(equalityPredicates.begin() + resultPredicateIdx);
+        auto result = predicates[resultPredicateIdx];
+        predicates.erase(predicates.begin() + resultPredicateIdx);
         return result;
     }
     return nullptr;
 }
 
 expression_vector PredicateSet::getAllPredicates() {
+    for (auto& predicate : predicates) {
+        if (!ExpressionUtil::canEvaluateWithoutError(*predicate)) {
+            // A predicate may be guarded by the ones evaluated before it.
+            return predicates;
+        }
+    }
     expression_vector result;
-    result.insert(result.end(), equalityPredicates.begin(), equalityPredicates.end());
-    result.insert(result.end(), nonEqualityPredicates.begin(), nonEqualityPredicates.end());
+    for (auto& predicate : predicates) {
+        if (predicate->expressionType == ExpressionType::EQUALS) {
+            result.push_back(predicate);
+        }
+    }
+    for (auto& predicate : predicates) {
+        if (predicate->expressionType != ExpressionType::EQUALS) {
+            result.push_back(predicate);
+        }
+    }
     return result;
 }
 
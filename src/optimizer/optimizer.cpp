@@ -4,6 +4,7 @@
 #include "optimizer/acc_hash_join_optimizer.h"
 #include "optimizer/agg_key_dependency_optimizer.h"
 #include "optimizer/cardinality_updater.h"
+#include "optimizer/common_subexpression_optimizer.h"
 #include "optimizer/correlated_subquery_unnest_solver.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
@@ -51,6 +52,11 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto topKOptimizer = TopKOptimizer();
         topKOptimizer.rewrite(plan);
 
+        // CommonSubexpressionOptimizer should be applied after projection push down because the
+        // projections it appends keep all expressions in scope.
+        auto commonSubexpressionOptimizer = CommonSubexpressionOptimizer();
+        commonSubexpressionOptimizer.rewrite(plan);
+
         auto factorizationRewriter = FactorizationRewriter();
         factorizationRewriter.rewrite(plan);
 
@@ -59,15 +65,19 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* contex
         auto aggKeyDependencyOptimizer = AggKeyDependencyOptimizer();
         aggKeyDependencyOptimizer.rewrite(plan);
 
-        // for EXPLAIN LOGICAL we need to update the cardinalities for the optimized plan
+        // for EXPLAIN LOGICAL and adaptive re-optimization, which compares hash join build sides
+        // against their estimates, we need to update the cardinalities for the optimized plan
         // we don't need to do this otherwise as we don't use the cardinalities after planning
+        auto updateCardinalities = context->getClientConfig()->enableAdaptiveReoptimization;
         if (plan->getLastOperatorRef().getOperatorType() == planner::LogicalOperatorType::EXPLAIN) {
             const auto& explain = plan->getLastOperatorRef().cast<planner::LogicalExplain>();
-            if (explain.getExplainType() == common::ExplainType::LOGICAL_PLAN) {
-                auto cardinalityUpdater = CardinalityUpdater(cardinalityEstimator,
-                    transaction::Transaction::Get(*context));
-                cardinalityUpdater.rewrite(plan);
-            }
+            updateCardinalities = updateCardinalities ||
+                                  explain.getExplainType() == common::ExplainType::LOGICAL_PLAN;
+        }
+        if (updateCardinalities) {
+            auto cardinalityUpdater =
+                CardinalityUpdater(cardinalityEstimator, transaction::Transaction::Get(*context));
+            cardinalityUpdater.rewrite(plan);
         }
     } else {
         // we still need to compute the schema for each operator even if we have optimizations
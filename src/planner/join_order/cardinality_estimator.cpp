@@ -1,8 +1,14 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "common/types/value/nested.h"
+#include "function/list/vector_list_functions.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
+#include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_aggregate.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
@@ -49,6 +55,9 @@ void CardinalityEstimator::init(const NodeExpression& node) {
     }
     if (!nodeIDName2dom.contains(key)) {
         nodeIDName2dom.insert({key, numNodes});
+        if (cardinalityFeedback.contains(node.getUniqueName())) {
+            rectifyCardinality(*node.getInternalID(), cardinalityFeedback.at(node.getUniqueName()));
+        }
     }
 }
 
@@ -111,11 +120,50 @@ uint64_t CardinalityEstimator::estimateCrossProduct(const LogicalOperator& probe
     return atLeastOne(probeOp.getCardinality() * buildOp.getCardinality());
 }
 
+static const LogicalExtend* findExtend(const LogicalOperator* op) {
+    if (op->getOperatorType() == LogicalOperatorType::EXTEND) {
+        return &op->constCast<LogicalExtend>();
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (auto extend = findExtend(op->getChild(i).get())) {
+            return extend;
+        }
+    }
+    return nullptr;
+}
+
 uint64_t CardinalityEstimator::estimateIntersect(const expression_vector& joinNodeIDs,
     const LogicalOperator& probeOp, const std::vector<LogicalOperator*>& buildOps) const {
     // Formula 1: treat intersect as a Filter on probe side.
     uint64_t estCardinality1 =
         probeOp.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    // If the degrees of all build sides are known, estimate the size of the intersection of the
+    // adjacency lists of a probe tuple instead, assuming that lists are independent. The smallest
+    // list is the starting point and every other list keeps a neighbour with probability
+    // avgDegree / numNbrs.
+    std::vector<double> avgDegrees;
+    double numNbrs = 0;
+    for (auto& buildOp : buildOps) {
+        auto extend = findExtend(buildOp);
+        if (extend == nullptr) {
+            break;
+        }
+        auto degrees = getExtensionDegrees(*extend->getRel(), *extend->getBoundNode(),
+            Transaction::Get(*context));
+        if (!degrees.has_value()) {
+            break;
+        }
+        avgDegrees.push_back(degrees->avgDegree);
+        numNbrs = getNodeIDDom(extend->getNbrNode()->getInternalID()->getUniqueName());
+    }
+    if (!avgDegrees.empty() && avgDegrees.size() == buildOps.size()) {
+        std::sort(avgDegrees.begin(), avgDegrees.end());
+        auto numIntersectedNbrs = avgDegrees[0];
+        for (auto i = 1u; i < avgDegrees.size(); ++i) {
+            numIntersectedNbrs *= std::min(1.0, avgDegrees[i] / atLeastOne(numNbrs));
+        }
+        estCardinality1 = probeOp.getCardinality() * numIntersectedNbrs;
+    }
     // Formula 2: assume independence on join conditions.
     cardinality_t denominator = 1u;
     for (auto& joinNodeID : joinNodeIDs) {
@@ -150,45 +198,225 @@ static bool isSingleLabelledProperty(const Expression& expression) {
     return expression.constCast<PropertyExpression>().isSingleLabel();
 }
 
+static const storage::ColumnStats* getColumnStatsIfPossible(main::ClientContext* context,
+    const Expression& expression,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    if (!isSingleLabelledProperty(expression)) {
+        return nullptr;
+    }
+    auto& propertyExpr = expression.constCast<PropertyExpression>();
+    auto tableID = propertyExpr.getSingleTableID();
+    if (!nodeTableStats.contains(tableID) || !propertyExpr.hasProperty(tableID)) {
+        return nullptr;
+    }
+    auto transaction = Transaction::Get(*context);
+    auto entry = catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
+    auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
+    if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+        return nullptr;
+    }
+    return &nodeTableStats.at(tableID).getColumnStats(columnID);
+}
+
 static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext* context,
     const Expression& predicate,
     const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
     KU_ASSERT(predicate.getNumChildren() >= 1);
-    if (isSingleLabelledProperty(*predicate.getChild(0))) {
-        auto& propertyExpr = predicate.getChild(0)->cast<PropertyExpression>();
-        auto tableID = propertyExpr.getSingleTableID();
-        if (nodeTableStats.contains(tableID) && propertyExpr.hasProperty(tableID)) {
-            auto transaction = Transaction::Get(*context);
-            auto entry =
-                catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
-            auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
-            if (columnID != INVALID_COLUMN_ID && columnID != ROW_IDX_COLUMN_ID) {
-                auto& stats = nodeTableStats.at(tableID);
-                return atLeastOne(stats.getNumDistinctValues(columnID));
-            }
-        }
+    auto columnStats = getColumnStatsIfPossible(context, *predicate.getChild(0), nodeTableStats);
+    if (columnStats != nullptr) {
+        return atLeastOne(columnStats->getNumDistinctValues());
     }
     return {};
 }
 
+// Column stats describe the non-null values of a column only. Null values never satisfy a
+// comparison, so selectivities estimated from column stats are scaled by the fraction of rows whose
+// value is not null.
+static double getNonNullFraction(const Expression& property,
+    const storage::ColumnStats& columnStats,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    auto tableID = property.constCast<PropertyExpression>().getSingleTableID();
+    auto numRows = nodeTableStats.at(tableID).getTableCard();
+    if (numRows == 0) {
+        return 1;
+    }
+    return std::min(1.0, static_cast<double>(columnStats.getNumNonNullValues()) / numRows);
+}
+
+static bool isLiteralOfType(const Expression& expression, const LogicalType& type) {
+    return expression.expressionType == ExpressionType::LITERAL && expression.dataType == type;
+}
+
+// Selectivity of a comparison between a property and a literal, estimated from the most common
+// values and the histogram of the property's column.
+static std::optional<double> estimateComparisonSelectivity(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    auto expressionType = predicate.expressionType;
+    auto property = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (!isLiteralOfType(*literal, property->dataType)) {
+        if (!isLiteralOfType(*property, literal->dataType)) {
+            return std::nullopt;
+        }
+        // Normalize "literal op property" into "property op' literal".
+        std::swap(property, literal);
+        switch (expressionType) {
+        case ExpressionType::GREATER_THAN:
+            expressionType = ExpressionType::LESS_THAN;
+            break;
+        case ExpressionType::GREATER_THAN_EQUALS:
+            expressionType = ExpressionType::LESS_THAN_EQUALS;
+            break;
+        case ExpressionType::LESS_THAN:
+            expressionType = ExpressionType::GREATER_THAN;
+            break;
+        case ExpressionType::LESS_THAN_EQUALS:
+            expressionType = ExpressionType::GREATER_THAN_EQUALS;
+            break;
+        default:
+            break;
+        }
+    }
+    auto columnStats = getColumnStatsIfPossible(context, *property, nodeTableStats);
+    if (columnStats == nullptr) {
+        return std::nullopt;
+    }
+    auto& value = literal->constCast<LiteralExpression>().value;
+    std::optional<double> selectivity;
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        selectivity = columnStats->estimateEqualitySelectivity(value);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        selectivity = columnStats->estimateRangeSelectivity(value, true /* lessThan */,
+            false /* inclusive */);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        selectivity = columnStats->estimateRangeSelectivity(value, true /* lessThan */,
+            true /* inclusive */);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        selectivity = columnStats->estimateRangeSelectivity(value, false /* lessThan */,
+            false /* inclusive */);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        selectivity = columnStats->estimateRangeSelectivity(value, false /* lessThan */,
+            true /* inclusive */);
+    } break;
+    default:
+        break;
+    }
+    if (!selectivity.has_value()) {
+        return std::nullopt;
+    }
+    return selectivity.value() * getNonNullFraction(*property, *columnStats, nodeTableStats);
+}
+
+// Selectivity of "property IN [literals]", estimated as the sum of the selectivities of
+// "property = literal" for all literals.
+static std::optional<double> estimateInListSelectivity(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    auto list = predicate.getChild(0);
+    auto property = predicate.getChild(1);
+    if (list->expressionType != ExpressionType::LITERAL ||
+        list->dataType.getLogicalTypeID() != LogicalTypeID::LIST ||
+        ListType::getChildType(list->dataType) != property->dataType) {
+        return std::nullopt;
+    }
+    auto columnStats = getColumnStatsIfPossible(context, *property, nodeTableStats);
+    if (columnStats == nullptr) {
+        return std::nullopt;
+    }
+    auto& value = list->constCast<LiteralExpression>().value;
+    if (value.isNull()) {
+        return std::nullopt;
+    }
+    double selectivity = 0;
+    for (auto i = 0u; i < NestedVal::getChildrenSize(&value); ++i) {
+        auto selectivityOfValue =
+            columnStats->estimateEqualitySelectivity(*NestedVal::getChildVal(&value, i));
+        if (!selectivityOfValue.has_value()) {
+            return std::nullopt;
+        }
+        selectivity += selectivityOfValue.value();
+    }
+    return std::min(1.0, selectivity) * getNonNullFraction(*property, *columnStats, nodeTableStats);
+}
+
+// Collects the variables whose properties the expression reads. Returns false if the expression
+// depends on anything else than properties and literals, e.g. a subquery.
+static bool collectPropertyVarNames(const Expression& expression,
+    std::unordered_set<std::string>& varNames) {
+    switch (expression.expressionType) {
+    case ExpressionType::PROPERTY: {
+        varNames.insert(expression.constCast<PropertyExpression>().getVariableName());
+        return true;
+    }
+    case ExpressionType::SUBQUERY:
+    case ExpressionType::VARIABLE:
+    case ExpressionType::PATTERN:
+    case ExpressionType::PATH:
+        return false;
+    default:
+        break;
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(expression)) {
+        if (!collectPropertyVarNames(*child, varNames)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     const Expression& predicate) const {
+    if (!cardinalityFeedback.empty()) {
+        // The observed cardinality of a node already accounts for the predicates on it.
+        std::unordered_set<std::string> varNames;
+        if (collectPropertyVarNames(predicate, varNames) && !varNames.empty() &&
+            std::all_of(varNames.begin(), varNames.end(),
+                [&](const auto& name) { return cardinalityFeedback.contains(name); })) {
+            return childPlan.getCardinality();
+        }
+    }
     if (predicate.expressionType == ExpressionType::EQUALS) {
         if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
             return 1;
-        } else {
-            const auto numDistinctValues =
-                getTableStatsIfPossible(context, predicate, nodeTableStats);
-            if (numDistinctValues.has_value()) {
-                return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
-            }
-            return atLeastOne(
-                childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
         }
-    } else {
+    }
+    std::optional<double> selectivity;
+    switch (predicate.expressionType) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        selectivity = estimateComparisonSelectivity(context, predicate, nodeTableStats);
+    } break;
+    case ExpressionType::FUNCTION: {
+        auto& function = predicate.constCast<ScalarFunctionExpression>().getFunction();
+        if (function.name == function::ListContainsFunction::name) {
+            selectivity = estimateInListSelectivity(context, predicate, nodeTableStats);
+        }
+    } break;
+    default:
+        break;
+    }
+    if (selectivity.has_value()) {
+        return atLeastOne(childPlan.getCardinality() * selectivity.value());
+    }
+    if (predicate.expressionType == ExpressionType::EQUALS) {
+        const auto numDistinctValues = getTableStatsIfPossible(context, predicate, nodeTableStats);
+        if (numDistinctValues.has_value()) {
+            return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
+        }
         return atLeastOne(
-            childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
+            childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
     }
+    return atLeastOne(
+        childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
 }
 
 uint64_t CardinalityEstimator::getNumNodes(const Transaction*,
@@ -211,6 +439,59 @@ uint64_t CardinalityEstimator::getNumRels(const Transaction* transaction,
     return atLeastOne(numRels);
 }
 
+std::optional<ExtensionDegrees> CardinalityEstimator::getExtensionDegrees(const RelExpression& rel,
+    const NodeExpression& boundNode, const Transaction* transaction) const {
+    std::vector<RelDataDirection> directions;
+    if (rel.getDirectionType() == RelDirectionType::BOTH) {
+        directions = {RelDataDirection::FWD, RelDataDirection::BWD};
+    } else if (*rel.getSrcNode() == boundNode) {
+        directions = {RelDataDirection::FWD};
+    } else {
+        directions = {RelDataDirection::BWD};
+    }
+    const auto boundTableIDs = boundNode.getTableIDsSet();
+    storage::DegreeStats degreeStats;
+    cardinality_t numRels = 0;
+    auto storageManager = storage::StorageManager::Get(*context);
+    for (auto tableID : rel.getInnerRelTableIDs()) {
+        auto& relTable = storageManager->getTable(tableID)->cast<storage::RelTable>();
+        for (auto direction : directions) {
+            auto boundTableID = direction == RelDataDirection::FWD ?
+                                    relTable.getFromNodeTableID() :
+                                    relTable.getToNodeTableID();
+            if (!boundTableIDs.contains(boundTableID)) {
+                continue;
+            }
+            if (!containsValue(relTable.getStorageDirections(), direction)) {
+                return std::nullopt;
+            }
+            degreeStats.merge(relTable.getDirectedTableData(direction)->getDegreeStats());
+            numRels += relTable.getNumTotalRows(transaction);
+        }
+    }
+    // Degree stats are refreshed at checkpoint. Ignore them if most rels are not covered yet.
+    if (degreeStats.empty() ||
+        degreeStats.getNumRels() < numRels * PlannerKnobs::MIN_DEGREE_STATS_COVERAGE) {
+        return std::nullopt;
+    }
+    const auto scale = static_cast<double>(numRels) / degreeStats.getNumRels();
+    return ExtensionDegrees{degreeStats.getAvgDegree() * scale,
+        degreeStats.getExcessDegree() * scale};
+}
+
+// Number of paths of length [1, maxLength] starting from a node, assuming the first rel is
+// extended from an average node and subsequent rels from nodes reached through a rel.
+static double estimateNumPaths(const ExtensionDegrees& degrees, uint16_t maxLength,
+    double maxNumPaths) {
+    double numPathsOfLength = 1;
+    double numPaths = 0;
+    for (auto length = 1u; length <= maxLength && numPaths < maxNumPaths; ++length) {
+        numPathsOfLength *= length == 1 ? degrees.avgDegree : degrees.excessDegree;
+        numPaths += numPathsOfLength;
+    }
+    return std::min(numPaths, maxNumPaths);
+}
+
 double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     const NodeExpression& boundNode, const Transaction* transaction) const {
     auto numBoundNodes = static_cast<double>(getNumNodes(transaction, boundNode.getTableIDs()));
@@ -224,8 +505,18 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     case QueryRelType::VARIABLE_LENGTH_WALK:
     case QueryRelType::VARIABLE_LENGTH_TRAIL:
     case QueryRelType::VARIABLE_LENGTH_ACYCLIC: {
-        auto rate = oneHopExtensionRate *
-                    std::max<uint16_t>(rel.getRecursiveInfo()->bindData->upperBound, 1);
+        auto upperBound = std::max<uint16_t>(rel.getRecursiveInfo()->bindData->upperBound, 1);
+        auto rate = oneHopExtensionRate * upperBound;
+        // With skewed degrees, paths are much more likely to go through hub nodes than the
+        // average degree suggests.
+        auto degrees = getExtensionDegrees(rel, boundNode, transaction);
+        if (degrees.has_value()) {
+            auto numPathsFromNodeWithRels = estimateNumPaths(degrees.value(), upperBound,
+                numRels * upperBound);
+            auto fractionOfNodesWithRels =
+                std::min(1.0, oneHopExtensionRate / std::max(1.0, degrees->avgDegree));
+            rate = numPathsFromNodeWithRels * fractionOfNodesWithRels;
+        }
         return rate * context->getClientConfig()->recursivePatternCardinalityScaleFactor;
     }
     case QueryRelType::SHORTEST:
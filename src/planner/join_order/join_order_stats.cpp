@@ -0,0 +1,19 @@
+#include "planner/join_order/join_order_stats.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace kuzu {
+namespace planner {
+
+std::string JoinOrderStats::toString() const {
+    std::ostringstream oss;
+    oss << "Join order enumeration: " << numQueryGraphsPlannedWithDP
+        << " query graph(s) planned with dynamic programming, " << numQueryGraphsPlannedGreedily
+        << " greedily, " << numJoinsEnumerated << " join(s) enumerated in " << std::fixed
+        << std::setprecision(3) << enumerationTimeMS << " ms";
+    return oss.str();
+}
+
+} // namespace planner
+} // namespace kuzu
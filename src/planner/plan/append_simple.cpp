@@ -115,7 +115,8 @@ LogicalPlan Planner::planExplain(const BoundStatement& statement) {
     auto statementToExplain = explain.getStatementToExplain();
     auto planToExplain = planStatement(*statementToExplain);
     auto op = std::make_shared<LogicalExplain>(planToExplain.getLastOperator(),
-        explain.getExplainType(), statementToExplain->getStatementResult()->getColumns());
+        explain.getExplainType(), statementToExplain->getStatementResult()->getColumns(),
+        joinOrderStats);
     return getSimplePlan(std::move(op));
 }
 
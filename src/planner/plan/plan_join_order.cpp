@@ -3,6 +3,7 @@
 #include "binder/expression_visitor.h"
 #include "common/enums/join_type.h"
 #include "common/enums/rel_direction.h"
+#include "common/metric.h"
 #include "common/utils.h"
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
@@ -51,8 +52,9 @@ LogicalPlan Planner::planQueryGraphCollection(const QueryGraphCollection& queryG
     std::vector<LogicalPlan> planPerQueryGraph;
     for (auto i = 0u; i < queryGraphCollection.getNumQueryGraphs(); ++i) {
         auto queryGraph = queryGraphCollection.getQueryGraph(i);
-        // Extract predicates for current query graph
-        std::unordered_set<uint32_t> predicateToEvaluateIndices;
+        // Extract predicates for current query graph. Indices are kept in order so that
+        // predicates are evaluated in their bound order.
+        std::vector<uint32_t> predicateToEvaluateIndices;
         for (auto j = 0u; j < info.predicates.size(); ++j) {
             if (info.predicates[j]->expressionType == ExpressionType::LITERAL) {
                 continue;
@@ -61,7 +63,7 @@ LogicalPlan Planner::planQueryGraphCollection(const QueryGraphCollection& queryG
                 continue;
             }
             if (queryGraph->canProjectExpression(info.predicates[j])) {
-                predicateToEvaluateIndices.insert(j);
+                predicateToEvaluateIndices.push_back(j);
             }
         }
         evaluatedPredicatesIndices.insert(predicateToEvaluateIndices.begin(),
@@ -122,6 +124,8 @@ LogicalPlan Planner::planQueryGraphCollection(const QueryGraphCollection& queryG
 
 LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
     const QueryGraphPlanningInfo& info) {
+    auto timer = TimeMetric(true /* enable */);
+    timer.start();
     context.init(&queryGraph, info.predicates);
     cardinalityEstimator.init(queryGraph);
     if (info.hint != nullptr) {
@@ -129,12 +133,20 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
             JoinTreeConstructor(queryGraph, propertyExprCollection, info.predicates, info);
         auto joinTree = constructor.construct(info.hint);
         auto plan = JoinPlanSolver(this).solve(joinTree);
+        timer.stop();
+        joinOrderStats.enumerationTimeMS += timer.getElapsedTimeMS();
         return plan.copy();
     }
     planBaseTableScans(info);
     context.currentLevel++;
-    while (context.currentLevel < context.maxLevel) {
-        planLevel(context.currentLevel++);
+    if (context.maxLevel - 1 > MAX_NUM_VARIABLES_TO_PLAN_WITH_DP && planGreedily()) {
+        joinOrderStats.numQueryGraphsPlannedGreedily++;
+    } else {
+        context.subPlansTable->setLimitNumSubgraphs(true);
+        while (context.currentLevel < context.maxLevel) {
+            planLevel(context.currentLevel++);
+        }
+        joinOrderStats.numQueryGraphsPlannedWithDP++;
     }
 
     auto& plans = context.getPlans(context.getFullyMatchedSubqueryGraph());
@@ -148,6 +160,8 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
     if (queryGraph.isEmpty()) {
         appendEmptyResult(bestPlan);
     }
+    timer.stop();
+    joinOrderStats.enumerationTimeMS += timer.getElapsedTimeMS();
     return bestPlan;
 }
 
@@ -172,9 +186,26 @@ void Planner::planLevelExactly(uint32_t level) {
 }
 
 void Planner::planLevelApproximately(uint32_t level) {
+    // Keep closing cycles with worst-case optimal joins beyond the exact levels.
+    for (auto leftLevel = 2u; leftLevel <= level / 2; ++leftLevel) {
+        planWCOJoin(leftLevel, level - leftLevel);
+    }
     planInnerJoin(1, level - 1);
 }
 
+static bool isDisjoint(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph) {
+    return (subgraph.queryNodesSelector & otherSubgraph.queryNodesSelector).none() &&
+           (subgraph.queryRelsSelector & otherSubgraph.queryRelsSelector).none();
+}
+
+static uint64_t getMinCost(const std::vector<LogicalPlan>& plans) {
+    auto result = UINT64_MAX;
+    for (auto& plan : plans) {
+        result = std::min(result, plan.getCost());
+    }
+    return result;
+}
+
 void Planner::planBaseTableScans(const QueryGraphPlanningInfo& info) {
     auto queryGraph = context.getQueryGraph();
     switch (info.subqueryType) {
@@ -488,20 +519,25 @@ static bool needPruneImplicitJoins(const SubqueryGraph& leftSubgraph,
 
 void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
     KU_ASSERT(leftLevel <= rightLevel);
+    // Pair each subgraph only with the disjoint and connected subgraphs that have plans at the left
+    // level, instead of expanding all its neighbour subgraphs of that size. Subgraphs without
+    // plans, e.g. (a)->(b) when planning the second match of MATCH (a)->(b) MATCH (b)->(c), are
+    // skipped for free.
+    auto leftSubgraphs = context.subPlansTable->getSubqueryGraphs(leftLevel);
     for (auto& rightSubgraph : context.subPlansTable->getSubqueryGraphs(rightLevel)) {
-        for (auto& nbrSubgraph : rightSubgraph.getNbrSubgraphs(leftLevel)) {
-            // E.g. MATCH (a)->(b) MATCH (b)->(c)
-            // Since we merge query graph for multipart query, during enumeration for the second
-            // match, the query graph is (a)->(b)->(c). However, we omit plans corresponding to the
-            // first match (i.e. (a)->(b)).
-            if (!context.containPlans(nbrSubgraph)) {
+        for (auto& nbrSubgraph : leftSubgraphs) {
+            if (!isDisjoint(rightSubgraph, nbrSubgraph)) {
                 continue;
             }
             auto joinNodePositions = rightSubgraph.getConnectedNodePos(nbrSubgraph);
+            if (joinNodePositions.empty()) {
+                continue;
+            }
             auto joinNodes = context.queryGraph->getQueryNodes(joinNodePositions);
             if (needPruneImplicitJoins(nbrSubgraph, rightSubgraph, joinNodes.size())) {
                 continue;
             }
+            joinOrderStats.numJoinsEnumerated++;
             // If index nested loop (INL) join is possible, we prune hash join plans
             if (tryPlanINLJoin(rightSubgraph, nbrSubgraph, joinNodes)) {
                 continue;
@@ -511,6 +547,23 @@ void Planner::planInnerJoin(uint32_t leftLevel, uint32_t rightLevel) {
     }
 }
 
+void Planner::planJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph) {
+    KU_ASSERT(isDisjoint(subgraph, otherSubgraph));
+    auto joinNodePositions = subgraph.getConnectedNodePos(otherSubgraph);
+    if (joinNodePositions.empty()) {
+        return;
+    }
+    auto joinNodes = context.queryGraph->getQueryNodes(joinNodePositions);
+    if (needPruneImplicitJoins(subgraph, otherSubgraph, joinNodes.size())) {
+        return;
+    }
+    joinOrderStats.numJoinsEnumerated++;
+    if (tryPlanINLJoin(subgraph, otherSubgraph, joinNodes)) {
+        return;
+    }
+    planInnerHashJoin(subgraph, otherSubgraph, joinNodes, true /* flipPlan */);
+}
+
 bool Planner::tryPlanINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
     if (joinNodes.size() > 1) {
@@ -589,6 +642,99 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
     }
 }
 
+// Greedy operator ordering. Starting from the base scans, repeatedly merge the connected subgraphs
+// whose cheapest join plan has the lowest cost until the query graph is covered. The plans of every
+// candidate join stay in the sub-plans table, so a candidate is planned only once even if it loses
+// several rounds. Returns false if the query graph cannot be covered this way.
+bool Planner::planGreedily() {
+    context.subPlansTable->setLimitNumSubgraphs(false);
+    std::vector<SubqueryGraph> subgraphs;
+    for (auto level = 1u; level < context.maxLevel; ++level) {
+        for (auto& subgraph : context.subPlansTable->getSubqueryGraphs(level)) {
+            subgraphs.push_back(subgraph);
+        }
+    }
+    auto queryGraph = context.getQueryGraph();
+    while (subgraphs.size() > 1) {
+        auto minCost = UINT64_MAX;
+        // Subgraphs merged by the cheapest candidate join, into the first one.
+        std::vector<idx_t> bestIdxes;
+        auto evaluate = [&](const SubqueryGraph& newSubgraph, std::vector<idx_t> idxes) {
+            if (!context.containPlans(newSubgraph)) {
+                return;
+            }
+            auto cost = getMinCost(context.getPlans(newSubgraph));
+            if (cost < minCost) {
+                minCost = cost;
+                bestIdxes = std::move(idxes);
+            }
+        };
+        std::unordered_map<uint32_t, idx_t> relPosToSubgraphIdx;
+        for (auto i = 0u; i < subgraphs.size(); ++i) {
+            for (auto j = i + 1; j < subgraphs.size(); ++j) {
+                auto newSubgraph = subgraphs[i];
+                newSubgraph.addSubqueryGraph(subgraphs[j]);
+                if (!context.containPlans(newSubgraph)) {
+                    planJoin(subgraphs[i], subgraphs[j]);
+                }
+                evaluate(newSubgraph, {i, j});
+            }
+            if (subgraphs[i].isSingleRel()) {
+                for (auto relPos = 0u; relPos < queryGraph->getNumQueryRels(); ++relPos) {
+                    if (subgraphs[i].queryRelsSelector[relPos]) {
+                        relPosToSubgraphIdx.insert({relPos, i});
+                    }
+                }
+            }
+        }
+        // Close cycles with worst-case optimal joins: intersect all rels that are not joined yet
+        // and lead from a subgraph to the same node outside of it.
+        for (auto i = 0u; i < subgraphs.size(); ++i) {
+            auto candidates = populateIntersectRelCandidates(*queryGraph, subgraphs[i]);
+            for (auto& [intersectNodePos, rels] : candidates) {
+                if (rels.size() < 2) {
+                    continue;
+                }
+                std::vector<idx_t> idxes{i};
+                auto newSubgraph = subgraphs[i];
+                for (auto& rel : rels) {
+                    auto relPos = queryGraph->getQueryRelIdx(rel->getUniqueName());
+                    if (!relPosToSubgraphIdx.contains(relPos)) {
+                        break;
+                    }
+                    idxes.push_back(relPosToSubgraphIdx.at(relPos));
+                    newSubgraph.addQueryRel(relPos);
+                }
+                if (idxes.size() != rels.size() + 1) {
+                    continue;
+                }
+                if (!context.containPlans(newSubgraph)) {
+                    joinOrderStats.numJoinsEnumerated++;
+                    planWCOJoin(subgraphs[i], rels, queryGraph->getQueryNode(intersectNodePos));
+                }
+                evaluate(newSubgraph, std::move(idxes));
+            }
+        }
+        if (bestIdxes.empty()) {
+            return false;
+        }
+        std::unordered_set<idx_t> mergedIdxes;
+        for (auto k = 1u; k < bestIdxes.size(); ++k) {
+            subgraphs[bestIdxes[0]].addSubqueryGraph(subgraphs[bestIdxes[k]]);
+            mergedIdxes.insert(bestIdxes[k]);
+        }
+        // Subgraphs are not assignable, so rebuild the list instead of erasing from it.
+        std::vector<SubqueryGraph> remainingSubgraphs;
+        for (auto i = 0u; i < subgraphs.size(); ++i) {
+            if (!mergedIdxes.contains(i)) {
+                remainingSubgraphs.push_back(subgraphs[i]);
+            }
+        }
+        subgraphs = std::move(remainingSubgraphs);
+    }
+    return true;
+}
+
 static bool isExpressionNewlyMatched(const std::vector<SubqueryGraph>& prevs,
     const SubqueryGraph& newSubgraph, const std::shared_ptr<Expression>& expression) {
     auto collector = DependentVarNameCollector();
@@ -39,7 +39,8 @@ void Planner::planQueryPart(const NormalizedQueryPart& queryPart, LogicalPlan& p
     if (queryPart.hasProjectionBody()) {
         planProjectionBody(queryPart.getProjectionBody(), plan);
         if (queryPart.hasProjectionBodyPredicate()) {
-            appendFilter(queryPart.getProjectionBodyPredicate(), plan);
+            // Conjuncts are planned as separate filters so that they can be reordered at runtime.
+            appendFilters(queryPart.getProjectionBodyPredicate()->splitOnAND(), plan);
         }
     }
 }
@@ -59,8 +59,10 @@ std::vector<SubqueryGraph> DPLevel::getSubqueryGraphs() {
     return result;
 }
 
-void DPLevel::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
-    if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
+void DPLevel::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan,
+    bool limitNumSubgraphs) {
+    if (limitNumSubgraphs && subgraph2Plans.size() > MAX_NUM_SUBGRAPH &&
+        !contains(subqueryGraph)) {
         return;
     }
     if (!contains(subqueryGraph)) {
@@ -100,13 +102,14 @@ std::vector<SubqueryGraph> SubPlansTable::getSubqueryGraphs(uint32_t level) {
 
 void SubPlansTable::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
     auto& dpLevel = getDPLevelUnsafe(subqueryGraph);
-    dpLevel.addPlan(subqueryGraph, std::move(plan));
+    dpLevel.addPlan(subqueryGraph, std::move(plan), limitNumSubgraphs);
 }
 
 void SubPlansTable::clear() {
     for (auto& dpLevel : dpLevels) {
         dpLevel.clear();
     }
+    limitNumSubgraphs = true;
 }
 
 } // namespace planner
@@ -0,0 +1,31 @@
+#include "processor/operator/streaming_result_collector.h"
+#include "processor/plan_mapper.h"
+#include "processor/result/factorized_table_util.h"
+
+using namespace kuzu::common;
+using namespace kuzu::planner;
+using namespace kuzu::binder;
+
+namespace kuzu {
+namespace processor {
+
+std::unique_ptr<PhysicalOperator> PlanMapper::createStreamingResultCollector(
+    uint64_t maxNumBufferedTuples, const expression_vector& expressions, Schema* schema,
+    std::unique_ptr<PhysicalOperator> prevOperator) {
+    std::vector<DataPos> payloadsPos;
+    for (auto& expr : expressions) {
+        payloadsPos.push_back(getDataPos(*expr, *schema));
+    }
+    auto tableSchema = FactorizedTableUtils::createFTableSchema(expressions, *schema);
+    auto sharedState = std::make_shared<StreamingResultCollectorSharedState>(maxNumBufferedTuples);
+    auto opInfo = StreamingResultCollectorInfo(std::move(tableSchema), std::move(payloadsPos));
+    auto printInfo =
+        std::make_unique<ResultCollectorPrintInfo>(expressions, AccumulateType::REGULAR);
+    auto op = std::make_unique<StreamingResultCollector>(std::move(opInfo), std::move(sharedState),
+        std::move(prevOperator), getOperatorID(), std::move(printInfo));
+    op->setDescriptor(std::make_unique<ResultSetDescriptor>(schema));
+    return op;
+}
+
+} // namespace processor
+} // namespace kuzu
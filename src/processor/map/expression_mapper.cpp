@@ -106,10 +106,19 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getLiteralEvaluator(
 }
 
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getParameterEvaluator(
-    std::shared_ptr<Expression> expression) {
+    std::shared_ptr<Expression> expression) const {
     auto& parameterExpression = expression->constCast<ParameterExpression>();
-    return std::make_unique<LiteralExpressionEvaluator>(std::move(expression),
-        parameterExpression.getValue());
+    const auto& name = parameterExpression.getParameterName();
+    if (parameterValues == nullptr || !parameterValues->contains(name)) {
+        return std::make_unique<LiteralExpressionEvaluator>(std::move(expression),
+            parameterExpression.getValue());
+    }
+    auto value = *parameterValues->at(name);
+    if (value.getDataType() != expression->getDataType()) {
+        // The binder resolved the type of a null parameter, see ParameterExpression::cast.
+        value.setDataType(expression->getDataType());
+    }
+    return std::make_unique<LiteralExpressionEvaluator>(std::move(expression), std::move(value));
 }
 
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getReferenceEvaluator(
@@ -151,6 +160,7 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getFunctionEvaluator(
         auto result =
             std::make_unique<ListLambdaEvaluator>(expression, std::move(childrenEvaluators));
         auto recursiveExprMapper = ExpressionMapper(schema, result.get());
+        recursiveExprMapper.parameterValues = parameterValues;
         auto& lambdaExpr = expression->getChild(1)->constCast<LambdaExpression>();
         result->setLambdaRootEvaluator(
             recursiveExprMapper.getEvaluator(lambdaExpr.getFunctionExpr()));
@@ -55,7 +55,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapCopyNodeFrom(
         sharedState->tableFuncSharedState = call->getSharedState().get();
     }
     std::vector<std::unique_ptr<evaluator::ExpressionEvaluator>> columnEvaluators;
-    auto exprMapper = ExpressionMapper(outFSchema);
+    auto exprMapper = ExpressionMapper(outFSchema, executionContext->parameterValues);
     for (auto& expr : copyFromInfo->columnExprs) {
         columnEvaluators.push_back(exprMapper.getEvaluator(expr));
     }
@@ -90,7 +90,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapPartitioner(
     }
     std::vector<LogicalType> columnTypes;
     evaluator::evaluator_vector_t columnEvaluators;
-    auto exprMapper = ExpressionMapper(outFSchema);
+    auto exprMapper = ExpressionMapper(outFSchema, executionContext->parameterValues);
     for (auto& expr : copyFromInfo.columnExprs) {
         columnTypes.push_back(expr->getDataType().copy());
         columnEvaluators.push_back(exprMapper.getEvaluator(expr));
@@ -67,7 +67,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapDrop(const LogicalOperator* log
 std::unique_ptr<PhysicalOperator> PlanMapper::mapAlter(const LogicalOperator* logicalOperator) {
     auto& alter = logicalOperator->constCast<LogicalAlter>();
     std::unique_ptr<evaluator::ExpressionEvaluator> defaultValueEvaluator;
-    auto exprMapper = ExpressionMapper(alter.getSchema());
+    auto exprMapper = ExpressionMapper(alter.getSchema(), executionContext->parameterValues);
     if (alter.getInfo()->alterType == AlterType::ADD_PROPERTY) {
         auto& addPropInfo = alter.getInfo()->extraInfo->constCast<BoundExtraAddPropertyInfo>();
         defaultValueEvaluator = exprMapper.getEvaluator(addPropInfo.boundDefault);
@@ -19,7 +19,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapDummyScan(const LogicalOperator
     auto columnSchema = ColumnSchema(false, 0 /* groupID */,
         LogicalTypeUtils::getRowLayoutSize(expression->dataType));
     tableSchema.appendColumn(std::move(columnSchema));
-    auto exprMapper = ExpressionMapper(inSchema.get());
+    auto exprMapper = ExpressionMapper(inSchema.get(), executionContext->parameterValues);
     auto expressionEvaluator = exprMapper.getEvaluator(expression);
     auto memoryManager = storage::MemoryManager::Get(*clientContext);
     // expression can be evaluated statically and does not require an actual resultset to init
@@ -34,12 +34,14 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapExplain(const LogicalOperator*
         auto plan = std::make_unique<PhysicalPlan>(std::move(root));
         auto profiler = std::make_unique<Profiler>();
         auto explainStr = main::PlanPrinter::printPlanToOstream(plan.get(), profiler.get()).str();
+        explainStr += logicalExplain.getJoinOrderStats().toString() + "\n";
         FactorizedTableUtils::appendStringToTable(messageTable.get(), explainStr, memoryManager);
         return std::make_unique<DummySimpleSink>(std::move(messageTable), getOperatorID());
     }
     auto plan = LogicalPlan();
     plan.setLastOperator(logicalExplain.getChild(0));
     auto explainStr = main::PlanPrinter::printPlanToOstream(&plan).str();
+    explainStr += logicalExplain.getJoinOrderStats().toString() + "\n";
     FactorizedTableUtils::appendStringToTable(messageTable.get(), explainStr, memoryManager);
     return std::make_unique<DummySimpleSink>(std::move(messageTable), getOperatorID());
 }
@@ -1,3 +1,6 @@
+#include <algorithm>
+
+#include "binder/expression/expression_util.h"
 #include "planner/operator/logical_filter.h"
 #include "processor/expression_mapper.h"
 #include "processor/operator/filter.h"
@@ -10,12 +13,32 @@ namespace processor {
 
 std::unique_ptr<PhysicalOperator> PlanMapper::mapFilter(const LogicalOperator* logicalOperator) {
     auto& logicalFilter = logicalOperator->constCast<LogicalFilter>();
-    auto inSchema = logicalFilter.getChild(0)->getSchema();
-    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
-    auto exprMapper = ExpressionMapper(inSchema);
-    auto physicalRootExpr = exprMapper.getEvaluator(logicalFilter.getPredicate());
-    auto printInfo = std::make_unique<FilterPrintInfo>(logicalFilter.getPredicate());
-    return make_unique<Filter>(std::move(physicalRootExpr), logicalFilter.getGroupPosToSelect(),
+    auto groupPosToSelect = logicalFilter.getGroupPosToSelect();
+    // Consecutive filters selecting on the same data chunk are evaluated by a single operator that
+    // can reorder them. Filters are collected from the bottom up to keep their planned order.
+    std::vector<const LogicalFilter*> filters;
+    filters.push_back(&logicalFilter);
+    auto child = logicalOperator->getChild(0).get();
+    while (groupPosToSelect != INVALID_F_GROUP_POS &&
+           child->getOperatorType() == LogicalOperatorType::FILTER &&
+           child->constCast<LogicalFilter>().getGroupPosToSelect() == groupPosToSelect) {
+        filters.push_back(&child->constCast<LogicalFilter>());
+        child = child->getChild(0).get();
+    }
+    std::reverse(filters.begin(), filters.end());
+    auto prevOperator = mapOperator(child);
+    evaluator::evaluator_vector_t evaluators;
+    binder::expression_vector predicates;
+    auto canReorder = filters.size() > 1;
+    for (auto& filter : filters) {
+        auto exprMapper =
+            ExpressionMapper(filter->getChild(0)->getSchema(), executionContext->parameterValues);
+        evaluators.push_back(exprMapper.getEvaluator(filter->getPredicate()));
+        predicates.push_back(filter->getPredicate());
+        canReorder &= binder::ExpressionUtil::canEvaluateWithoutError(*filter->getPredicate());
+    }
+    auto printInfo = std::make_unique<FilterPrintInfo>(std::move(predicates));
+    return make_unique<Filter>(std::move(evaluators), canReorder, groupPosToSelect,
         std::move(prevOperator), getOperatorID(), std::move(printInfo));
 }
 
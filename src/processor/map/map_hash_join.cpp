@@ -1,5 +1,7 @@
 #include "binder/expression/expression_util.h"
+#include "binder/expression/property_expression.h"
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
 #include "processor/plan_mapper.h"
@@ -59,6 +61,21 @@ HashJoinBuildInfo PlanMapper::createHashBuildInfo(const Schema& buildSideSchema,
         std::move(tableSchema));
 }
 
+// Returns the scan of a build side that only scans and filters a single node, whose cardinality can
+// be fed back to the planner as the domain of the node.
+static const LogicalScanNodeTable* getSingleNodeScan(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE:
+        return &op.constCast<LogicalScanNodeTable>();
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::PROJECTION:
+        return getSingleNodeScan(*op.getChild(0));
+    default:
+        return nullptr;
+    }
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator* logicalOperator) {
     auto hashJoin = logicalOperator->constPtrCast<LogicalHashJoin>();
     auto outSchema = hashJoin->getSchema();
@@ -93,6 +110,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
         sharedState, std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(),
         buildPrintInfo->copy());
     hashJoinBuild->setDescriptor(std::make_unique<ResultSetDescriptor>(buildSchema));
+    // Semi masks passed from the probe side would make the build side smaller than the node scan.
+    if (executionContext->enableReoptimization &&
+        hashJoin->getSIPInfo().direction != SIPDirection::PROBE_TO_BUILD) {
+        if (const auto scan = getSingleNodeScan(*hashJoin->getChild(1))) {
+            const auto& nodeID = scan->getNodeID()->constCast<PropertyExpression>();
+            hashJoinBuild->setCardinalityCheck(BuildCardinalityCheck{nodeID.getVariableName(),
+                hashJoin->getChild(1)->getCardinality()});
+        }
+    }
     // Create probe
     std::vector<DataPos> probeKeysDataPos;
     for (auto& probeKey : probeKeys) {
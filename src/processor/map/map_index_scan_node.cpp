@@ -18,7 +18,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapIndexLookup(
     auto child = logicalOperator->getChild(0).get();
     auto prevOperator = mapOperator(child);
     auto storageManager = storage::StorageManager::Get(*clientContext);
-    auto exprMapper = ExpressionMapper(child->getSchema());
+    auto exprMapper = ExpressionMapper(child->getSchema(), executionContext->parameterValues);
     std::vector<IndexLookupInfo> indexLookupInfos;
     for (auto i = 0u; i < logicalIndexScan.getNumInfos(); ++i) {
         auto& info = logicalIndexScan.getInfo(i);
@@ -40,7 +40,7 @@ NodeInsertExecutor PlanMapper::getNodeInsertExecutor(const LogicalInsertInfo* bo
     ;
     auto table = storageManager->getTable(node.getEntry(0)->getTableID())->ptrCast<NodeTable>();
     evaluator_vector_t evaluators;
-    auto exprMapper = ExpressionMapper(&inSchema);
+    auto exprMapper = ExpressionMapper(&inSchema, executionContext->parameterValues);
     for (auto& expr : boundInfo->columnDataExprs) {
         evaluators.push_back(exprMapper.getEvaluator(expr));
     }
@@ -66,7 +66,7 @@ RelInsertExecutor PlanMapper::getRelInsertExecutor(const LogicalInsertInfo* boun
     auto relEntryInfo = relGroupEntry.getRelEntryInfo(srcTableID, dstTableID);
     auto table = storageManager->getTable(relEntryInfo->oid)->ptrCast<RelTable>();
     evaluator_vector_t evaluators;
-    auto exprMapper = ExpressionMapper(&outSchema);
+    auto exprMapper = ExpressionMapper(&outSchema, executionContext->parameterValues);
     for (auto& expr : boundInfo->columnDataExprs) {
         evaluators.push_back(exprMapper.getEvaluator(expr));
     }
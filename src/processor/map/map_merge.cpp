@@ -97,7 +97,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapMerge(const LogicalOperator* lo
     auto printInfo =
         std::make_unique<MergePrintInfo>(expressions, onCreateOperation, onMatchOperation);
     std::vector<std::unique_ptr<evaluator::ExpressionEvaluator>> keyEvaluators;
-    auto expressionMapper = ExpressionMapper(inSchema);
+    auto expressionMapper = ExpressionMapper(inSchema, executionContext->parameterValues);
     for (auto& key : logicalMerge.getKeys()) {
         keyEvaluators.push_back(expressionMapper.getEvaluator(key));
     }
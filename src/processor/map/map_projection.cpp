@@ -18,7 +18,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapProjection(
         std::make_unique<ProjectionPrintInfo>(logicalProjection.getExpressionsToProject());
     auto info = ProjectionInfo();
     info.discardedChunkIndices = logicalProjection.getDiscardedGroupsPos();
-    auto exprMapper = ExpressionMapper(inSchema);
+    auto exprMapper = ExpressionMapper(inSchema, executionContext->parameterValues);
     for (auto& expr : logicalProjection.getExpressionsToProject()) {
         info.addEvaluator(exprMapper.getEvaluator(expr), getDataPos(*expr, *outSchema));
     }
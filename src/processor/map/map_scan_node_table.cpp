@@ -77,7 +77,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
     }
     case LogicalScanNodeTableType::PRIMARY_KEY_SCAN: {
         auto& primaryKeyScanInfo = scan.getExtraInfo()->constCast<PrimaryKeyScanInfo>();
-        auto exprMapper = ExpressionMapper(outSchema);
+        auto exprMapper = ExpressionMapper(outSchema, executionContext->parameterValues);
         auto evaluator = exprMapper.getEvaluator(primaryKeyScanInfo.key);
         auto sharedState = std::make_shared<PrimaryKeyScanSharedState>(tableInfos.size());
         auto printInfo = std::make_unique<PrimaryKeyScanPrintInfo>(scan.getProperties(),
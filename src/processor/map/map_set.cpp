@@ -52,7 +52,7 @@ std::unique_ptr<NodeSetExecutor> PlanMapper::getNodeSetExecutor(
     if (schema.isExpressionInScope(property)) {
         columnVectorPos = getDataPos(property, schema);
     }
-    auto exprMapper = ExpressionMapper(&schema);
+    auto exprMapper = ExpressionMapper(&schema, executionContext->parameterValues);
     auto evaluator = exprMapper.getEvaluator(boundInfo.columnData);
     auto setInfo = NodeSetInfo(nodeIDPos, columnVectorPos, std::move(evaluator));
     if (node.isMultiLabeled()) {
@@ -119,7 +119,7 @@ std::unique_ptr<RelSetExecutor> PlanMapper::getRelSetExecutor(const BoundSetProp
     if (schema.isExpressionInScope(property)) {
         columnVectorPos = getDataPos(property, schema);
     }
-    auto exprMapper = ExpressionMapper(&schema);
+    auto exprMapper = ExpressionMapper(&schema, executionContext->parameterValues);
     auto evaluator = exprMapper.getEvaluator(boundInfo.columnData);
     auto info =
         RelSetInfo(srcNodeIDPos, dstNodeIDPos, relIDPos, columnVectorPos, std::move(evaluator));
@@ -16,7 +16,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapUnwind(const LogicalOperator* l
     auto inSchema = unwind.getChild(0)->getSchema();
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     auto dataPos = DataPos(outSchema->getExpressionPos(*unwind.getOutExpr()));
-    auto exprMapper = ExpressionMapper(inSchema);
+    auto exprMapper = ExpressionMapper(inSchema, executionContext->parameterValues);
     auto evaluator = exprMapper.getEvaluator(unwind.getInExpr());
     DataPos idPos;
     if (unwind.hasIDExpr()) {
@@ -23,12 +23,15 @@ PlanMapper::PlanMapper(ExecutionContext* executionContext)
 
 std::unique_ptr<PhysicalPlan> PlanMapper::getPhysicalPlan(const LogicalPlan* logicalPlan,
     const expression_vector& expressions, main::QueryResultType resultType,
-    ArrowResultConfig arrowConfig) {
+    ArrowResultConfig arrowConfig, uint64_t maxNumBufferedTuples) {
     auto root = mapOperator(logicalPlan->getLastOperator().get());
     if (!root->isSink()) {
         if (resultType == main::QueryResultType::ARROW) {
             root = createArrowResultCollector(arrowConfig, expressions, logicalPlan->getSchema(),
                 std::move(root));
+        } else if (resultType == main::QueryResultType::STREAMING) {
+            root = createStreamingResultCollector(maxNumBufferedTuples, expressions,
+                logicalPlan->getSchema(), std::move(root));
         } else {
             root = createResultCollector(AccumulateType::REGULAR, expressions,
                 logicalPlan->getSchema(), std::move(root));
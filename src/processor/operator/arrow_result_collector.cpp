@@ -24,8 +24,12 @@ void ArrowResultCollectorLocalState::fillTuple() {
     for (auto i = 0u; i < vectors.size(); ++i) {
         auto vector = vectors[i];
         auto pos = vector->state->getSelVector()[vectorsSelPos[i]];
-        auto data = vector->getData() + pos * vector->getNumBytesPerValue();
-        tuple->getValue(i)->copyFromColLayout(data, vector);
+        auto value = tuple->getValue(i);
+        value->setNull(vector->isNull(pos));
+        if (!value->isNull()) {
+            auto data = vector->getData() + pos * vector->getNumBytesPerValue();
+            value->copyFromColLayout(data, vector);
+        }
     }
 }
 
@@ -46,6 +50,11 @@ void ArrowResultCollector::executeInternal(ExecutionContext* context) {
     auto rowBatch = std::make_unique<ArrowRowBatch>(info.columnTypes, info.chunkSize,
         false /* fallbackExtensionTypes */);
     while (children[0]->getNextTuple(context)) {
+        if (localState.chunks.size() == 1) {
+            // All columns come from the same data chunk, so they can be copied column by column.
+            fillRowBatchColumnar(rowBatch);
+            continue;
+        }
         localState.resetCursor();
         while (true) {
             if (!fillRowBatch(*rowBatch)) {
@@ -63,6 +72,22 @@ void ArrowResultCollector::executeInternal(ExecutionContext* context) {
     sharedState->merge(localState.arrays);
 }
 
+void ArrowResultCollector::fillRowBatchColumnar(std::unique_ptr<ArrowRowBatch>& rowBatch) {
+    const auto& selVector = localState.chunks[0]->state->getSelVector();
+    uint64_t numValuesAppended = 0;
+    while (numValuesAppended < selVector.getSelSize()) {
+        auto numValuesToAppend = std::min<uint64_t>(selVector.getSelSize() - numValuesAppended,
+            info.chunkSize - rowBatch->size());
+        rowBatch->append(localState.vectors, selVector, numValuesAppended, numValuesToAppend);
+        numValuesAppended += numValuesToAppend;
+        if (rowBatch->size() == info.chunkSize) {
+            localState.arrays.push_back(rowBatch->toArray(info.columnTypes));
+            rowBatch = std::make_unique<ArrowRowBatch>(info.columnTypes, info.chunkSize,
+                false /* fallbackExtensionTypes */);
+        }
+    }
+}
+
 bool ArrowResultCollector::fillRowBatch(ArrowRowBatch& rowBatch) {
     while (rowBatch.size() < info.chunkSize) {
         localState.fillTuple();
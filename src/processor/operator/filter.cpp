@@ -1,6 +1,12 @@
 #include "processor/operator/filter.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric>
+
 #include "binder/expression/expression.h" // IWYU pragma: keep
+#include "common/profiler.h"
 #include "processor/execution_context.h"
 
 using namespace kuzu::common;
@@ -9,11 +15,38 @@ namespace kuzu {
 namespace processor {
 
 std::string FilterPrintInfo::toString() const {
-    return expression->toString();
+    std::string result;
+    for (auto i = 0u; i < expressions.size(); ++i) {
+        if (i > 0) {
+            result += " AND ";
+        }
+        result += expressions[i]->toString();
+    }
+    return result;
+}
+
+double FilterConjunctStats::getRank() const {
+    if (numInputTuples == 0) {
+        return 0;
+    }
+    // Evaluation cost per input tuple divided by the fraction of tuples eliminated.
+    const auto numEliminatedTuples = numInputTuples - numOutputTuples;
+    if (numEliminatedTuples == 0) {
+        return std::numeric_limits<double>::max();
+    }
+    return (double)numNanoseconds / numEliminatedTuples;
+}
+
+void FilterConjunctStats::decay() {
+    numInputTuples /= 2;
+    numOutputTuples /= 2;
+    numNanoseconds /= 2;
 }
 
 void Filter::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
-    expressionEvaluator->init(*resultSet, context->clientContext);
+    for (auto& evaluator : expressionEvaluators) {
+        evaluator->init(*resultSet, context->clientContext);
+    }
     if (dataChunkToSelectPos == INVALID_DATA_CHUNK_POS) {
         // Filter a constant expression. Ideally we should fold all such expression at compile time.
         // But there are many edge cases, so we keep this code path for robustness.
@@ -21,6 +54,30 @@ void Filter::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* cont
     } else {
         state = resultSet->dataChunks[dataChunkToSelectPos]->state;
     }
+    evaluationOrder.resize(expressionEvaluators.size());
+    std::iota(evaluationOrder.begin(), evaluationOrder.end(), 0);
+    conjunctStats.resize(expressionEvaluators.size());
+    for (auto i = 0u; i < expressionEvaluators.size(); ++i) {
+        conjunctInputs.push_back(
+            context->profiler->registerNumericMetric(getConjunctInputsMetricKey(i)));
+    }
+}
+
+std::unordered_map<std::string, std::string> Filter::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    if (expressionEvaluators.size() > 1) {
+        std::string conjunctInputsStr;
+        for (auto i = 0u; i < expressionEvaluators.size(); ++i) {
+            if (i > 0) {
+                conjunctInputsStr += "/";
+            }
+            conjunctInputsStr +=
+                std::to_string(profiler.sumAllNumericMetricsWithKey(getConjunctInputsMetricKey(i)));
+        }
+        result.insert({"ConjunctInputs", conjunctInputsStr});
+    }
+    return result;
 }
 
 bool Filter::getNextTuplesInternal(ExecutionContext* context) {
@@ -31,13 +88,64 @@ bool Filter::getNextTuplesInternal(ExecutionContext* context) {
             return false;
         }
         saveSelVector(*state);
-        hasAtLeastOneSelectedValue =
-            expressionEvaluator->select(state->getSelVectorUnsafe(), !state->isFlat());
+        hasAtLeastOneSelectedValue = select();
     } while (!hasAtLeastOneSelectedValue);
     metrics->numOutputTuple.increase(state->getSelVector().getSelSize());
     return true;
 }
 
+bool Filter::select() {
+    if (canReorder && numInputChunks++ % SAMPLING_INTERVAL == 0) {
+        return selectAndSample();
+    }
+    for (auto idx : evaluationOrder) {
+        conjunctInputs[idx]->increase(state->getSelVector().getSelSize());
+        if (!expressionEvaluators[idx]->select(state->getSelVectorUnsafe(), !state->isFlat())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Filter::selectAndSample() {
+    auto result = true;
+    for (auto idx : evaluationOrder) {
+        const auto numInputTuples = state->getSelVector().getSelSize();
+        conjunctInputs[idx]->increase(numInputTuples);
+        const auto startTime = std::chrono::steady_clock::now();
+        result = expressionEvaluators[idx]->select(state->getSelVectorUnsafe(), !state->isFlat());
+        const auto duration = std::chrono::steady_clock::now() - startTime;
+        // A flat state keeps its selection vector, so only the result tells whether the tuple
+        // is selected.
+        const auto numOutputTuples = result ? state->getSelVector().getSelSize() : 0;
+        conjunctStats[idx].update(numInputTuples, numOutputTuples,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        if (!result) {
+            break;
+        }
+    }
+    if (++numSamples % REORDER_INTERVAL == 1) {
+        reorderConjuncts();
+    }
+    return result;
+}
+
+void Filter::reorderConjuncts() {
+    // Conjuncts that were not reached since the last reordering keep their relative position
+    // behind the sampled ones.
+    std::stable_sort(evaluationOrder.begin(), evaluationOrder.end(), [&](auto a, auto b) {
+        const auto& statsA = conjunctStats[a];
+        const auto& statsB = conjunctStats[b];
+        if (statsA.numInputTuples == 0 || statsB.numInputTuples == 0) {
+            return statsA.numInputTuples != 0 && statsB.numInputTuples == 0;
+        }
+        return statsA.getRank() < statsB.getRank();
+    });
+    for (auto& stats : conjunctStats) {
+        stats.decay();
+    }
+}
+
 void NodeLabelFiler::initLocalStateInternal(ResultSet* /*resultSet_*/,
     ExecutionContext* /*context*/) {
     nodeIDVector = resultSet->getValueVector(info->nodeVectorPos).get();
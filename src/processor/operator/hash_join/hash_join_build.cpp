@@ -1,6 +1,8 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/constants.h"
+#include "common/exception/reoptimization.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -53,8 +55,21 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
+void HashJoinBuild::checkCardinality(cardinality_t numTuples) const {
+    const auto estimated =
+        static_cast<double>(std::max<cardinality_t>(1, cardinalityCheck->estimatedCardinality));
+    const auto actual = static_cast<double>(std::max<cardinality_t>(1, numTuples));
+    if (std::max(estimated / actual, actual / estimated) >
+        PlannerKnobs::REOPTIMIZATION_ERROR_THRESHOLD) {
+        throw ReoptimizationException(cardinalityCheck->nodeName, numTuples);
+    }
+}
+
 void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
     auto numTuples = sharedState->getHashTable()->getNumEntries();
+    if (cardinalityCheck.has_value()) {
+        checkCardinality(numTuples);
+    }
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
 }
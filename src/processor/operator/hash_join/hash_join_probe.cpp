@@ -1,6 +1,9 @@
 #include "processor/operator/hash_join/hash_join_probe.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/metric.h"
+#include "common/profiler.h"
+#include "function/hash/hash_functions.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -15,6 +18,12 @@ std::string HashJoinProbePrintInfo::toString() const {
     return result;
 }
 
+ProbeMemo::Slot& ProbeMemo::getSlot(internalID_t key) {
+    hash_t hash = 0;
+    function::Hash::operation(key, hash);
+    return slots[hash & (NUM_SLOTS - 1)];
+}
+
 void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     probeState = std::make_unique<ProbeState>();
     for (auto& keyDataPos : probeDataInfo.keysDataPos) {
@@ -40,6 +49,17 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     if (keyVectors.size() > 1) {
         tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
     }
+    if (canMemoize()) {
+        memo = std::make_unique<ProbeMemo>(
+            context->profiler->registerNumericMetric(getMemoLookupsMetricKey()),
+            context->profiler->registerNumericMetric(getMemoHitsMetricKey()));
+    }
+}
+
+bool HashJoinProbe::canMemoize() const {
+    return flatProbe && (joinType == JoinType::MARK || joinType == JoinType::COUNT) &&
+           keyVectors.size() == 1 &&
+           keyVectors[0]->dataType.getLogicalTypeID() == LogicalTypeID::INTERNAL_ID;
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -59,8 +79,10 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
             probeState->probedTuples.get());
     }
+    // A mark join only needs to know whether any tuple matches.
     auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
-        probeState->probedTuples.get(), probeState->matchedTuples.get());
+        probeState->probedTuples.get(), probeState->matchedTuples.get(),
+        joinType == JoinType::MARK ? 1 : DEFAULT_VECTOR_CAPACITY);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
     return true;
@@ -190,12 +212,77 @@ uint64_t HashJoinProbe::getJoinResult() {
     }
 }
 
+// Returns the number of matches for a mark join, or the count payload for a count join, of the
+// current flat key.
+int64_t HashJoinProbe::probeMarkOrCount() {
+    const auto hashTable = sharedState->getHashTable();
+    hashTable->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
+        probeState->probedTuples.get());
+    const auto numMatchedTuples = hashTable->matchFlatKeys(keyVectors,
+        probeState->probedTuples.get(), probeState->matchedTuples.get(), 1 /* maxNumMatches */);
+    probeState->probedTuples[0] = nullptr;
+    if (numMatchedTuples == 0 || joinType == JoinType::MARK) {
+        return numMatchedTuples;
+    }
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom, probeState->matchedTuples.get(),
+        0 /* startPos */, 1 /* numTuplesToRead */);
+    const auto countVector = vectorsToReadInto[0];
+    return countVector->getValue<int64_t>(countVector->state->getSelVector()[0]);
+}
+
+bool HashJoinProbe::getNextTuplesWithMemo(ExecutionContext* context) {
+    const auto keyVector = keyVectors[0];
+    restoreSelVector(*keyVector->state);
+    if (!children[0]->getNextTuple(context)) {
+        return false;
+    }
+    saveSelVector(*keyVector->state);
+    KU_ASSERT(keyVector->state->isFlat());
+    const auto pos = keyVector->state->getSelVector()[0];
+    int64_t value = 0;
+    if (!keyVector->isNull(pos)) {
+        const auto key = keyVector->getValue<internalID_t>(pos);
+        auto& slot = memo->getSlot(key);
+        memo->numLookups->incrementByOne();
+        if (slot.key == key) {
+            memo->numHits->incrementByOne();
+            value = slot.value;
+        } else {
+            value = probeMarkOrCount();
+            slot.key = key;
+            slot.value = value;
+        }
+    }
+    if (joinType == JoinType::MARK) {
+        markVector->setValue<bool>(markVector->state->getSelVector()[0], value != 0);
+    } else {
+        const auto countVector = vectorsToReadInto[0];
+        countVector->setValue<int64_t>(countVector->state->getSelVector()[0], value);
+    }
+    metrics->numOutputTuple.incrementByOne();
+    return true;
+}
+
+std::unordered_map<std::string, std::string> HashJoinProbe::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    const auto numLookups = profiler.sumAllNumericMetricsWithKey(getMemoLookupsMetricKey());
+    if (numLookups > 0) {
+        const auto numHits = profiler.sumAllNumericMetricsWithKey(getMemoHitsMetricKey());
+        result.insert({"MemoHits", std::to_string(numHits) + "/" + std::to_string(numLookups)});
+    }
+    return result;
+}
+
 // The general flow of a hash join probe:
 // 1) find matched tuples of probe side key from ht.
 // 2) populate values from matched tuples into resultKeyDataChunk , buildSideFlatResultDataChunk
 // (all flat data chunks from the build side are merged into one) and buildSideVectorPtrs (each
 // VectorPtr corresponds to one unFlat build side data chunk that is appended to the resultSet).
 bool HashJoinProbe::getNextTuplesInternal(ExecutionContext* context) {
+    if (memo != nullptr) {
+        return getNextTuplesWithMemo(context);
+    }
     uint64_t numPopulatedTuples = 0;
     do {
         if (!getMatchedTuples(context)) {
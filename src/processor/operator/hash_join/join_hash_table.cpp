@@ -152,10 +152,11 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
 }
 
 sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
-    uint8_t** probedTuples, uint8_t** matchedTuples) {
-    auto numMatchedTuples = 0;
+    uint8_t** probedTuples, uint8_t** matchedTuples, sel_t maxNumMatches) {
+    KU_ASSERT(maxNumMatches <= DEFAULT_VECTOR_CAPACITY);
+    sel_t numMatchedTuples = 0;
     while (probedTuples[0]) {
-        if (numMatchedTuples == DEFAULT_VECTOR_CAPACITY) {
+        if (numMatchedTuples == maxNumMatches) {
             break;
         }
         auto currentTuple = probedTuples[0];
@@ -62,31 +62,23 @@ void Intersect::probeHTs() {
     }
 }
 
-void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
-    nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
-    KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
-    auto leftPositionBuffer = lSelVector.getMutableBuffer();
-    auto rightPositionBuffer = rSelVector.getMutableBuffer();
-    sel_t leftPosition = 0, rightPosition = 0;
-    uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
-        auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID < rightNodeID) {
-            leftPosition++;
-        } else if (leftNodeID > rightNodeID) {
-            rightPosition++;
-        } else {
-            leftPositionBuffer[outputValuePosition] = leftPosition;
-            rightPositionBuffer[outputValuePosition] = rightPosition;
-            leftNodeIDs[outputValuePosition] = leftNodeID;
-            leftPosition++;
-            rightPosition++;
-            outputValuePosition++;
-        }
+// Returns the first position at or after pos whose node ID is not smaller than value. Gallops
+// forward before binary searching, so that skipping over a long run of a large list costs
+// logarithmic instead of linear time.
+static uint64_t seek(const nodeID_t* nodeIDs, uint64_t numNodeIDs, uint64_t pos, nodeID_t value) {
+    if (pos >= numNodeIDs || !(nodeIDs[pos] < value)) {
+        return pos;
+    }
+    auto low = pos;
+    auto step = 1u;
+    auto high = pos + step;
+    while (high < numNodeIDs && nodeIDs[high] < value) {
+        low = high;
+        step *= 2;
+        high = pos + step;
     }
-    lSelVector.setToFiltered(outputValuePosition);
-    rSelVector.setToFiltered(outputValuePosition);
+    high = std::min(high, numNodeIDs);
+    return std::lower_bound(nodeIDs + low + 1, nodeIDs + high, value) - nodeIDs;
 }
 
 static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
@@ -117,42 +109,73 @@ static std::vector<uint32_t> swapSmallestListToFront(std::vector<overflow_value_
     return listIdxes;
 }
 
-static void sliceSelVectors(const std::vector<SelectionVector*>& selVectorsToSlice,
-    SelectionVector& slicer) {
-    for (auto selVec : selVectorsToSlice) {
-        for (auto i = 0u; i < slicer.getSelSize(); i++) {
-            auto pos = slicer[i];
-            auto buffer = selVec->getMutableBuffer();
-            buffer[i] = selVec->operator[](pos);
+// Leapfrog join of all lists at once. The lists are sorted on node ID by IntersectBuild. Lists take
+// turns seeking to the largest node ID seen so far until all of them agree on it, so the work is
+// bounded by the smallest list instead of the sum of the sizes of all lists. Like a merge join, a
+// node ID that occurs several times in every list is matched as many times as in the list holding
+// it the fewest times.
+void Intersect::intersectLists(const std::vector<overflow_value_t>& listsToIntersect) {
+    auto& outSelVector = outKeyVector->state->getSelVectorUnsafe();
+    const auto numLists = listsToIntersect.size();
+    for (auto& list : listsToIntersect) {
+        if (list.numElements == 0) {
+            outSelVector.setSelSize(0);
+            return;
+        }
+    }
+    KU_ASSERT(listsToIntersect[0].numElements <= DEFAULT_VECTOR_CAPACITY);
+    std::vector<const nodeID_t*> nodeIDs(numLists);
+    std::vector<uint64_t> positions(numLists, 0);
+    auto maxNodeID = nodeID_t{0, 0};
+    for (auto i = 0u; i < numLists; i++) {
+        nodeIDs[i] = reinterpret_cast<const nodeID_t*>(listsToIntersect[i].value);
+        maxNodeID = std::max(maxNodeID, nodeIDs[i][0]);
+    }
+    auto outNodeIDs = reinterpret_cast<nodeID_t*>(outKeyVector->getData());
+    sel_t numMatches = 0;
+    auto numListsAtMax = 0u;
+    auto listIdx = 0u;
+    while (true) {
+        auto& position = positions[listIdx];
+        position = seek(nodeIDs[listIdx], listsToIntersect[listIdx].numElements, position,
+            maxNodeID);
+        if (position == listsToIntersect[listIdx].numElements) {
+            break;
+        }
+        if (nodeIDs[listIdx][position] != maxNodeID) {
+            maxNodeID = nodeIDs[listIdx][position];
+            numListsAtMax = 1;
+        } else if (++numListsAtMax == numLists) {
+            outNodeIDs[numMatches] = maxNodeID;
+            for (auto i = 0u; i < numLists; i++) {
+                intersectSelVectors[i]->getMutableBuffer()[numMatches] = positions[i]++;
+            }
+            numMatches++;
+            if (!hasNextMatchCandidate(listsToIntersect, positions)) {
+                break;
+            }
+            // Restart from the largest node ID the lists moved to.
+            for (auto i = 0u; i < numLists; i++) {
+                maxNodeID = std::max(maxNodeID, nodeIDs[i][positions[i]]);
+            }
+            numListsAtMax = 0;
         }
-        selVec->setToFiltered(slicer.getSelSize());
+        listIdx = (listIdx + 1) % numLists;
+    }
+    for (auto i = 0u; i < numLists; i++) {
+        intersectSelVectors[i]->setToFiltered(numMatches);
     }
+    outSelVector.setSelSize(numMatches);
 }
 
-void Intersect::intersectLists(const std::vector<overflow_value_t>& listsToIntersect) {
-    if (listsToIntersect[0].numElements == 0) {
-        outKeyVector->state->getSelVectorUnsafe().setSelSize(0);
-        return;
-    }
-    KU_ASSERT(listsToIntersect[0].numElements <= DEFAULT_VECTOR_CAPACITY);
-    memcpy(outKeyVector->getData(), listsToIntersect[0].value,
-        listsToIntersect[0].numElements * sizeof(nodeID_t));
-    SelectionVector lSelVector(listsToIntersect[0].numElements);
-    lSelVector.setSelSize(listsToIntersect[0].numElements);
-    std::vector<SelectionVector*> selVectorsForIntersectedLists;
-    intersectSelVectors[0]->setToUnfiltered(listsToIntersect[0].numElements);
-    selVectorsForIntersectedLists.push_back(intersectSelVectors[0].get());
-    for (auto i = 0u; i < listsToIntersect.size() - 1; i++) {
-        intersectSelVectors[i + 1]->setToUnfiltered(listsToIntersect[i + 1].numElements);
-        twoWayIntersect((nodeID_t*)outKeyVector->getData(), lSelVector,
-            (nodeID_t*)listsToIntersect[i + 1].value, *intersectSelVectors[i + 1]);
-        // Here we need to slice all selVectors that have been previously intersected, as all these
-        // lists need to be selected synchronously to read payloads correctly.
-        sliceSelVectors(selVectorsForIntersectedLists, lSelVector);
-        lSelVector.setToUnfiltered();
-        selVectorsForIntersectedLists.push_back(intersectSelVectors[i + 1].get());
+bool Intersect::hasNextMatchCandidate(const std::vector<overflow_value_t>& listsToIntersect,
+    const std::vector<uint64_t>& positions) {
+    for (auto i = 0u; i < listsToIntersect.size(); i++) {
+        if (positions[i] == listsToIntersect[i].numElements) {
+            return false;
+        }
     }
-    outKeyVector->state->getSelVectorUnsafe().setSelSize(lSelVector.getSelSize());
+    return true;
 }
 
 void Intersect::populatePayloads(const std::vector<uint8_t*>& tuples,
@@ -278,6 +278,8 @@ void NodeBatchInsert::finalize(ExecutionContext* context) {
     for (auto& index : nodeTable.getIndexes()) {
         index.finalize(clientContext);
     }
+    // All local stats have been merged by now.
+    nodeTable.buildValueDistributions();
     // we want to flush all index errors before children call finalize
     // as the children (if they are table function calls) are responsible for populating the errors
     // and sending it to the warning context
@@ -135,6 +135,14 @@ static void appendNewChunkedGroup(MemoryManager& mm, transaction::Transaction* t
     // in the node group)
     relTable.pushInsertInfo(transaction, direction, nodeGroup, chunkedGroup.getNumRows(), source);
     if (isNewNodeGroup) {
+        // Rels appended to an existing node group are accounted for when it is checkpointed.
+        DegreeStats degreeStats;
+        const auto& csrHeader = chunkedGroup.getCSRHeader();
+        for (auto i = 0u; i < csrHeader.length->getNumValues(); i++) {
+            degreeStats.add(csrHeader.getCSRLength(i));
+        }
+        relTable.getDirectedTableData(direction)->mergeDegreeStats(degreeStats);
+        nodeGroup.setCopiedDegreeStats(std::move(degreeStats));
         auto flushedChunkedGroup = chunkedGroup.flush(transaction, pageAllocator);
 
         // If there are deleted columns that haven't been vacuumed yet
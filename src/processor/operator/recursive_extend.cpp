@@ -1,11 +1,16 @@
 #include "processor/operator/recursive_extend.h"
 
+#include <optional>
+
 #include "binder/expression/node_expression.h"
 #include "binder/expression/property_expression.h"
+#include "common/profiler.h"
 #include "common/task_system/progress_bar.h"
 #include "function/gds/compute.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/gds_utils.h"
+#include "main/client_context.h"
+#include "main/database.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
 
@@ -83,6 +88,36 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+// Returns the only node of the output node mask, or an invalid node ID if the output nodes are not
+// bound to a single node.
+static nodeID_t getBoundOutputNode(const NodeOffsetMaskMap* outputNodeMask) {
+    nodeID_t result;
+    if (outputNodeMask == nullptr || outputNodeMask->getNumMaskedNode() != 1) {
+        return result;
+    }
+    for (auto& [tableID, mask] : outputNodeMask->getMasks()) {
+        if (!mask->isEnabled()) { // All nodes of the table are in scope.
+            return nodeID_t{};
+        }
+        if (mask->getNumMaskedNodes() == 1) {
+            result = nodeID_t{mask->collectMaskedNodes(1)[0], tableID};
+        }
+    }
+    return result;
+}
+
+static bool hasEnabledMask(const NodeOffsetMaskMap* nodeMask) {
+    if (nodeMask == nullptr) {
+        return false;
+    }
+    for (auto& [_, mask] : nodeMask->getMasks()) {
+        if (mask->isEnabled()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto transaction = transaction::Transaction::Get(*clientContext);
@@ -105,7 +140,62 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         propertyNames.push_back(
             bindData.weightPropertyExpr->ptrCast<PropertyExpression>()->getPropertyName());
     }
+    // When the destination is bound, e.g. MATCH p = (a)-[* SHORTEST]->(b) WHERE b.id = 5, search
+    // from both the source and the destination.
+    std::unique_ptr<BidirectionalBFS> bidirectionalBFS;
+    auto boundOutputNodeID = getBoundOutputNode(sharedState->getOutputNodeMaskMap());
+    if (function->supportsBidirectionalSearch() && boundOutputNodeID.offset != INVALID_OFFSET &&
+        bindData.lowerBound <= 1 && bindData.semantic == PathSemantic::WALK &&
+        sharedState->getPathNodeMaskMap() == nullptr) {
+        bidirectionalBFS = std::make_unique<BidirectionalBFS>(graph, bindData.extendDirection,
+            bindData.upperBound);
+    }
+    // With landmarks enabled, a weighted shortest path to a bound destination is found with an A*
+    // search, which mostly expands nodes towards the destination.
+    std::unique_ptr<LandmarkAStar> aStar;
+    auto numLandmarks = clientContext->getClientConfig()->weightedShortestPathLandmarks;
+    if (function->supportsAStarSearch() && numLandmarks > 0 &&
+        boundOutputNodeID.offset != INVALID_OFFSET &&
+        sharedState->getPathNodeMaskMap() == nullptr) {
+        auto weightPropertyName =
+            bindData.weightPropertyExpr->constCast<PropertyExpression>().getPropertyName();
+        auto& weightType = bindData.weightPropertyExpr->getDataType();
+        auto landmarks = clientContext->getDatabase()->getLandmarkCache()->getOrBuild(
+            clientContext, bindData.graphEntry, bindData.extendDirection, weightPropertyName,
+            weightType, numLandmarks);
+        if (landmarks != nullptr) {
+            aStar = std::make_unique<LandmarkAStar>(graph, bindData.extendDirection,
+                weightPropertyName, weightType, std::move(landmarks));
+        }
+    }
+    // When the destinations are not bound, the search from each source visits the whole reachable
+    // graph. Traverse from batches of sources at once so that each adjacency list is scanned once
+    // per batch instead of once per source. A batch is traversed by a single thread, so it only
+    // pays off if there are more sources than threads to parallelize the per-source search over.
+    std::unique_ptr<MultiSourceBFS> multiSourceBFS;
+    auto hasEnoughSources = totalNumNodes >= MultiSourceBFS::MAX_NUM_SOURCES ||
+                            totalNumNodes > clientContext->getMaxNumThreadForExec();
+    if (bidirectionalBFS == nullptr && function->supportsMultiSourceSearch() &&
+        hasEnoughSources && !hasEnabledMask(sharedState->getOutputNodeMaskMap()) &&
+        sharedState->getPathNodeMaskMap() == nullptr) {
+        multiSourceBFS = std::make_unique<MultiSourceBFS>(clientContext, graph,
+            bindData.extendDirection, bindData.upperBound);
+    }
+    auto numDeltaSteppingFallbacks =
+        context->profiler->registerNumericMetric(getDeltaSteppingFallbacksMetricKey());
     offset_t completedNumNodes = 0;
+    std::vector<nodeID_t> batchSourceNodeIDs;
+    auto runBatch = [&]() {
+        if (batchSourceNodeIDs.empty() || sharedState->exceedLimit()) {
+            return;
+        }
+        function->runMultiSourceSearch(context, bindData, *multiSourceBFS, batchSourceNodeIDs,
+            sharedState.get());
+        completedNumNodes += batchSourceNodeIDs.size();
+        progressBar->updateProgress(context->queryID,
+            getRJProgress(totalNumNodes, completedNumNodes));
+        batchSourceNodeIDs.clear();
+    };
     auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
     for (auto& tableID : graph->getNodeTableIDs()) {
         // Input node table IDs could be different from graph node table IDs, e.g.
@@ -115,14 +205,66 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         if (!inputNodeTableIDSet.contains(tableID)) {
             continue;
         }
-        auto calcFunc = [tableID, propertyNames, graph, context, this](offset_t offset) {
+        auto calcFunc = [tableID, propertyNames, graph, context, &bidirectionalBFS, &aStar,
+                            boundOutputNodeID, numDeltaSteppingFallbacks, this](offset_t offset) {
             auto clientContext = context->clientContext;
             auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
             computeState->initSource(sourceNodeID);
-            GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
-                bindData.extendDirection, bindData.upperBound, sharedState->getOutputNodeMaskMap(),
-                propertyNames);
+            std::optional<std::vector<AStarStep>> aStarPath;
+            if (aStar != nullptr && sourceNodeID != boundOutputNodeID) {
+                aStarPath = aStar->search(clientContext, sourceNodeID, boundOutputNodeID);
+                // The A* search ignores the upper bound. If the shortest path it finds has more
+                // edges, search again below, which finds the shortest path within the bound.
+                if (aStarPath->size() > bindData.upperBound) {
+                    aStarPath.reset();
+                }
+            }
+            if (bidirectionalBFS != nullptr && sourceNodeID != boundOutputNodeID) {
+                // Record the path found in the compute state, one iteration per edge, so that the
+                // output writer finds it as if it had been found by the search from the source.
+                auto frontierPair = computeState->frontierPair.get();
+                auto boundNodeID = sourceNodeID;
+                for (auto& step :
+                    bidirectionalBFS->search(clientContext, sourceNodeID, boundOutputNodeID)) {
+                    frontierPair->beginNewIteration();
+                    computeState->beginFrontierCompute(boundNodeID.tableID, step.nodeID.tableID);
+                    frontierPair->addNodeToNextFrontier(step.nodeID);
+                    function->addBidirectionalSearchEdge(*computeState, boundNodeID, step);
+                    boundNodeID = step.nodeID;
+                }
+            } else if (aStarPath.has_value()) {
+                // Record the path found in the compute state as for the bidirectional search.
+                auto frontierPair = computeState->frontierPair.get();
+                auto boundNodeID = sourceNodeID;
+                for (auto& step : *aStarPath) {
+                    frontierPair->beginNewIteration();
+                    computeState->beginFrontierCompute(boundNodeID.tableID, step.nodeID.tableID);
+                    frontierPair->addNodeToNextFrontier(step.nodeID);
+                    function->addAStarSearchEdge(*computeState, boundNodeID, step);
+                    boundNodeID = step.nodeID;
+                }
+            } else if (auto buckets = function->getDeltaSteppingBuckets(*computeState)) {
+                auto outputNodeMask = sharedState->getOutputNodeMaskMap();
+                if (!GDSUtils::runDeltaSteppingEdgeCompute(context, *computeState, graph,
+                        bindData.extendDirection, *buckets, outputNodeMask, propertyNames) ||
+                    function->hasPathLongerThan(*computeState, bindData.upperBound,
+                        outputNodeMask)) {
+                    // A shortest path has more edges than the upper bound. Search again with one
+                    // more edge per iteration, which finds the shortest paths within the bound.
+                    numDeltaSteppingFallbacks->incrementByOne();
+                    computeState = function->getComputeState(context, bindData, sharedState.get());
+                    computeState->initSource(sourceNodeID);
+                    function->getDeltaSteppingBuckets(*computeState)->useSingleBucket();
+                    GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
+                        bindData.extendDirection, bindData.upperBound,
+                        sharedState->getOutputNodeMaskMap(), propertyNames);
+                }
+            } else {
+                GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
+                    bindData.extendDirection, bindData.upperBound,
+                    sharedState->getOutputNodeMaskMap(), propertyNames);
+            }
             auto writer = function->getOutputWriter(context, bindData, *computeState, sourceNodeID,
                 sharedState.get());
             auto vertexCompute = std::make_unique<RJVertexCompute>(
@@ -131,30 +273,50 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
             GDSUtils::runVertexCompute(context, computeState->frontierPair->getState(), graph,
                 *vertexCompute);
         };
+        auto processSource = [&](offset_t offset) {
+            if (multiSourceBFS == nullptr) {
+                calcFunc(offset);
+                progressBar->updateProgress(context->queryID,
+                    getRJProgress(totalNumNodes, completedNumNodes++));
+                return;
+            }
+            batchSourceNodeIDs.push_back(nodeID_t{offset, tableID});
+            if (batchSourceNodeIDs.size() == MultiSourceBFS::MAX_NUM_SOURCES) {
+                runBatch();
+            }
+        };
         auto maxOffset = graph->getMaxOffset(transaction, tableID);
         if (inputNodeMaskMap && inputNodeMaskMap->getOffsetMask(tableID)->isEnabled()) {
             for (const auto& offset :
                 inputNodeMaskMap->getOffsetMask(tableID)->range(0, maxOffset)) {
-                calcFunc(offset);
-                progressBar->updateProgress(context->queryID,
-                    getRJProgress(totalNumNodes, completedNumNodes++));
+                processSource(offset);
                 if (sharedState->exceedLimit()) {
                     break;
                 }
             }
         } else {
             for (auto offset = 0u; offset < maxOffset; ++offset) {
-                calcFunc(offset);
-                progressBar->updateProgress(context->queryID,
-                    getRJProgress(totalNumNodes, completedNumNodes++));
+                processSource(offset);
                 if (sharedState->exceedLimit()) {
                     break;
                 }
             }
         }
     }
+    runBatch();
     sharedState->factorizedTablePool.mergeLocalTables();
 }
 
+std::unordered_map<std::string, std::string> RecursiveExtend::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    if (bindData.weightPropertyExpr != nullptr) {
+        result.insert({"DeltaSteppingFallbacks",
+            std::to_string(
+                profiler.sumAllNumericMetricsWithKey(getDeltaSteppingFallbacksMetricKey()))});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
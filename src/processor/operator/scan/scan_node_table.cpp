@@ -48,17 +48,22 @@ void ScanNodeTableSharedState::initialize(const transaction::Transaction* transa
 
 void ScanNodeTableSharedState::nextMorsel(NodeTableScanState& scanState,
     ScanNodeTableProgressSharedState& progressSharedState) {
-    std::unique_lock lck{mtx};
-    if (currentCommittedGroupIdx < numCommittedNodeGroups) {
-        scanState.nodeGroupIdx = currentCommittedGroupIdx++;
-        progressSharedState.numGroupsScanned++;
-        scanState.source = TableScanSource::COMMITTED;
-        return;
+    if (currentCommittedGroupIdx.load(std::memory_order_relaxed) < numCommittedNodeGroups) {
+        const auto groupIdx = currentCommittedGroupIdx.fetch_add(1, std::memory_order_relaxed);
+        if (groupIdx < numCommittedNodeGroups) {
+            scanState.nodeGroupIdx = groupIdx;
+            progressSharedState.numGroupsScanned++;
+            scanState.source = TableScanSource::COMMITTED;
+            return;
+        }
     }
-    if (currentUnCommittedGroupIdx < numUnCommittedNodeGroups) {
-        scanState.nodeGroupIdx = currentUnCommittedGroupIdx++;
-        scanState.source = TableScanSource::UNCOMMITTED;
-        return;
+    if (currentUnCommittedGroupIdx.load(std::memory_order_relaxed) < numUnCommittedNodeGroups) {
+        const auto groupIdx = currentUnCommittedGroupIdx.fetch_add(1, std::memory_order_relaxed);
+        if (groupIdx < numUnCommittedNodeGroups) {
+            scanState.nodeGroupIdx = groupIdx;
+            scanState.source = TableScanSource::UNCOMMITTED;
+            return;
+        }
     }
     scanState.source = TableScanSource::NONE;
 }
@@ -0,0 +1,136 @@
+#include "processor/operator/streaming_result_collector.h"
+
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+bool StreamingResultCollectorSharedState::push(std::shared_ptr<FactorizedTable> table,
+    uint64_t timeoutInMS) {
+    const auto numTuples = table->getTotalNumFlatTuples();
+    std::unique_lock lck{mtx};
+    // A table is always accepted by an empty queue so that tables larger than the queue capacity
+    // can still be consumed.
+    const auto hasSpace = [&]() {
+        return cancelled || tables.empty() || numBufferedTuples < maxNumBufferedTuples;
+    };
+    if (!notFull.wait_for(lck, std::chrono::milliseconds(timeoutInMS), hasSpace) || cancelled) {
+        return false;
+    }
+    numBufferedTuples += numTuples;
+    tables.push_back(BufferedTable{std::move(table), numTuples});
+    notEmpty.notify_one();
+    return true;
+}
+
+void StreamingResultCollectorSharedState::finish() {
+    std::unique_lock lck{mtx};
+    finished = true;
+    notEmpty.notify_all();
+}
+
+void StreamingResultCollectorSharedState::finishWithError(std::string errorMessage_) {
+    std::unique_lock lck{mtx};
+    finished = true;
+    errorMessage = std::move(errorMessage_);
+    notEmpty.notify_all();
+}
+
+std::shared_ptr<FactorizedTable> StreamingResultCollectorSharedState::pop() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&]() { return cancelled || finished || !tables.empty(); });
+    throwIfCancelled();
+    if (tables.empty()) {
+        if (!errorMessage.empty()) {
+            throw Exception(errorMessage);
+        }
+        return nullptr;
+    }
+    auto bufferedTable = std::move(tables.front());
+    tables.pop_front();
+    numBufferedTuples -= bufferedTable.numTuples;
+    notFull.notify_all();
+    return std::move(bufferedTable.table);
+}
+
+void StreamingResultCollectorSharedState::waitForResult() {
+    std::unique_lock lck{mtx};
+    notEmpty.wait(lck, [&]() { return cancelled || finished || !tables.empty(); });
+}
+
+bool StreamingResultCollectorSharedState::hasError() const {
+    std::unique_lock lck{mtx};
+    return !errorMessage.empty();
+}
+
+std::string StreamingResultCollectorSharedState::getErrorMessage() const {
+    std::unique_lock lck{mtx};
+    return errorMessage;
+}
+
+void StreamingResultCollectorSharedState::cancel() {
+    std::unique_lock lck{mtx};
+    cancelled = true;
+    tables.clear();
+    numBufferedTuples = 0;
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+void StreamingResultCollectorSharedState::throwIfCancelled() const {
+    if (cancelled) {
+        throw RuntimeException("The streaming query result has been closed.");
+    }
+}
+
+void StreamingResultCollector::initLocalStateInternal(ResultSet* resultSet,
+    ExecutionContext* context) {
+    payloadVectors.reserve(info.payloadPositions.size());
+    for (auto& pos : info.payloadPositions) {
+        payloadVectors.push_back(resultSet->getValueVector(pos).get());
+        payloadChunkPositions.insert(pos.dataChunkPos);
+    }
+    localTable = std::make_unique<FactorizedTable>(MemoryManager::Get(*context->clientContext),
+        info.tableSchema.copy());
+}
+
+void StreamingResultCollector::executeInternal(ExecutionContext* context) {
+    while (children[0]->getNextTuple(context)) {
+        if (payloadVectors.empty()) {
+            continue;
+        }
+        for (auto i = 0u; i < resultSet->multiplicity; i++) {
+            localTable->append(payloadVectors);
+        }
+        numLocalFlatTuples += resultSet->getNumTuples(payloadChunkPositions);
+        if (numLocalFlatTuples >= DEFAULT_VECTOR_CAPACITY) {
+            pushLocalTable(context);
+        }
+    }
+    if (!localTable->isEmpty()) {
+        pushLocalTable(context);
+    }
+}
+
+void StreamingResultCollector::pushLocalTable(ExecutionContext* context) {
+    metrics->numOutputTuple.increase(numLocalFlatTuples);
+    std::shared_ptr<FactorizedTable> table = std::move(localTable);
+    while (!sharedState->push(table, PUSH_WAIT_INTERVAL_IN_MS)) {
+        if (sharedState->isCancelled() || context->clientContext->interrupted()) {
+            throw InterruptException{};
+        }
+    }
+    localTable = std::make_unique<FactorizedTable>(MemoryManager::Get(*context->clientContext),
+        info.tableSchema.copy());
+    numLocalFlatTuples = 0;
+}
+
+} // namespace processor
+} // namespace kuzu
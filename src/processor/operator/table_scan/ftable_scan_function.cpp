@@ -1,5 +1,7 @@
 #include "processor/operator/table_scan/ftable_scan_function.h"
 
+#include <atomic>
+
 #include "function/table/simple_table_function.h"
 #include "processor/result/factorized_table.h"
 
@@ -12,18 +14,21 @@ namespace processor {
 struct FTableScanSharedState final : public SimpleTableFuncSharedState {
     std::shared_ptr<FactorizedTable> table;
     uint64_t morselSize;
-    offset_t nextTupleIdx;
+    // Morsels are claimed with an atomic increment, so scanning threads do not serialize on mtx.
+    std::atomic<offset_t> nextTupleIdx;
 
     FTableScanSharedState(std::shared_ptr<FactorizedTable> table, uint64_t morselSize)
         : SimpleTableFuncSharedState{table->getNumTuples()}, table{std::move(table)},
           morselSize{morselSize}, nextTupleIdx{0} {}
 
     TableFuncMorsel getMorsel() override {
-        std::unique_lock lck{mtx};
-        auto numTuplesToScan = std::min(morselSize, table->getNumTuples() - nextTupleIdx);
-        auto morsel = TableFuncMorsel(nextTupleIdx, nextTupleIdx + numTuplesToScan);
-        nextTupleIdx += numTuplesToScan;
-        return morsel;
+        const auto numTuples = table->getNumTuples();
+        if (nextTupleIdx.load(std::memory_order_relaxed) >= numTuples) {
+            return TableFuncMorsel(numTuples, numTuples);
+        }
+        const auto startIdx =
+            std::min(nextTupleIdx.fetch_add(morselSize, std::memory_order_relaxed), numTuples);
+        return TableFuncMorsel(startIdx, std::min(startIdx + morselSize, numTuples));
     }
 };
 
@@ -1,6 +1,6 @@
 #include "processor/operator/table_scan/union_all_scan.h"
 
-#include <mutex>
+#include <algorithm>
 
 #include "binder/expression/expression_util.h"
 #include "common/metric.h"
@@ -16,30 +16,38 @@ std::string UnionAllScanPrintInfo::toString() const {
     return result;
 }
 
+void UnionAllScanSharedState::initialize() {
+    morselStartIdxPerTable.clear();
+    uint64_t numMorsels = 0;
+    for (auto& table : tables) {
+        morselStartIdxPerTable.push_back(numMorsels);
+        numMorsels += (table->getNumTuples() + maxMorselSize - 1) / maxMorselSize;
+    }
+    morselStartIdxPerTable.push_back(numMorsels);
+    nextMorselIdx = 0;
+}
+
 std::unique_ptr<UnionAllScanMorsel> UnionAllScanSharedState::getMorsel() {
-    std::unique_lock lck{mtx};
-    if (tableIdx == tables.size()) { // No more to scan.
+    const auto numMorsels = morselStartIdxPerTable.back();
+    if (nextMorselIdx.load(std::memory_order_relaxed) >= numMorsels) { // No more to scan.
         return std::make_unique<UnionAllScanMorsel>(nullptr /* table */, 0, 0);
     }
-    auto morsel = getMorselNoLock(tables[tableIdx].get());
-    // Fetch next table if current table has nothing to scan.
-    while (morsel->numTuples == 0) {
-        tableIdx++;
-        nextTupleIdxToScan = 0;
-        if (tableIdx == tables.size()) { // No more to scan.
-            return std::make_unique<UnionAllScanMorsel>(nullptr /* table */, 0, 0);
-        }
-        morsel = getMorselNoLock(tables[tableIdx].get());
+    const auto morselIdx = nextMorselIdx.fetch_add(1, std::memory_order_relaxed);
+    if (morselIdx >= numMorsels) {
+        return std::make_unique<UnionAllScanMorsel>(nullptr /* table */, 0, 0);
     }
-    return morsel;
+    // Find the table the morsel belongs to. Tables without tuples own no morsels and are skipped.
+    const auto it = std::upper_bound(morselStartIdxPerTable.begin(),
+        morselStartIdxPerTable.end(), morselIdx);
+    const auto tableIdx = it - morselStartIdxPerTable.begin() - 1;
+    auto table = tables[tableIdx].get();
+    const auto startTupleIdx = (morselIdx - morselStartIdxPerTable[tableIdx]) * maxMorselSize;
+    const auto numTuples = std::min(maxMorselSize, table->getNumTuples() - startTupleIdx);
+    return std::make_unique<UnionAllScanMorsel>(table, startTupleIdx, numTuples);
 }
 
-std::unique_ptr<UnionAllScanMorsel> UnionAllScanSharedState::getMorselNoLock(
-    FactorizedTable* table) {
-    auto numTuplesToScan = std::min(maxMorselSize, table->getNumTuples() - nextTupleIdxToScan);
-    auto morsel = std::make_unique<UnionAllScanMorsel>(table, nextTupleIdxToScan, numTuplesToScan);
-    nextTupleIdxToScan += numTuplesToScan;
-    return morsel;
+void UnionAllScan::initGlobalStateInternal(ExecutionContext* /*context*/) {
+    sharedState->initialize();
 }
 
 void UnionAllScan::initLocalStateInternal(ResultSet* /*resultSet_*/,
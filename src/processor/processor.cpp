@@ -1,10 +1,12 @@
 #include "processor/processor.h"
 
 #include "common/task_system/progress_bar.h"
+#include "main/client_context.h"
 #include "main/query_result.h"
 #include "processor/operator/sink.h"
 #include "processor/physical_plan.h"
 #include "processor/processor_task.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -22,8 +24,80 @@ QueryProcessor::QueryProcessor(uint64_t numThreads) {
 }
 #endif
 
+// Dependency pipelines can only be scheduled concurrently if they share state exclusively through
+// their parent-child relationships. E.g., a semi masker fills masks that are read by a scan in a
+// different pipeline, and write operators are not safe to run concurrently with each other.
+static bool canScheduleDependenciesConcurrently(const PhysicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case PhysicalOperatorType::AGGREGATE:
+    case PhysicalOperatorType::AGGREGATE_FINALIZE:
+    case PhysicalOperatorType::AGGREGATE_SCAN:
+    case PhysicalOperatorType::CROSS_PRODUCT:
+    case PhysicalOperatorType::EMPTY_RESULT:
+    case PhysicalOperatorType::FILTER:
+    case PhysicalOperatorType::FLATTEN:
+    case PhysicalOperatorType::HASH_JOIN_BUILD:
+    case PhysicalOperatorType::HASH_JOIN_PROBE:
+    case PhysicalOperatorType::INTERSECT_BUILD:
+    case PhysicalOperatorType::INTERSECT:
+    case PhysicalOperatorType::LIMIT:
+    case PhysicalOperatorType::MULTIPLICITY_REDUCER:
+    case PhysicalOperatorType::PATH_PROPERTY_PROBE:
+    case PhysicalOperatorType::PRIMARY_KEY_SCAN_NODE_TABLE:
+    case PhysicalOperatorType::PROJECTION:
+    case PhysicalOperatorType::RECURSIVE_EXTEND:
+    case PhysicalOperatorType::RESULT_COLLECTOR:
+    case PhysicalOperatorType::SCAN_NODE_TABLE:
+    case PhysicalOperatorType::SCAN_REL_TABLE:
+    case PhysicalOperatorType::SKIP:
+    case PhysicalOperatorType::TOP_K:
+    case PhysicalOperatorType::TOP_K_SCAN:
+    case PhysicalOperatorType::ORDER_BY:
+    case PhysicalOperatorType::ORDER_BY_MERGE:
+    case PhysicalOperatorType::ORDER_BY_SCAN:
+    case PhysicalOperatorType::UNION_ALL_SCAN:
+    case PhysicalOperatorType::UNWIND:
+        break;
+    default:
+        return false;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (!canScheduleDependenciesConcurrently(op->getChild(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Holds the admission of a query to its workload class for the duration of its execution.
+struct WorkloadClassAdmission {
+    WorkloadClassManager* manager;
+    std::string className;
+    const main::ClientContext* clientContext;
+
+    WorkloadClassAdmission(WorkloadClassManager* manager, std::string className,
+        const main::ClientContext* clientContext)
+        : manager{manager}, className{std::move(className)}, clientContext{clientContext} {}
+    DELETE_COPY_AND_MOVE(WorkloadClassAdmission);
+    ~WorkloadClassAdmission() { manager->finishQuery(className, *clientContext); }
+};
+
 std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physicalPlan,
     ExecutionContext* context) {
+    auto workloadClassManager = taskScheduler->getWorkloadClassManager();
+    const auto& className = context->clientContext->getClientConfig()->workloadClass;
+    auto workloadClass = workloadClassManager->admitQuery(className, *context->clientContext);
+    WorkloadClassAdmission admission{workloadClassManager, className, context->clientContext};
+    context->priority = workloadClass.priority;
+    // The class might have been redefined since the connection was assigned to it.
+    context->clientContext->getClientConfigUnsafe()->workloadClassMaxNumThreads =
+        workloadClass.maxNumThreads;
+    if (workloadClass.maxMemoryPerQuery != 0) {
+        context->memoryTracker =
+            std::make_shared<QueryMemoryTracker>(workloadClass.maxMemoryPerQuery);
+    }
+    // Worker threads charge the tasks of the query to the tracker as well, see TaskScheduler.
+    QueryMemoryTrackerScope memoryTrackerScope{context->memoryTracker};
     auto lastOperator = physicalPlan->lastOperator.get();
     // The root pipeline(task) consists of operators and its prevOperator only, because we
     // expect to have linear plans. For binary operators, e.g., HashJoin, we  keep probe and its
@@ -35,6 +109,10 @@ std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physica
         decomposePlanIntoTask(sink->getChild(i), task.get(), context);
     }
     initTask(task.get());
+    if (context->clientContext->getClientConfig()->enableInterPipelineParallelism &&
+        canScheduleDependenciesConcurrently(sink)) {
+        task->setConcurrentDependencies();
+    }
     auto progressBar = ProgressBar::Get(*context->clientContext);
     progressBar->startProgress(context->queryID);
     taskScheduler->scheduleTaskAndWaitOrError(task, context);
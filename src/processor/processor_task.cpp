@@ -2,7 +2,6 @@
 
 #include "common/task_system/progress_bar.h"
 #include "main/client_context.h"
-#include "main/settings.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -12,8 +11,7 @@ namespace kuzu {
 namespace processor {
 
 ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
-    : Task{executionContext->clientContext->getCurrentSetting(main::ThreadsSetting::name)
-               .getValue<uint64_t>()},
+    : Task{executionContext->clientContext->getMaxNumThreadForExec()},
       sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
 
 void ProcessorTask::run() {
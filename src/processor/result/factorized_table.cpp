@@ -257,6 +257,11 @@ bool FactorizedTable::hasUnflatCol() const {
     return hasUnflatCol(colIdxes);
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    return flatTupleBlockCollection->getMemoryUsage() +
+           unFlatTupleBlockCollection->getMemoryUsage() + inMemOverflowBuffer->getMemoryUsage();
+}
+
 uint64_t FactorizedTable::getTotalNumFlatTuples() const {
     auto totalNumFlatTuples = 0ul;
     for (auto i = 0u; i < getNumTuples(); i++) {
@@ -4,6 +4,7 @@
 
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/string_format.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
 #include "main/database.h"
@@ -19,6 +20,9 @@ MemoryBuffer::MemoryBuffer(MemoryManager* mm, page_idx_t pageIdx, uint8_t* buffe
     : buffer{buffer, static_cast<size_t>(size)}, mm{mm}, pageIdx{pageIdx}, evicted{false} {}
 
 MemoryBuffer::~MemoryBuffer() {
+    if (memoryTracker != nullptr) {
+        memoryTracker->release(buffer.size());
+    }
     if (buffer.data() != nullptr && !evicted) {
         mm->freeBlock(pageIdx, buffer);
         mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
@@ -26,6 +30,28 @@ MemoryBuffer::~MemoryBuffer() {
     }
 }
 
+void QueryMemoryTracker::reserve(uint64_t size) {
+    const auto newUsedMemory = usedMemory.fetch_add(size, std::memory_order_relaxed) + size;
+    if (memoryLimit != 0 && newUsedMemory > memoryLimit) {
+        usedMemory.fetch_sub(size, std::memory_order_relaxed);
+        throw BufferManagerException(stringFormat(
+            "Unable to allocate memory! The query exceeds the memory limit of {} bytes of its "
+            "workload class.",
+            memoryLimit));
+    }
+}
+
+// The tracker of the query the current thread is working on, if any.
+static thread_local std::shared_ptr<QueryMemoryTracker> currentQueryMemoryTracker = nullptr;
+
+void MemoryManager::setQueryMemoryTracker(std::shared_ptr<QueryMemoryTracker> memoryTracker) {
+    currentQueryMemoryTracker = std::move(memoryTracker);
+}
+
+std::shared_ptr<QueryMemoryTracker> MemoryManager::getQueryMemoryTracker() {
+    return currentQueryMemoryTracker;
+}
+
 SpillResult MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
     mm->freeBlock(pageIdx, buffer);
     // reinterpret_cast isn't allowed here, but we shouldn't leave the invalid pointer and
@@ -67,6 +93,25 @@ std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t s
 }
 
 std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZero, uint64_t size) {
+    auto memoryTracker = currentQueryMemoryTracker;
+    if (memoryTracker != nullptr) {
+        memoryTracker->reserve(size);
+    }
+    std::unique_ptr<MemoryBuffer> memoryBuffer;
+    try {
+        memoryBuffer = allocateBufferInternal(initializeToZero, size);
+    } catch (...) {
+        if (memoryTracker != nullptr) {
+            memoryTracker->release(size);
+        }
+        throw;
+    }
+    memoryBuffer->memoryTracker = std::move(memoryTracker);
+    return memoryBuffer;
+}
+
+std::unique_ptr<MemoryBuffer> MemoryManager::allocateBufferInternal(bool initializeToZero,
+    uint64_t size) {
     if (size != TEMP_PAGE_SIZE) [[unlikely]] {
         auto buffer = mallocBuffer(initializeToZero, size);
         return std::make_unique<MemoryBuffer>(this, INVALID_PAGE_IDX, buffer.data(), size);
@@ -86,7 +86,7 @@ bool LocalNodeTable::update(Transaction* transaction, TableUpdateState& updateSt
     const auto [nodeGroupIdx, rowIdxInGroup] =
         StorageUtils::getQuotientRemainder(offset - startOffset, StorageConfig::NODE_GROUP_SIZE);
     const auto nodeGroup = nodeGroups.getNodeGroup(nodeGroupIdx);
-    nodeGroup->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
+    nodeGroup->update(transaction, table.getTableID(), rowIdxInGroup, nodeUpdateState.columnID,
         nodeUpdateState.propertyVector);
     return true;
 }
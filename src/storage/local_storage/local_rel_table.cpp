@@ -100,7 +100,7 @@ bool LocalRelTable::update(Transaction* transaction, TableUpdateState& state) {
         return false;
     }
     KU_ASSERT(updateState.columnID != NBR_ID_COLUMN_ID);
-    localNodeGroup->update(transaction, matchedRow,
+    localNodeGroup->update(transaction, table.cast<RelTable>().getRelGroupID(), matchedRow,
         rewriteLocalColumnID(RelDataDirection::FWD /* This is a dummy direction */,
             updateState.columnID),
         updateState.propertyVector);
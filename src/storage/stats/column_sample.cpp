@@ -0,0 +1,183 @@
+#include "storage/stats/column_sample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace kuzu {
+namespace storage {
+
+std::optional<double> MostCommonValues::getFrequency(common::hash_t hash) const {
+    for (auto& [valueHash, frequency] : values) {
+        if (valueHash == hash) {
+            return frequency;
+        }
+    }
+    return std::nullopt;
+}
+
+double EquiDepthHistogram::getFractionLessThan(double value, bool inclusive) const {
+    KU_ASSERT(!bounds.empty());
+    // For an inclusive bound, values equal to value are counted as smaller.
+    const auto it = inclusive ? std::upper_bound(bounds.begin(), bounds.end(), value) :
+                                std::lower_bound(bounds.begin(), bounds.end(), value);
+    if (it == bounds.begin()) {
+        return 0;
+    }
+    if (it == bounds.end()) {
+        return 1;
+    }
+    const auto bucketIdx = static_cast<uint64_t>(it - bounds.begin()) - 1;
+    const auto lower = bounds[bucketIdx];
+    const auto upper = bounds[bucketIdx + 1];
+    // Assume values are uniformly distributed within a bucket.
+    const auto fractionOfBucket = upper > lower ? (value - lower) / (upper - lower) : 1.0;
+    return (static_cast<double>(bucketIdx) + fractionOfBucket) /
+           static_cast<double>(bounds.size() - 1);
+}
+
+uint64_t ColumnSample::nextRandom() {
+    randomState += 0x9e3779b97f4a7c15;
+    auto z = randomState;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+void ColumnSample::insert(common::hash_t hash, double value) {
+    numValues++;
+    if (entries.size() < CAPACITY) {
+        entries.push_back(Entry{hash, value});
+        return;
+    }
+    // Algorithm R: the i-th value replaces a random entry with probability CAPACITY / i.
+    const auto idx = nextRandom() % numValues;
+    if (idx < CAPACITY) {
+        entries[idx] = Entry{hash, value};
+    }
+}
+
+void ColumnSample::merge(const ColumnSample& other) {
+    KU_ASSERT(hasNumericValues_ == other.hasNumericValues_);
+    if (other.numValues == 0) {
+        return;
+    }
+    if (numValues == 0) {
+        numValues = other.numValues;
+        entries = other.entries;
+        return;
+    }
+    // Each side contributes entries in proportion to the number of values it was sampled from.
+    const auto numEntries = std::min<uint64_t>(CAPACITY, entries.size() + other.entries.size());
+    const auto share = static_cast<double>(numValues) / (numValues + other.numValues);
+    auto numEntriesFromThis = static_cast<uint64_t>(std::llround(numEntries * share));
+    numEntriesFromThis = std::min<uint64_t>(numEntriesFromThis, entries.size());
+    numEntriesFromThis =
+        std::max<uint64_t>(numEntriesFromThis, numEntries - other.entries.size());
+    const auto numEntriesFromOther = numEntries - numEntriesFromThis;
+    // Partial Fisher-Yates shuffles to pick uniformly random subsets of both samples.
+    for (auto i = 0u; i < numEntriesFromThis; i++) {
+        std::swap(entries[i], entries[i + nextRandom() % (entries.size() - i)]);
+    }
+    entries.resize(numEntriesFromThis);
+    auto otherEntries = other.entries;
+    for (auto i = 0u; i < numEntriesFromOther; i++) {
+        std::swap(otherEntries[i], otherEntries[i + nextRandom() % (otherEntries.size() - i)]);
+    }
+    entries.insert(entries.end(), otherEntries.begin(),
+        otherEntries.begin() + static_cast<int64_t>(numEntriesFromOther));
+    numValues += other.numValues;
+}
+
+MostCommonValues ColumnSample::getMostCommonValues() const {
+    MostCommonValues result;
+    if (entries.empty()) {
+        return result;
+    }
+    std::unordered_map<common::hash_t, uint64_t> counts;
+    for (auto& entry : entries) {
+        counts[entry.hash]++;
+    }
+    // A value seen once in a partial sample says nothing about its frequency in the column.
+    const auto isExhaustive = entries.size() == numValues;
+    std::vector<std::pair<common::hash_t, uint64_t>> candidates;
+    for (auto& [hash, count] : counts) {
+        if (count > 1 || isExhaustive) {
+            candidates.emplace_back(hash, count);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+        [](const auto& a, const auto& b) { return a.second > b.second; });
+    if (candidates.size() > MostCommonValues::MAX_NUM_VALUES) {
+        candidates.resize(MostCommonValues::MAX_NUM_VALUES);
+    }
+    for (auto& [hash, count] : candidates) {
+        const auto frequency = static_cast<double>(count) / entries.size();
+        result.values.emplace_back(hash, frequency);
+        result.totalFrequency += frequency;
+    }
+    return result;
+}
+
+EquiDepthHistogram ColumnSample::getHistogram() const {
+    EquiDepthHistogram result;
+    if (!hasNumericValues_ || entries.empty()) {
+        return result;
+    }
+    std::vector<double> values;
+    values.reserve(entries.size());
+    for (auto& entry : entries) {
+        values.push_back(entry.value);
+    }
+    std::sort(values.begin(), values.end());
+    const auto numBuckets =
+        std::max<uint64_t>(1, std::min<uint64_t>(EquiDepthHistogram::MAX_NUM_BUCKETS,
+                                  values.size() - 1));
+    result.bounds.reserve(numBuckets + 1);
+    for (auto i = 0u; i <= numBuckets; i++) {
+        result.bounds.push_back(values[i * (values.size() - 1) / numBuckets]);
+    }
+    return result;
+}
+
+void ColumnSample::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("has_numeric_values");
+    serializer.serializeValue(hasNumericValues_);
+    serializer.writeDebuggingInfo("num_values");
+    serializer.serializeValue(numValues);
+    // The values of non-numeric columns are not used, so only their hashes are written.
+    serializer.writeDebuggingInfo("entries");
+    serializer.serializeValue<uint64_t>(entries.size());
+    for (auto& entry : entries) {
+        serializer.serializeValue(entry.hash);
+        if (hasNumericValues_) {
+            serializer.serializeValue(entry.value);
+        }
+    }
+}
+
+ColumnSample ColumnSample::deserialize(common::Deserializer& deserializer) {
+    ColumnSample result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "has_numeric_values");
+    deserializer.deserializeValue(result.hasNumericValues_);
+    deserializer.validateDebuggingInfo(info, "num_values");
+    deserializer.deserializeValue(result.numValues);
+    deserializer.validateDebuggingInfo(info, "entries");
+    uint64_t numEntries = 0;
+    deserializer.deserializeValue(numEntries);
+    result.entries.resize(numEntries, Entry{0, 0});
+    for (auto& entry : result.entries) {
+        deserializer.deserializeValue(entry.hash);
+        if (result.hasNumericValues_) {
+            deserializer.deserializeValue(entry.value);
+        }
+    }
+    // The random state isn't persisted. Seeding it with the number of values keeps the sample
+    // reproducible after a restart.
+    result.randomState = result.numValues;
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
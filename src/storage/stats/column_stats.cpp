@@ -1,13 +1,72 @@
 #include "storage/stats/column_stats.h"
 
+#include "common/types/value/value.h"
 #include "function/hash/vector_hash_functions.h"
 
 namespace kuzu {
 namespace storage {
 
+static bool hasNumericPhysicalType(const common::LogicalType& dataType) {
+    switch (dataType.getPhysicalType()) {
+    case common::PhysicalTypeID::INT8:
+    case common::PhysicalTypeID::INT16:
+    case common::PhysicalTypeID::INT32:
+    case common::PhysicalTypeID::INT64:
+    case common::PhysicalTypeID::UINT8:
+    case common::PhysicalTypeID::UINT16:
+    case common::PhysicalTypeID::UINT32:
+    case common::PhysicalTypeID::UINT64:
+    case common::PhysicalTypeID::FLOAT:
+    case common::PhysicalTypeID::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename GET_VALUE>
+static double getNumericValue(common::PhysicalTypeID physicalType, GET_VALUE getValue) {
+    switch (physicalType) {
+    case common::PhysicalTypeID::INT8:
+        return getValue(int8_t{});
+    case common::PhysicalTypeID::INT16:
+        return getValue(int16_t{});
+    case common::PhysicalTypeID::INT32:
+        return getValue(int32_t{});
+    case common::PhysicalTypeID::INT64:
+        return getValue(int64_t{});
+    case common::PhysicalTypeID::UINT8:
+        return getValue(uint8_t{});
+    case common::PhysicalTypeID::UINT16:
+        return getValue(uint16_t{});
+    case common::PhysicalTypeID::UINT32:
+        return getValue(uint32_t{});
+    case common::PhysicalTypeID::UINT64:
+        return getValue(uint64_t{});
+    case common::PhysicalTypeID::FLOAT:
+        return getValue(float{});
+    case common::PhysicalTypeID::DOUBLE:
+        return getValue(double{});
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+static double getNumericValue(const common::ValueVector& vector, common::sel_t pos) {
+    return getNumericValue(vector.dataType.getPhysicalType(), [&]<typename T>(T) {
+        return static_cast<double>(vector.getValue<T>(pos));
+    });
+}
+
+static double getNumericValue(const common::Value& value) {
+    return getNumericValue(value.getDataType().getPhysicalType(),
+        [&]<typename T>(T) { return static_cast<double>(value.getValue<T>()); });
+}
+
 ColumnStats::ColumnStats(const common::LogicalType& dataType) : hashes{nullptr} {
     if (!common::LogicalTypeUtils::isNested(dataType)) {
         hll.emplace();
+        sample.emplace(hasNumericPhysicalType(dataType));
     }
 }
 
@@ -23,10 +82,62 @@ void ColumnStats::update(const common::ValueVector* vector) {
         for (auto i = 0u; i < hashes->state->getSelVector().getSelSize(); i++) {
             hll->insertElement(hashes->getValue<common::hash_t>(i));
         }
+        if (sample) {
+            const auto& selVector = vector->state->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                const auto pos = selVector[i];
+                if (vector->isNull(pos)) {
+                    continue;
+                }
+                sample->insert(hashes->getValue<common::hash_t>(pos),
+                    sample->hasNumericValues() ? getNumericValue(*vector, pos) : 0);
+            }
+        }
         hashes->state = nullptr;
         hashes->setAllNonNull();
     }
 }
 
+void ColumnStats::buildValueDistribution() {
+    if (!sample) {
+        return;
+    }
+    mostCommonValues = sample->getMostCommonValues();
+    histogram = sample->getHistogram();
+}
+
+std::optional<double> ColumnStats::estimateEqualitySelectivity(const common::Value& value) const {
+    if (!sample || sample->empty() || value.isNull()) {
+        return std::nullopt;
+    }
+    // Hashes the value directly, which matches the hashes of the sampled values of non-nested
+    // columns and doesn't need a memory manager for the overflow of long strings.
+    const auto frequency = mostCommonValues.getFrequency(value.computeHash());
+    if (frequency.has_value()) {
+        return frequency;
+    }
+    // Spread the remaining values evenly over the remaining distinct values.
+    const auto numDistinctValues = static_cast<double>(getNumDistinctValues());
+    const auto numOtherValues =
+        std::max(1.0, numDistinctValues - static_cast<double>(mostCommonValues.values.size()));
+    return std::max(0.0, 1.0 - mostCommonValues.totalFrequency) / numOtherValues;
+}
+
+std::optional<double> ColumnStats::estimateRangeSelectivity(const common::Value& value,
+    bool lessThan, bool inclusive) const {
+    if (!sample || !sample->hasNumericValues() || value.isNull() ||
+        !hasNumericPhysicalType(value.getDataType())) {
+        return std::nullopt;
+    }
+    if (histogram.empty()) {
+        return std::nullopt;
+    }
+    const auto numericValue = getNumericValue(value);
+    if (lessThan) {
+        return histogram.getFractionLessThan(numericValue, inclusive);
+    }
+    return 1.0 - histogram.getFractionLessThan(numericValue, !inclusive);
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,126 @@
+#include "storage/stats/degree_stats.h"
+
+#include <bit>
+
+namespace kuzu {
+namespace storage {
+
+uint64_t DegreeStats::getBucketIdx(common::length_t degree) {
+    KU_ASSERT(degree > 0);
+    return std::bit_width(degree) - 1;
+}
+
+void DegreeStats::add(common::length_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    numNodes++;
+    numRels += degree;
+    sumOfSquaredDegrees += static_cast<double>(degree) * static_cast<double>(degree);
+    maxDegree = std::max<uint64_t>(maxDegree, degree);
+    histogram[getBucketIdx(degree)]++;
+}
+
+void DegreeStats::remove(common::length_t degree) {
+    if (degree == 0) {
+        return;
+    }
+    const auto bucketIdx = getBucketIdx(degree);
+    KU_ASSERT(numNodes > 0 && numRels >= degree && histogram[bucketIdx] > 0);
+    numNodes--;
+    numRels -= degree;
+    sumOfSquaredDegrees = std::max(0.0,
+        sumOfSquaredDegrees - static_cast<double>(degree) * static_cast<double>(degree));
+    histogram[bucketIdx]--;
+}
+
+void DegreeStats::merge(const DegreeStats& other) {
+    numNodes += other.numNodes;
+    numRels += other.numRels;
+    sumOfSquaredDegrees += other.sumOfSquaredDegrees;
+    maxDegree = std::max(maxDegree, other.maxDegree);
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        histogram[i] += other.histogram[i];
+    }
+}
+
+void DegreeStats::subtract(const DegreeStats& other) {
+    KU_ASSERT(numNodes >= other.numNodes && numRels >= other.numRels);
+    numNodes -= other.numNodes;
+    numRels -= other.numRels;
+    sumOfSquaredDegrees = std::max(0.0, sumOfSquaredDegrees - other.sumOfSquaredDegrees);
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        KU_ASSERT(histogram[i] >= other.histogram[i]);
+        histogram[i] -= other.histogram[i];
+    }
+}
+
+uint64_t DegreeStats::getDegreeAtPercentile(double percentile) const {
+    KU_ASSERT(percentile >= 0 && percentile <= 1);
+    if (numNodes == 0) {
+        return 0;
+    }
+    const auto target = percentile * static_cast<double>(numNodes);
+    double numNodesSoFar = 0;
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        if (histogram[i] == 0) {
+            continue;
+        }
+        const auto numNodesInBucket = static_cast<double>(histogram[i]);
+        if (numNodesSoFar + numNodesInBucket >= target) {
+            // Assume degrees are uniformly distributed within a bucket.
+            const auto lower = static_cast<double>(uint64_t{1} << i);
+            const auto upper = std::min(lower * 2 - 1, static_cast<double>(maxDegree));
+            const auto fraction = (target - numNodesSoFar) / numNodesInBucket;
+            return static_cast<uint64_t>(lower + fraction * std::max(0.0, upper - lower));
+        }
+        numNodesSoFar += numNodesInBucket;
+    }
+    return maxDegree;
+}
+
+void DegreeStats::serialize(common::Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_nodes");
+    serializer.serializeValue(numNodes);
+    serializer.writeDebuggingInfo("num_rels");
+    serializer.serializeValue(numRels);
+    serializer.writeDebuggingInfo("sum_of_squared_degrees");
+    serializer.serializeValue(sumOfSquaredDegrees);
+    serializer.writeDebuggingInfo("max_degree");
+    serializer.serializeValue(maxDegree);
+    // Stats are rewritten at every checkpoint, so trailing empty buckets, i.e. degrees larger than
+    // any degree of the table, are not written.
+    uint64_t numBucketsToWrite = NUM_BUCKETS;
+    while (numBucketsToWrite > 0 && histogram[numBucketsToWrite - 1] == 0) {
+        numBucketsToWrite--;
+    }
+    serializer.writeDebuggingInfo("histogram");
+    serializer.serializeValue(numBucketsToWrite);
+    for (auto i = 0u; i < numBucketsToWrite; i++) {
+        serializer.serializeValue(histogram[i]);
+    }
+}
+
+DegreeStats DegreeStats::deserialize(common::Deserializer& deserializer) {
+    DegreeStats result;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_nodes");
+    deserializer.deserializeValue(result.numNodes);
+    deserializer.validateDebuggingInfo(info, "num_rels");
+    deserializer.deserializeValue(result.numRels);
+    deserializer.validateDebuggingInfo(info, "sum_of_squared_degrees");
+    deserializer.deserializeValue(result.sumOfSquaredDegrees);
+    deserializer.validateDebuggingInfo(info, "max_degree");
+    deserializer.deserializeValue(result.maxDegree);
+    deserializer.validateDebuggingInfo(info, "histogram");
+    uint64_t numBucketsWritten = 0;
+    deserializer.deserializeValue(numBucketsWritten);
+    KU_ASSERT(numBucketsWritten <= NUM_BUCKETS);
+    for (auto i = 0u; i < numBucketsWritten; i++) {
+        deserializer.deserializeValue(result.histogram[i]);
+    }
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -12,7 +12,8 @@ TableStats::TableStats(std::span<const common::LogicalType> dataTypes) : cardina
     }
 }
 
-TableStats::TableStats(const TableStats& other) : cardinality{other.cardinality} {
+TableStats::TableStats(const TableStats& other)
+    : cardinality{other.cardinality}, degreeStats{other.degreeStats} {
     columnStats.reserve(other.columnStats.size());
     for (auto i = 0u; i < other.columnStats.size(); ++i) {
         columnStats.emplace_back(other.columnStats[i].copy());
@@ -49,6 +50,8 @@ void TableStats::serialize(common::Serializer& serializer) const {
     serializer.write(cardinality);
     serializer.writeDebuggingInfo("column_stats");
     serializer.serializeVector(columnStats);
+    serializer.writeDebuggingInfo("degree_stats");
+    degreeStats.serialize(serializer);
 }
 
 TableStats TableStats::deserialize(common::Deserializer& deserializer) {
@@ -57,6 +60,8 @@ TableStats TableStats::deserialize(common::Deserializer& deserializer) {
     deserializer.deserializeValue<common::cardinality_t>(cardinality);
     deserializer.validateDebuggingInfo(info, "column_stats");
     deserializer.deserializeVector(columnStats);
+    deserializer.validateDebuggingInfo(info, "degree_stats");
+    degreeStats = DegreeStats::deserialize(deserializer);
     return *this;
 }
 
@@ -384,9 +384,9 @@ bool ChunkedNodeGroup::lookup(const Transaction* transaction, const TableScanSta
     return true;
 }
 
-void ChunkedNodeGroup::update(const Transaction* transaction, row_idx_t rowIdxInChunk,
-    column_id_t columnID, const ValueVector& propertyVector) {
-    getColumnChunk(columnID).update(transaction, rowIdxInChunk, propertyVector);
+void ChunkedNodeGroup::update(const Transaction* transaction, table_id_t tableID,
+    row_idx_t rowIdxInChunk, column_id_t columnID, const ValueVector& propertyVector) {
+    getColumnChunk(columnID).update(transaction, tableID, rowIdxInChunk, propertyVector);
 }
 
 bool ChunkedNodeGroup::delete_(const Transaction* transaction, row_idx_t rowIdxInChunk) {
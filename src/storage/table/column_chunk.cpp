@@ -176,8 +176,8 @@ void ColumnChunk::lookup(const Transaction* transaction, const ChunkState& state
     updateInfo.lookup(transaction, rowInChunk, output, posInOutputVector);
 }
 
-void ColumnChunk::update(const Transaction* transaction, offset_t offsetInChunk,
-    const ValueVector& values) {
+void ColumnChunk::update(const Transaction* transaction, table_id_t tableID,
+    offset_t offsetInChunk, const ValueVector& values) {
     if (transaction->getType() == TransactionType::DUMMY) {
         rangeSegments(offsetInChunk, 1, [&](auto& segment, auto offsetInSegment, auto, auto) {
             segment->write(&values, values.state->getSelVector().getSelectedPositions()[0],
@@ -190,7 +190,7 @@ void ColumnChunk::update(const Transaction* transaction, offset_t offsetInChunk,
     const auto rowIdxInVector = offsetInChunk % DEFAULT_VECTOR_CAPACITY;
     auto& vectorUpdateInfo = updateInfo.update(data.front()->getMemoryManager(), transaction,
         vectorIdx, rowIdxInVector, values);
-    transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, vectorUpdateInfo,
+    transaction->pushVectorUpdateInfo(tableID, updateInfo, vectorIdx, vectorUpdateInfo,
         transaction->getID());
 }
 
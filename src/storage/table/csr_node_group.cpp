@@ -397,12 +397,14 @@ void CSRNodeGroup::updateCSRIndex(offset_t boundNodeOffsetInGroup, row_idx_t sta
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
-void CSRNodeGroup::update(const Transaction* transaction, CSRNodeGroupScanSource source,
-    row_idx_t rowIdxInGroup, column_id_t columnID, const ValueVector& propertyVector) {
+void CSRNodeGroup::update(const Transaction* transaction, table_id_t tableID,
+    CSRNodeGroupScanSource source, row_idx_t rowIdxInGroup, column_id_t columnID,
+    const ValueVector& propertyVector) {
     switch (source) {
     case CSRNodeGroupScanSource::COMMITTED_PERSISTENT: {
         KU_ASSERT(persistentChunkGroup);
-        return persistentChunkGroup->update(transaction, rowIdxInGroup, columnID, propertyVector);
+        return persistentChunkGroup->update(transaction, tableID, rowIdxInGroup, columnID,
+            propertyVector);
     }
     case CSRNodeGroupScanSource::COMMITTED_IN_MEMORY: {
         KU_ASSERT(csrIndex);
@@ -410,7 +412,7 @@ void CSRNodeGroup::update(const Transaction* transaction, CSRNodeGroupScanSource
             StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
         const auto lock = chunkedGroups.lock();
         const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
-        return chunkedGroup->update(transaction, rowInChunk, columnID, propertyVector);
+        return chunkedGroup->update(transaction, tableID, rowInChunk, columnID, propertyVector);
     }
     default: {
         KU_UNREACHABLE;
@@ -530,6 +532,14 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
                       csrState.newHeader->getStartCSROffset(region.leftNodeOffset));
         }
     }
+    if (csrState.degreeStats) {
+        for (const auto& region : regionsToCheckpoint) {
+            for (auto i = region.leftNodeOffset; i <= region.rightNodeOffset; ++i) {
+                csrState.degreeStats->remove(csrState.oldHeader->getCSRLength(i));
+                csrState.degreeStats->add(csrState.newHeader->getCSRLength(i));
+            }
+        }
+    }
 
     uint64_t numTuplesAfterCheckpoint = 0;
     for (const auto& region : regionsToCheckpoint) {
@@ -1002,6 +1012,11 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     const auto numNodes = csrIndex->getMaxOffsetWithRels() + 1;
     csrState.newHeader->setNumValues(numNodes);
     populateCSRLengthInMemOnly(lock, numNodes, csrState);
+    if (csrState.degreeStats) {
+        for (auto offset = 0u; offset < numNodes; offset++) {
+            csrState.degreeStats->add(csrState.newHeader->getCSRLength(offset));
+        }
+    }
     const auto rightCSROffsetsOfRegions =
         csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGap */);
     csrState.newHeader->populateEndCSROffsetFromStartAndLength();
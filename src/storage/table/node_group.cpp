@@ -353,7 +353,7 @@ bool NodeGroup::lookupMultiple(const Transaction* transaction, const TableScanSt
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
-void NodeGroup::update(const Transaction* transaction, row_idx_t rowIdxInGroup,
+void NodeGroup::update(const Transaction* transaction, table_id_t tableID, row_idx_t rowIdxInGroup,
     column_id_t columnID, const ValueVector& propertyVector) {
     KU_ASSERT(propertyVector.state->getSelVector().getSelSize() == 1);
     ChunkedNodeGroup* chunkedGroupToUpdate = nullptr;
@@ -363,7 +363,8 @@ void NodeGroup::update(const Transaction* transaction, row_idx_t rowIdxInGroup,
     }
     KU_ASSERT(chunkedGroupToUpdate);
     const auto rowIdxInChunkedGroup = rowIdxInGroup - chunkedGroupToUpdate->getStartRowIdx();
-    chunkedGroupToUpdate->update(transaction, rowIdxInChunkedGroup, columnID, propertyVector);
+    chunkedGroupToUpdate->update(transaction, tableID, rowIdxInChunkedGroup, columnID,
+        propertyVector);
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
@@ -206,6 +206,7 @@ void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
     for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
         nodeGroup->checkpoint(memoryManager, state);
     }
+    stats.buildValueDistributions();
     std::vector<LogicalType> typesAfterCheckpoint;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
         typesAfterCheckpoint.push_back(types[state.columnIDs[i]].copy());
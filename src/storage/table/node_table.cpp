@@ -46,6 +46,10 @@ void NodeTableVersionRecordHandler::rollbackInsert(main::ClientContext* context,
     }
 }
 
+table_id_t NodeTableVersionRecordHandler::getTableID() const {
+    return table->getTableID();
+}
+
 NodeGroupScanResult NodeTableScanState::scanNext(Transaction* transaction, offset_t startOffset,
     offset_t numNodes) {
     KU_ASSERT(columns.size() == outputVectors.size());
@@ -495,7 +499,7 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         const auto rowIdxInGroup =
             nodeOffset - StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
         nodeGroups->getNodeGroup(nodeGroupIdx)
-            ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
+            ->update(transaction, tableID, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
@@ -34,9 +34,14 @@ void PersistentVersionRecordHandler::applyFuncToChunkedGroups(version_record_han
 void PersistentVersionRecordHandler::rollbackInsert(main::ClientContext* context,
     node_group_idx_t nodeGroupIdx, row_idx_t startRow, row_idx_t numRows) const {
     VersionRecordHandler::rollbackInsert(context, nodeGroupIdx, startRow, numRows);
+    relTableData->rollbackCopiedDegreeStats(nodeGroupIdx);
     relTableData->rollbackGroupCollectionInsert(numRows, true);
 }
 
+table_id_t PersistentVersionRecordHandler::getTableID() const {
+    return relTableData->getRelGroupID();
+}
+
 InMemoryVersionRecordHandler::InMemoryVersionRecordHandler(RelTableData* relTableData)
     : relTableData(relTableData) {}
 
@@ -56,6 +61,10 @@ void InMemoryVersionRecordHandler::rollbackInsert(main::ClientContext* context,
     relTableData->rollbackGroupCollectionInsert(numRowsToRollback, false);
 }
 
+table_id_t InMemoryVersionRecordHandler::getTableID() const {
+    return relTableData->getRelGroupID();
+}
+
 RelTableData::RelTableData(FileHandle* dataFH, MemoryManager* mm, ShadowFile* shadowFile,
     const RelGroupCatalogEntry& relGroupEntry, Table& table, RelDataDirection direction,
     table_id_t nbrTableID, bool enableCompression)
@@ -104,6 +113,10 @@ void RelTableData::initPropertyColumns(const RelGroupCatalogEntry& relGroupEntry
     columns[REL_ID_COLUMN_ID]->cast<InternalIDColumn>().setCommonTableID(table.getTableID());
 }
 
+table_id_t RelTableData::getRelGroupID() const {
+    return table.cast<RelTable>().getRelGroupID();
+}
+
 bool RelTableData::update(Transaction* transaction, ValueVector& boundNodeIDVector,
     const ValueVector& relIDVector, column_id_t columnID, const ValueVector& dataVector) const {
     KU_ASSERT(boundNodeIDVector.state->getSelVector().getSelSize() == 1);
@@ -118,7 +131,7 @@ bool RelTableData::update(Transaction* transaction, ValueVector& boundNodeIDVect
     const auto boundNodeOffset = boundNodeIDVector.getValue<nodeID_t>(boundNodePos).offset;
     const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(boundNodeOffset);
     auto& csrNodeGroup = getNodeGroup(nodeGroupIdx)->cast<CSRNodeGroup>();
-    csrNodeGroup.update(transaction, source, rowIdx, columnID, dataVector);
+    csrNodeGroup.update(transaction, getRelGroupID(), source, rowIdx, columnID, dataVector);
     return true;
 }
 
@@ -256,9 +269,12 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
         checkpointColumnPtrs.push_back(column.get());
     }
 
+    auto degreeStats = nodeGroups->getDegreeStats();
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
+    state.degreeStats = &degreeStats;
     nodeGroups->checkpoint(*mm, state);
+    nodeGroups->setDegreeStats(std::move(degreeStats));
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
@@ -284,6 +300,16 @@ void RelTableData::rollbackGroupCollectionInsert(row_idx_t numRows_, bool isPers
     nodeGroups->rollbackInsert(numRows_, !isPersistent);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+void RelTableData::rollbackCopiedDegreeStats(node_group_idx_t nodeGroupIdx) {
+    if (nodeGroupIdx >= getNumNodeGroups()) {
+        return;
+    }
+    auto& nodeGroup = getNodeGroupNoLock(nodeGroupIdx)->cast<CSRNodeGroup>();
+    nodeGroups->subtractDegreeStats(nodeGroup.getCopiedDegreeStats());
+    nodeGroup.setCopiedDegreeStats(DegreeStats{});
+}
+
 void RelTableData::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
 }
@@ -46,6 +46,7 @@ struct VersionRecord {
 };
 
 struct VectorUpdateRecord {
+    table_id_t tableID;
     UpdateInfo* updateInfo;
     idx_t vectorIdx;
     VectorUpdateInfo* vectorUpdateInfo;
@@ -135,13 +136,14 @@ void UndoBuffer::createVersionInfo(const UndoRecordType recordType, row_idx_t st
         VersionRecord{startRow, numRows, nodeGroupIdx, versionRecordHandler};
 }
 
-void UndoBuffer::createVectorUpdateInfo(UpdateInfo* updateInfo, const idx_t vectorIdx,
-    VectorUpdateInfo* vectorUpdateInfo, transaction_t version) {
+void UndoBuffer::createVectorUpdateInfo(table_id_t tableID, UpdateInfo* updateInfo,
+    const idx_t vectorIdx, VectorUpdateInfo* vectorUpdateInfo, transaction_t version) {
     auto buffer = createUndoRecord(sizeof(UndoRecordHeader) + sizeof(VectorUpdateRecord));
     const UndoRecordHeader recordHeader{UndoRecordType::UPDATE_INFO, sizeof(VectorUpdateRecord)};
     *reinterpret_cast<UndoRecordHeader*>(buffer) = recordHeader;
     buffer += sizeof(UndoRecordHeader);
-    const VectorUpdateRecord vectorUpdateRecord{updateInfo, vectorIdx, vectorUpdateInfo, version};
+    const VectorUpdateRecord vectorUpdateRecord{tableID, updateInfo, vectorIdx, vectorUpdateInfo,
+        version};
     *reinterpret_cast<VectorUpdateRecord*>(buffer) = vectorUpdateRecord;
 }
 
@@ -168,6 +170,26 @@ void UndoBuffer::commit(transaction_t commitTS) const {
     });
 }
 
+table_id_set_t UndoBuffer::getWrittenTableIDs() const {
+    table_id_set_t tableIDs;
+    UndoBufferIterator iterator{*this};
+    iterator.iterate([&](UndoRecordType entryType, uint8_t const* entry) {
+        switch (entryType) {
+        case UndoRecordType::INSERT_INFO:
+        case UndoRecordType::DELETE_INFO: {
+            tableIDs.insert(reinterpret_cast<VersionRecord const*>(entry)
+                                ->versionRecordHandler->getTableID());
+        } break;
+        case UndoRecordType::UPDATE_INFO: {
+            tableIDs.insert(reinterpret_cast<VectorUpdateRecord const*>(entry)->tableID);
+        } break;
+        default:
+            break;
+        }
+    });
+    return tableIDs;
+}
+
 void UndoBuffer::rollback(ClientContext* context) const {
     UndoBufferIterator iterator{*this};
     iterator.reverseIterate([&](UndoRecordType entryType, uint8_t const* entry) {
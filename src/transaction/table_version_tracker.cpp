@@ -0,0 +1,59 @@
+#include "transaction/table_version_tracker.h"
+
+#include <algorithm>
+
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace transaction {
+
+void TableVersionTracker::commitWrites(const table_id_set_t& tableIDs, transaction_t commitTS) {
+    if (tableIDs.empty()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    for (auto tableID : tableIDs) {
+        tableVersions[tableID] = commitTS;
+    }
+}
+
+table_versions_t TableVersionTracker::getTableVersions(const table_id_set_t& tableIDs) {
+    std::unique_lock lck{mtx};
+    table_versions_t result;
+    result.reserve(tableIDs.size());
+    for (auto tableID : tableIDs) {
+        result.emplace_back(tableID, getTableVersionNoLock(tableID));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+bool TableVersionTracker::isUpToDate(const table_versions_t& versions) {
+    std::unique_lock lck{mtx};
+    for (auto& [tableID, version] : versions) {
+        if (getTableVersionNoLock(tableID) != version) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TableVersionTracker::isVisible(const Transaction& transaction,
+    const table_versions_t& versions) {
+    // A write transaction may see its own uncommitted changes.
+    if (!transaction.isReadOnly()) {
+        return false;
+    }
+    // Writes committed after the transaction started are not visible to it.
+    return std::all_of(versions.begin(), versions.end(),
+        [&](const auto& tableVersion) { return tableVersion.second <= transaction.getStartTS(); });
+}
+
+uint64_t TableVersionTracker::getTableVersionNoLock(table_id_t tableID) const {
+    return tableVersions.contains(tableID) ? tableVersions.at(tableID) : 0;
+}
+
+} // namespace transaction
+} // namespace kuzu
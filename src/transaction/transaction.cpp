@@ -2,12 +2,14 @@
 
 #include "common/exception/runtime.h"
 #include "main/client_context.h"
+#include "main/database.h"
 #include "main/db_config.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/storage_manager.h"
 #include "storage/undo_buffer.h"
 #include "storage/wal/local_wal.h"
+#include "transaction/table_version_tracker.h"
 #include "transaction/transaction_context.h"
 
 using namespace kuzu::catalog;
@@ -73,6 +75,10 @@ void Transaction::commit(storage::WAL* wal) {
         Catalog::Get(*clientContext)->incrementVersion();
         hasCatalogChanges = false;
     }
+    // The local storage is committed into the tables above, which records its insertions in the
+    // undo buffer, so the undo buffer covers every row written by the transaction.
+    clientContext->getDatabase()->getTableVersionTracker()->commitWrites(
+        undoBuffer->getWrittenTableIDs(), commitTS);
 }
 
 void Transaction::rollback(storage::WAL*) {
@@ -193,10 +199,11 @@ void Transaction::pushDeleteInfo(common::node_group_idx_t nodeGroupIdx, common::
     undoBuffer->createDeleteInfo(nodeGroupIdx, startRow, numRows, versionRecordHandler);
 }
 
-void Transaction::pushVectorUpdateInfo(storage::UpdateInfo& updateInfo,
-    const common::idx_t vectorIdx, storage::VectorUpdateInfo& vectorUpdateInfo,
-    common::transaction_t version) const {
-    undoBuffer->createVectorUpdateInfo(&updateInfo, vectorIdx, &vectorUpdateInfo, version);
+void Transaction::pushVectorUpdateInfo(common::table_id_t tableID,
+    storage::UpdateInfo& updateInfo, const common::idx_t vectorIdx,
+    storage::VectorUpdateInfo& vectorUpdateInfo, common::transaction_t version) const {
+    undoBuffer->createVectorUpdateInfo(tableID, &updateInfo, vectorIdx, &vectorUpdateInfo,
+        version);
 }
 
 Transaction::~Transaction() = default;
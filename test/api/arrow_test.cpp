@@ -78,3 +78,35 @@ TEST_F(ArrowTest, getArrowSchema) {
     ASSERT_EQ(std::string(schema->children[0]->name), "NAME");
     schema->release(schema.get());
 }
+
+TEST_F(ArrowTest, queryAsArrowColumnar) {
+    auto query = "UNWIND [1, NULL, 3, 4] AS x RETURN x, CAST(x AS STRING), x > 2";
+    auto result = conn->queryAsArrow(query, 3);
+    ASSERT_TRUE(result->hasNextArrowChunk());
+    auto arrowArray = result->getNextArrowChunk(3);
+    ASSERT_EQ(arrowArray->length, 3);
+    ASSERT_EQ(arrowArray->n_children, 3);
+    auto intArray = arrowArray->children[0];
+    ASSERT_EQ(intArray->null_count, 1);
+    auto validity = (const uint8_t*)intArray->buffers[0];
+    ASSERT_EQ(validity[0] & 0b111, 0b101);
+    auto values = (const int64_t*)intArray->buffers[1];
+    ASSERT_EQ(values[0], 1);
+    ASSERT_EQ(values[2], 3);
+    auto strArray = arrowArray->children[1];
+    ASSERT_EQ(strArray->null_count, 1);
+    auto offsets = (const uint32_t*)strArray->buffers[1];
+    ASSERT_EQ(offsets[1], 1);
+    ASSERT_EQ(offsets[2], 1);
+    ASSERT_EQ(offsets[3], 2);
+    ASSERT_EQ(std::string((const char*)strArray->buffers[2], 2), "13");
+    auto boolArray = arrowArray->children[2];
+    ASSERT_EQ(((const uint8_t*)boolArray->buffers[1])[0] & 0b101, 0b100);
+    arrowArray->release(arrowArray.get());
+    ASSERT_TRUE(result->hasNextArrowChunk());
+    arrowArray = result->getNextArrowChunk(3);
+    ASSERT_EQ(arrowArray->length, 1);
+    ASSERT_EQ(((const int64_t*)arrowArray->children[0]->buffers[1])[0], 4);
+    ASSERT_FALSE(result->hasNextArrowChunk());
+    arrowArray->release(arrowArray.get());
+}
@@ -0,0 +1,75 @@
+#include "api_test/api_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::testing;
+
+// Morsels of node table scans, factorized table scans and UNION ALL scans are claimed by workers
+// without a lock. These tests scan tables spanning several node groups with 8 threads and check
+// that every tuple is produced exactly once.
+class ParallelScanTest : public ApiTest {
+public:
+    static constexpr uint64_t NUM_THREADS = 8;
+    static constexpr int64_t NUM_NODES = 300000;
+
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->maxNumThreads = NUM_THREADS;
+        createDBAndConn();
+        ASSERT_TRUE(
+            conn->query("CREATE NODE TABLE Num(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE Next(FROM Num TO Num)")->isSuccess());
+        ASSERT_TRUE(conn->query(stringFormat(
+                                    "COPY Num FROM (UNWIND range(0, {}) AS i RETURN i, i % 3)",
+                                    NUM_NODES - 1))
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query(stringFormat(
+                                    "COPY Next FROM (UNWIND range(0, {}) AS i RETURN i, i + 1)",
+                                    NUM_NODES - 2))
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query(stringFormat("CALL threads={}", NUM_THREADS))->isSuccess());
+    }
+
+    // Returns the number of tuples and the sum of the first column.
+    static std::pair<int64_t, int64_t> countAndSum(QueryResult& result) {
+        EXPECT_TRUE(result.isSuccess()) << result.getErrorMessage();
+        int64_t numTuples = 0, sum = 0;
+        while (result.hasNext()) {
+            sum += result.getNext()->getValue(0)->getValue<int64_t>();
+            numTuples++;
+        }
+        return {numTuples, sum};
+    }
+};
+
+TEST_F(ParallelScanTest, NodeTableScan) {
+    for (auto i = 0u; i < 3; ++i) {
+        auto [numTuples, sum] = countAndSum(*conn->query("MATCH (n:Num) RETURN n.id"));
+        ASSERT_EQ(numTuples, NUM_NODES);
+        ASSERT_EQ(sum, NUM_NODES * (NUM_NODES - 1) / 2);
+    }
+    // The ids 3k + 1 for k in [0, 100000).
+    auto [numTuples, sum] = countAndSum(*conn->query("MATCH (n:Num) WHERE n.v = 1 RETURN n.id"));
+    ASSERT_EQ(numTuples, 100000);
+    ASSERT_EQ(sum, 14999950000);
+}
+
+TEST_F(ParallelScanTest, UnionAllScan) {
+    for (auto i = 0u; i < 3; ++i) {
+        auto [numTuples, sum] = countAndSum(
+            *conn->query("MATCH (n:Num) WHERE n.v = 0 RETURN n.id AS x UNION ALL "
+                         "MATCH (n:Num) WHERE n.v <> 0 RETURN n.id AS x UNION ALL "
+                         "UNWIND range(1, 1000) AS x RETURN x"));
+        ASSERT_EQ(numTuples, NUM_NODES + 1000);
+        ASSERT_EQ(sum, NUM_NODES * (NUM_NODES - 1) / 2 + 1000 * 1001 / 2);
+    }
+}
+
+TEST_F(ParallelScanTest, FactorizedTableScan) {
+    // The paths of a recursive join are scanned from a factorized table.
+    auto [numTuples, sum] =
+        countAndSum(*conn->query("MATCH (a:Num)-[:Next*1..2]->(b:Num) RETURN b.id"));
+    // Node i reaches i + 1 for i < NUM_NODES - 1 and i + 2 for i < NUM_NODES - 2.
+    ASSERT_EQ(numTuples, 2 * NUM_NODES - 3);
+    ASSERT_EQ(sum, NUM_NODES * (NUM_NODES - 1) / 2 + (NUM_NODES * (NUM_NODES - 1) / 2 - 1));
+}
@@ -0,0 +1,105 @@
+#include "api_test/api_test.h"
+#include "common/exception/runtime.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::testing;
+
+class StreamingTest : public ApiTest {};
+
+TEST_F(StreamingTest, queryAsStream) {
+    auto query = "MATCH (a:person) RETURN a.fName ORDER BY a.fName";
+    auto expectedResult = conn->query(query);
+    auto result = conn->queryAsStream(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getType(), QueryResultType::STREAMING);
+    ASSERT_EQ(result->getColumnNames(), expectedResult->getColumnNames());
+    while (expectedResult->hasNext()) {
+        ASSERT_TRUE(result->hasNext());
+        ASSERT_EQ(result->getNext()->toString(), expectedResult->getNext()->toString());
+    }
+    ASSERT_FALSE(result->hasNext());
+}
+
+TEST_F(StreamingTest, backPressure) {
+    auto result = conn->queryAsStream("UNWIND range(1, 100000) AS x RETURN x", 1);
+    ASSERT_TRUE(result->isSuccess());
+    int64_t numTuples = 0, sum = 0;
+    while (result->hasNext()) {
+        sum += result->getNext()->getValue(0)->getValue<int64_t>();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 100000);
+    ASSERT_EQ(sum, 5000050000);
+}
+
+TEST_F(StreamingTest, closeStream) {
+    auto query = "UNWIND range(1, 1000000) AS x RETURN x";
+    auto result = conn->queryAsStream(query, 1);
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // Executing another statement cancels the stream.
+    ASSERT_TRUE(conn->query("MATCH (a:person) RETURN COUNT(*)")->isSuccess());
+    try {
+        (void)result->hasNext();
+        FAIL();
+    } catch (const Exception& e) {
+        ASSERT_STREQ(e.what(), "Runtime exception: The streaming query result has been closed.");
+    }
+    // Destroying the result cancels the stream.
+    result = conn->queryAsStream(query, 1);
+    ASSERT_TRUE(result->hasNext());
+    result.reset();
+    auto countResult = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_EQ(countResult->getNext()->getValue(0)->getValue<int64_t>(), 8);
+}
+
+TEST_F(StreamingTest, streamError) {
+    auto result = conn->queryAsStream("UNWIND ['1', 'a'] AS x RETURN CAST(x AS INT64)");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(),
+        "Conversion exception: Cast failed. Could not convert \"a\" to INT64.");
+}
+
+TEST_F(StreamingTest, numTuples) {
+    auto result = conn->queryAsStream("UNWIND range(1, 10000) AS x RETURN x", 1);
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // Counting buffers the remaining tuples, which can still be read afterwards.
+    ASSERT_EQ(result->getNumTuples(), 10000);
+    ASSERT_EQ(result->getNumTuples(), 10000);
+    int64_t numTuples = 1, sum = 1;
+    while (result->hasNext()) {
+        sum += result->getNext()->getValue(0)->getValue<int64_t>();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 10000);
+    ASSERT_EQ(sum, 50005000);
+    ASSERT_EQ(result->getNumTuples(), 10000);
+    result = conn->queryAsStream("MATCH (a:person) WHERE a.ID > 100 RETURN a.fName");
+    ASSERT_EQ(result->getNumTuples(), 0);
+    ASSERT_FALSE(result->hasNext());
+}
+
+TEST_F(StreamingTest, unsupportedStream) {
+    auto result = conn->queryAsStream("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+    try {
+        result->resetIterator();
+        FAIL();
+    } catch (const RuntimeException& e) {
+        ASSERT_STREQ(e.what(),
+            "Runtime exception: Cannot reset the iterator of a streaming query result, whose "
+            "tuples can only be read once. Use Connection::query to get a result that can be "
+            "iterated multiple times.");
+    }
+    // Write queries are not streamed.
+    result = conn->queryAsStream("CREATE (:person {ID: 100, fName: 'Streamer'})");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getType(), QueryResultType::FTABLE);
+    result = conn->queryAsStream("MATCH (a:person) WHERE a.ID = 100 RETURN a.fName");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<std::string>(), "Streamer");
+    ASSERT_FALSE(result->hasNext());
+}
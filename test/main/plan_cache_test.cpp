@@ -0,0 +1,92 @@
+#include "graph_test/private_graph_test.h"
+#include "main/plan_cache.h"
+
+namespace kuzu {
+namespace testing {
+
+class PlanCacheTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, name STRING, PRIMARY KEY(id))")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(1, 10) AS i CREATE (:N {id: i, name: 'n' + "
+                                "CAST(i AS STRING)})")
+                        ->isSuccess());
+    }
+
+    main::PlanCache* getPlanCache() const { return database->getPlanCache(); }
+
+    static std::string getName(main::QueryResult& result) {
+        EXPECT_TRUE(result.isSuccess()) << result.getErrorMessage();
+        EXPECT_EQ(result.getNumTuples(), 1);
+        return result.getNext()->getValue(0)->toString();
+    }
+};
+
+TEST_F(PlanCacheTest, SharedAcrossConnections) {
+    ASSERT_EQ(getName(*conn->query("MATCH (a:N) WHERE a.id = 3 RETURN a.name")), "n3");
+    ASSERT_EQ(getPlanCache()->getNumEntries(), 1);
+    ASSERT_EQ(getPlanCache()->getNumHits(), 0);
+    ASSERT_EQ(getName(*conn->query("MATCH (a:N) WHERE a.id = 3 RETURN a.name")), "n3");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 1);
+    auto conn2 = std::make_unique<main::Connection>(database.get());
+    ASSERT_EQ(getName(*conn2->query("MATCH  (a:N)\n WHERE a.id = 3 RETURN a.name;")), "n3");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 2);
+    // A schema change drops the entry.
+    ASSERT_TRUE(conn2->query("ALTER TABLE N ADD age INT64 DEFAULT 7")->isSuccess());
+    ASSERT_EQ(getName(*conn->query("MATCH (a:N) WHERE a.id = 3 RETURN a.name")), "n3");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 2);
+}
+
+TEST_F(PlanCacheTest, ParameterizedPlansAreReusedAcrossValues) {
+    auto preparedStatement = conn->prepare("MATCH (a:N) WHERE a.id = $id RETURN a.name");
+    ASSERT_TRUE(preparedStatement->isSuccess()) << preparedStatement->getErrorMessage();
+    auto execute = [&](int64_t id) {
+        auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string{"id"}, id));
+        return getName(*result);
+    };
+    ASSERT_EQ(execute(3), "n3");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 0);
+    ASSERT_EQ(execute(4), "n4");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 1);
+    ASSERT_EQ(execute(3), "n3");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 2);
+    // A value of another type is bound to other functions.
+    auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string{"id"}, 5.0));
+    ASSERT_EQ(getName(*result), "n5");
+    ASSERT_EQ(getPlanCache()->getNumHits(), 2);
+    ASSERT_EQ(getPlanCache()->getNumEntries(), 2);
+}
+
+TEST_F(PlanCacheTest, PlansFoldingParameterValuesAreReusedForTheSameValues) {
+    auto preparedStatement = conn->prepare("MATCH (a:N) RETURN a.id ORDER BY a.id LIMIT $n");
+    ASSERT_TRUE(preparedStatement->isSuccess()) << preparedStatement->getErrorMessage();
+    auto execute = [&](int64_t n) {
+        auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string{"n"}, n));
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNumTuples();
+    };
+    ASSERT_EQ(execute(2), 2);
+    ASSERT_EQ(execute(3), 3);
+    ASSERT_EQ(getPlanCache()->getNumHits(), 0);
+    ASSERT_EQ(execute(3), 3);
+    ASSERT_EQ(getPlanCache()->getNumHits(), 1);
+}
+
+TEST_F(PlanCacheTest, WritesAreNotCached) {
+    ASSERT_EQ(getPlanCache()->getNumEntries(), 0);
+    auto preparedStatement = conn->prepare("MATCH (a:N) WHERE a.id = $id SET a.name = 'm'");
+    ASSERT_TRUE(preparedStatement->isSuccess()) << preparedStatement->getErrorMessage();
+    for (auto id = 1; id <= 2; id++) {
+        auto result = conn->execute(preparedStatement.get(),
+            std::make_pair(std::string{"id"}, static_cast<int64_t>(id)));
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    }
+    ASSERT_EQ(getPlanCache()->getNumEntries(), 0);
+    ASSERT_EQ(getName(*conn->query("MATCH (a:N) WHERE a.id = 2 RETURN a.name")), "m");
+}
+
+} // namespace testing
+} // namespace kuzu
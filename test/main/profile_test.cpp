@@ -0,0 +1,107 @@
+#include "graph_test/private_graph_test.h"
+
+namespace kuzu {
+namespace testing {
+
+class ProfileTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    // Returns the value of the first profiler attribute with the given key.
+    std::string getProfilerAttribute(const std::string& query, const std::string& key) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto plan = result->getNext()->getValue(0)->toString();
+        auto pos = plan.find(key + ": ");
+        if (pos == std::string::npos) {
+            return "";
+        }
+        pos += key.size() + 2;
+        return plan.substr(pos, plan.find(' ', pos) - pos);
+    }
+
+    // Returns the number of tuples each conjunct of the query's filter was evaluated on, in the
+    // order the conjuncts were written.
+    std::vector<uint64_t> getConjunctInputs(const std::string& query) {
+        std::vector<uint64_t> result;
+        auto str = getProfilerAttribute(query, "ConjunctInputs");
+        for (auto start = 0u; start < str.size();) {
+            auto end = str.find('/', start);
+            end = end == std::string::npos ? str.size() : end;
+            result.push_back(std::stoull(str.substr(start, end - start)));
+            start = end + 1;
+        }
+        return result;
+    }
+};
+
+TEST_F(ProfileTest, ExpensiveConjunctMovesBehindCheapOne) {
+    // The regular expression matches every tuple, so the modulo is both cheaper and more
+    // selective. After sampling the first chunk, the regular expression only sees the multiples
+    // of 7. Neither conjunct is an equality, which the planner would already evaluate first.
+    auto inputs = getConjunctInputs("UNWIND range(1, 200000) AS x WITH x WHERE "
+                                    "regexp_matches(CAST(x AS STRING), '^[0-9]+$') AND x % 7 < 1 "
+                                    "RETURN COUNT(*)");
+    ASSERT_EQ(inputs.size(), 2);
+    ASSERT_EQ(inputs[1], 200000);
+    ASSERT_LT(inputs[0], 200000 / 4);
+}
+
+TEST_F(ProfileTest, ConjunctsThatCanFailKeepTheirOrder) {
+    // Casting a string to an integer can fail, so the conjuncts are not reordered.
+    auto inputs = getConjunctInputs("UNWIND range(1, 200000) AS x WITH x WHERE "
+                                    "CAST(CAST(x AS STRING) AS INT64) > 0 AND x % 7 = 0 "
+                                    "RETURN COUNT(*)");
+    ASSERT_EQ(inputs.size(), 2);
+    ASSERT_EQ(inputs[0], 200000);
+    ASSERT_EQ(inputs[1], 200000);
+}
+
+TEST_F(ProfileTest, DeltaSteppingWithinHopBound) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE V(id INT64 PRIMARY KEY)")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE E(FROM V TO V, w INT64)")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 11) AS i CREATE (:V {id: i})")->isSuccess());
+    // The edge relaxed from the source tunes delta to 1, so the nodes 2 to 11 reached over two
+    // edges fall into ten different buckets.
+    ASSERT_TRUE(conn->query("MATCH (a:V {id: 0}), (b:V {id: 1}) CREATE (a)-[:E {w: 1}]->(b)")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:V {id: 1}), (b:V) WHERE b.id > 1 "
+                            "CREATE (a)-[:E {w: b.id * 10}]->(b)")
+                    ->isSuccess());
+    auto query = "MATCH (a:V)-[e* WSHORTEST(w) 1..2]->(b:V) WHERE a.id = 0 RETURN SUM(cost(e))";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->toString(), "661.000000");
+    ASSERT_EQ(getProfilerAttribute(query, "DeltaSteppingFallbacks"), "0");
+    // The cheapest path to node 11 now has three edges, which exceeds the bound.
+    ASSERT_TRUE(conn->query("MATCH (a:V {id: 2}), (b:V {id: 11}) CREATE (a)-[:E {w: 1}]->(b)")
+                    ->isSuccess());
+    result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->toString(), "661.000000");
+    ASSERT_EQ(getProfilerAttribute(query, "DeltaSteppingFallbacks"), "1");
+}
+
+TEST_F(ProfileTest, MemoHitsForRepeatedOuterKeys) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE P(id INT64 PRIMARY KEY)")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE K(FROM P TO P)")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 10) AS i CREATE (:P {id: i})")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:P), (b:P {id: 10}) WHERE a.id < 10 CREATE (a)-[:K]->(b)")
+                    ->isSuccess());
+    ASSERT_TRUE(
+        conn->query("MATCH (a:P {id: 10}), (b:P {id: 0}) CREATE (a)-[:K]->(b)")->isSuccess());
+    // The memo is per thread.
+    conn->setMaxNumThreadForExec(1);
+    // Ten of the eleven outer tuples bind b to node 10, so all but its first probe hit the memo.
+    auto query = "MATCH (a:P)-[:K]->(b:P) WHERE EXISTS { MATCH (b)-[:K]->(c:P) } RETURN COUNT(*)";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->toString(), "11");
+    ASSERT_EQ(getProfilerAttribute(query, "MemoHits"), "9/11");
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,54 @@
+#include "graph_test/private_graph_test.h"
+
+namespace kuzu {
+namespace testing {
+
+static constexpr auto UNDERESTIMATED_QUERY =
+    "MATCH (a:N), (b:N) WHERE a.id = b.id AND b.id % 2 = 0 RETURN COUNT(*)";
+
+class ReoptimizationTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM N TO N)")->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(1, 1000) AS i CREATE (:N {id: i})")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("MATCH (a:N), (b:N) WHERE b.id = a.id + 1 CREATE (a)-[:R]->(b)")
+                ->isSuccess());
+        ASSERT_TRUE(conn->query("CALL enable_adaptive_reoptimization=true")->isSuccess());
+    }
+
+    // Returns the number of times the query was re-planned while executing it.
+    uint64_t getNumReoptimizations(const std::string& query, const std::string& expectedResult) {
+        auto result = conn->query(query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        EXPECT_EQ(result->getNext()->toString(), expectedResult + "\n");
+        return result->getQuerySummary()->getNumReoptimizations();
+    }
+};
+
+TEST_F(ReoptimizationTest, UnderestimatedBuildSide) {
+    // The build side estimates one percent of the nodes to pass the filter, but half of them do.
+    ASSERT_EQ(getNumReoptimizations(UNDERESTIMATED_QUERY, "500"), 1);
+    // Cardinality feedback only applies to the execution it was collected in.
+    ASSERT_EQ(getNumReoptimizations(UNDERESTIMATED_QUERY, "500"), 1);
+}
+
+TEST_F(ReoptimizationTest, EstimateWithinThreshold) {
+    ASSERT_EQ(getNumReoptimizations("MATCH (a:N)-[:R]->(b:N) RETURN COUNT(*)", "999"), 0);
+    ASSERT_EQ(getNumReoptimizations("MATCH (a:N), (b:N) WHERE a.id = b.id RETURN COUNT(*)", "1000"),
+        0);
+    ASSERT_EQ(getNumReoptimizations("MATCH (a:N)-[:R]->(b:N) WHERE b.id > 999 RETURN a.id, b.id",
+                  "999|1000"),
+        0);
+}
+
+TEST_F(ReoptimizationTest, Disabled) {
+    ASSERT_TRUE(conn->query("CALL enable_adaptive_reoptimization=false")->isSuccess());
+    ASSERT_EQ(getNumReoptimizations(UNDERESTIMATED_QUERY, "500"), 0);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,70 @@
+#include "graph_test/private_graph_test.h"
+#include "main/query_result_cache.h"
+
+namespace kuzu {
+namespace testing {
+
+class ResultCacheTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, val INT64, PRIMARY KEY(id))")
+                        ->isSuccess());
+        ASSERT_TRUE(
+            conn->query("UNWIND range(1, 10) AS i CREATE (:N {id: i, val: i})")->isSuccess());
+        ASSERT_TRUE(conn->query("CALL result_cache_size=67108864")->isSuccess());
+    }
+
+    main::QueryResultCache* getResultCache() const { return database->getQueryResultCache(); }
+
+    int64_t querySum() const {
+        auto result = conn->query("MATCH (a:N) RETURN SUM(a.val)");
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+};
+
+TEST_F(ResultCacheTest, HitAndInvalidation) {
+    ASSERT_EQ(querySum(), 55);
+    ASSERT_EQ(getResultCache()->getNumEntries(), 1);
+    ASSERT_GT(getResultCache()->getMemoryUsage(), 0);
+    ASSERT_EQ(getResultCache()->getNumHits(), 0);
+    ASSERT_EQ(querySum(), 55);
+    ASSERT_EQ(getResultCache()->getNumHits(), 1);
+    ASSERT_TRUE(conn->query("MATCH (a:N) WHERE a.id = 1 SET a.val = 11")->isSuccess());
+    // The outdated entry is dropped and replaced by the new result.
+    ASSERT_EQ(querySum(), 65);
+    ASSERT_EQ(getResultCache()->getNumHits(), 1);
+    ASSERT_EQ(getResultCache()->getNumEntries(), 1);
+    ASSERT_EQ(querySum(), 65);
+    ASSERT_EQ(getResultCache()->getNumHits(), 2);
+}
+
+TEST_F(ResultCacheTest, OnlyMaterializedResultsAreCached) {
+    auto query = "MATCH (a:N) RETURN a.val ORDER BY a.val";
+    ASSERT_EQ(conn->query(query)->getNumTuples(), 10);
+    ASSERT_EQ(getResultCache()->getNumEntries(), 1);
+    auto streamingResult = conn->queryAsStream(query);
+    ASSERT_TRUE(streamingResult->isSuccess());
+    ASSERT_EQ(streamingResult->getType(), main::QueryResultType::STREAMING);
+    auto numTuples = 0u;
+    while (streamingResult->hasNext()) {
+        streamingResult->getNext();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 10);
+    ASSERT_EQ(getResultCache()->getNumHits(), 0);
+}
+
+TEST_F(ResultCacheTest, WritesInvalidateWhileCacheIsDisabled) {
+    ASSERT_EQ(querySum(), 55);
+    ASSERT_TRUE(conn->query("CALL result_cache_size=0")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:N) WHERE a.id = 1 SET a.val = 11")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL result_cache_size=67108864")->isSuccess());
+    ASSERT_EQ(querySum(), 65);
+    ASSERT_EQ(getResultCache()->getNumHits(), 0);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,166 @@
+#include <atomic>
+#include <thread>
+
+#include "common/task_system/task_scheduler.h"
+#include "graph_test/private_graph_test.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace testing {
+
+class WorkloadClassTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE E(FROM N TO N)")->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(1, 100) AS i CREATE (:N {id: i})")->isSuccess());
+        ASSERT_TRUE(conn->query("MATCH (a:N), (b:N) WHERE b.id = a.id + 1 OR b.id = a.id + 2 "
+                                "CREATE (a)-[:E]->(b)")
+                        ->isSuccess());
+    }
+
+    static int64_t getCount(main::QueryResult& result) {
+        EXPECT_TRUE(result.isSuccess()) << result.getErrorMessage();
+        return result.getNext()->getValue(0)->getValue<int64_t>();
+    }
+};
+
+TEST_F(WorkloadClassTest, AdmissionQueue) {
+    ASSERT_TRUE(
+        conn->query("CALL CREATE_WORKLOAD_CLASS('serial', 'NORMAL', 0, 0, 1)")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL workload_class='serial'")->isSuccess());
+    auto conn2 = std::make_unique<main::Connection>(database.get());
+    ASSERT_TRUE(conn2->query("CALL workload_class='serial'")->isSuccess());
+    // The stream keeps its query admitted until all tuples are read.
+    auto stream = conn->queryAsStream("UNWIND range(1, 100000) AS x RETURN x", 1);
+    ASSERT_TRUE(stream->hasNext());
+    conn2->setQueryTimeOut(100);
+    auto result = conn2->query("MATCH (a:N) RETURN COUNT(*)");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
+    conn2->setQueryTimeOut(0);
+    std::atomic<bool> finished = false;
+    std::thread waitingQuery([&] {
+        result = conn2->query("MATCH (a:N) RETURN COUNT(*)");
+        finished = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_FALSE(finished);
+    auto numTuples = 0u;
+    while (stream->hasNext()) {
+        stream->getNext();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 100000);
+    waitingQuery.join();
+    ASSERT_EQ(getCount(*result), 100);
+    // Raising the limit admits queries of both connections at the same time.
+    ASSERT_TRUE(
+        conn->query("CALL CREATE_WORKLOAD_CLASS('serial', 'NORMAL', 0, 0, 2)")->isSuccess());
+    stream = conn->queryAsStream("UNWIND range(1, 100000) AS x RETURN x", 1);
+    ASSERT_TRUE(stream->hasNext());
+    ASSERT_EQ(getCount(*conn2->query("MATCH (a:N) RETURN COUNT(*)")), 100);
+}
+
+class RecordingTask : public Task {
+public:
+    RecordingTask(std::string name, std::vector<std::string>& order, std::mutex& mtx)
+        : Task{1}, name{std::move(name)}, order{order}, mtx{mtx} {}
+
+    void run() override {
+        std::unique_lock lck{mtx};
+        order.push_back(name);
+    }
+
+private:
+    std::string name;
+    std::vector<std::string>& order;
+    std::mutex& mtx;
+};
+
+class BlockingTask : public Task {
+public:
+    BlockingTask() : Task{1} {}
+
+    void run() override {
+        started = true;
+        while (!released) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::atomic<bool> started = false;
+    std::atomic<bool> released = false;
+};
+
+TEST_F(WorkloadClassTest, TasksOfHigherPriorityRunFirst) {
+#if defined(__SINGLE_THREADED__)
+    GTEST_SKIP() << "Tasks run on the scheduling thread in single-threaded builds.";
+#else
+    auto clientContext = conn->getClientContext();
+    // A single worker, so the order in which tasks are picked up is the order they run in.
+#if defined(__APPLE__)
+    TaskScheduler scheduler{1, 0 /* threadQos */};
+#else
+    TaskScheduler scheduler{1};
+#endif
+    std::vector<std::string> order;
+    std::mutex mtx;
+    auto blockingTask = std::make_shared<BlockingTask>();
+    processor::ExecutionContext blockingContext{nullptr, clientContext, 0};
+    std::thread blockingThread(
+        [&] { scheduler.scheduleTaskAndWaitOrError(blockingTask, &blockingContext); });
+    while (!blockingTask->started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // The tasks are queued while the worker is busy, in increasing order of priority.
+    auto scheduleTask = [&](std::string name, WorkloadPriority priority) {
+        return std::thread([&, name, priority] {
+            processor::ExecutionContext context{nullptr, clientContext, 0};
+            context.priority = priority;
+            scheduler.scheduleTaskAndWaitOrError(std::make_shared<RecordingTask>(name, order, mtx),
+                &context);
+        });
+    };
+    auto lowThread = scheduleTask("low", WorkloadPriority::LOW);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto normalThread = scheduleTask("normal", WorkloadPriority::NORMAL);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto highThread = scheduleTask("high", WorkloadPriority::HIGH);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    blockingTask->released = true;
+    blockingThread.join();
+    lowThread.join();
+    normalThread.join();
+    highThread.join();
+    ASSERT_EQ(order, (std::vector<std::string>{"high", "normal", "low"}));
+#endif
+}
+
+TEST_F(WorkloadClassTest, MemoryLimit) {
+    const auto query = "MATCH (a:N)-[:E*1..3]->(b:N) RETURN COUNT(*)";
+    ASSERT_EQ(getCount(*conn->query(query)), 1349);
+    ASSERT_TRUE(conn->query("CALL CREATE_WORKLOAD_CLASS('tiny', 'NORMAL', 0, 1, 0)")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL workload_class='tiny'")->isSuccess());
+    auto result = conn->query(query);
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(),
+        "Buffer manager exception: Unable to allocate memory! The query exceeds the memory limit "
+        "of 1 bytes of its workload class.");
+    // The limit applies to each query separately, so memory released by a query can be used by
+    // the next one.
+    auto conn2 = std::make_unique<main::Connection>(database.get());
+    ASSERT_TRUE(conn2->query("CALL CREATE_WORKLOAD_CLASS('tiny', 'NORMAL', 0, 268435456, 0)")
+                    ->isSuccess());
+    for (auto i = 0u; i < 3; ++i) {
+        ASSERT_EQ(getCount(*conn->query(query)), 1349);
+    }
+    ASSERT_TRUE(conn->query("CALL workload_class='default'")->isSuccess());
+    ASSERT_EQ(getCount(*conn->query(query)), 1349);
+}
+
+} // namespace testing
+} // namespace kuzu
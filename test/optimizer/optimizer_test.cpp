@@ -1,5 +1,8 @@
+#include "common/string_utils.h"
 #include "graph_test/private_graph_test.h"
+#include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_plan_util.h"
+#include "planner/operator/logical_projection.h"
 #include "test_runner/test_runner.h"
 
 namespace kuzu {
@@ -17,6 +20,43 @@ public:
     std::unique_ptr<planner::LogicalPlan> getRoot(const std::string& query) {
         return TestRunner::getLogicalPlan(query, *conn);
     }
+    // Types of the filter predicates on the leftmost path of the plan in evaluation order.
+    std::vector<common::ExpressionType> getFilterOrder(const std::string& query) {
+        std::vector<common::ExpressionType> result;
+        auto plan = getRoot(query);
+        auto op = plan->getLastOperator().get();
+        while (op != nullptr) {
+            if (op->getOperatorType() == planner::LogicalOperatorType::FILTER) {
+                result.insert(result.begin(),
+                    op->constCast<planner::LogicalFilter>().getPredicate()->expressionType);
+            }
+            op = op->getNumChildren() == 0 ? nullptr : op->getChild(0).get();
+        }
+        return result;
+    }
+    // Projections and filters on the leftmost path of the plan from the root down. Projections
+    // list the functions they evaluate or pass on.
+    std::string getProjectionPath(const std::string& query) {
+        std::string result;
+        auto plan = getRoot(query);
+        auto op = plan->getLastOperator().get();
+        while (op != nullptr) {
+            if (op->getOperatorType() == planner::LogicalOperatorType::PROJECTION) {
+                std::vector<std::string> functions;
+                for (auto& expression :
+                    op->constCast<planner::LogicalProjection>().getExpressionsToProject()) {
+                    if (expression->expressionType == common::ExpressionType::FUNCTION) {
+                        functions.push_back(expression->toString());
+                    }
+                }
+                result += "Projection(" + common::StringUtils::join(functions, ",") + ")";
+            } else if (op->getOperatorType() == planner::LogicalOperatorType::FILTER) {
+                result += "Filter()";
+            }
+            op = op->getNumChildren() == 0 ? nullptr : op->getChild(0).get();
+        }
+        return result;
+    }
 };
 
 TEST_F(OptimizerTest, JoinHint) {
@@ -117,6 +157,39 @@ TEST_F(OptimizerTest, FilterPushDownTest) {
     ASSERT_STREQ(getEncodedPlan(q1).c_str(), "E(b)Filter()Filter()S(a)");
 }
 
+TEST_F(OptimizerTest, FilterOrderTest) {
+    using common::ExpressionType;
+    // Predicates that can raise an error keep their order behind the predicates guarding them.
+    auto q1 = "MATCH (a:person) WHERE a.age <> 0 AND 10 / a.age > 1 RETURN a.ID;";
+    ASSERT_EQ(getFilterOrder(q1),
+        (std::vector{ExpressionType::NOT_EQUALS, ExpressionType::GREATER_THAN}));
+    auto q2 = "MATCH (a:person) WHERE a.age <> 0 AND 10 / a.age = 1 RETURN a.ID;";
+    ASSERT_EQ(getFilterOrder(q2),
+        (std::vector{ExpressionType::NOT_EQUALS, ExpressionType::EQUALS}));
+    auto q3 = "UNWIND [0, 1, 2] AS x WITH x WHERE x <> 0 AND 10 / x > 1 RETURN x;";
+    ASSERT_EQ(getFilterOrder(q3),
+        (std::vector{ExpressionType::NOT_EQUALS, ExpressionType::GREATER_THAN}));
+    // Otherwise, equality predicates are evaluated first.
+    auto q4 = "MATCH (a:person) WHERE a.age > 0 AND a.fName = 'Alice' RETURN a.ID;";
+    ASSERT_EQ(getFilterOrder(q4),
+        (std::vector{ExpressionType::EQUALS, ExpressionType::GREATER_THAN}));
+}
+
+TEST_F(OptimizerTest, CommonSubexpressionTest) {
+    // A function repeated in a projection is evaluated once by a projection below it.
+    auto q1 = "MATCH (a:person) RETURN lower(a.fName), upper(lower(a.fName));";
+    ASSERT_EQ(getProjectionPath(q1),
+        "Projection(LOWER(a.fName),UPPER(LOWER(a.fName)))Projection(LOWER(a.fName))");
+    // A function shared by a filter and the projection above it is evaluated below the filter.
+    auto q2 = "MATCH (a:person) WHERE lower(a.fName) = 'bob' RETURN concat(lower(a.fName), '!');";
+    ASSERT_EQ(getProjectionPath(q2),
+        "Projection(CONCAT(LOWER(a.fName),!))Filter()Projection(LOWER(a.fName))");
+    // Branches of a CASE expression are evaluated conditionally, so they are not hoisted.
+    auto q3 = "MATCH (a:person) RETURN CASE WHEN a.ID = 0 THEN lower(a.fName) END, "
+              "lower(a.fName);";
+    ASSERT_EQ(getProjectionPath(q3), "Projection(LOWER(a.fName))");
+}
+
 TEST_F(OptimizerTest, IndexScanTest) {
     auto q1 = "MATCH (a:person) "
               "WHERE a.ID = 0 AND a.fName='Alice' "
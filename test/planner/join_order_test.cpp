@@ -0,0 +1,79 @@
+#include <regex>
+
+#include "graph_test/private_graph_test.h"
+#include "planner/operator/logical_explain.h"
+#include "planner/operator/logical_plan.h"
+#include "test_runner/test_runner.h"
+
+namespace kuzu {
+namespace testing {
+
+class JoinOrderTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM N TO N)")->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(0, 11) AS i CREATE (:N {id: i})")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("MATCH (a:N), (b:N) WHERE b.id = (a.id + 1) % 12 CREATE (a)-[:R]->(b)")
+                ->isSuccess());
+    }
+
+    // Returns a pattern through the nodes n0, ..., n{numNodes - 1}, closed back to n0 if cyclic.
+    static std::string getPattern(uint64_t numNodes, bool cyclic) {
+        std::string pattern = "(n0:N)";
+        for (auto i = 1u; i < numNodes; ++i) {
+            pattern += common::stringFormat("-[:R]->(n{}:N)", i);
+        }
+        if (cyclic) {
+            pattern += "-[:R]->(n0)";
+        }
+        return pattern;
+    }
+
+    planner::JoinOrderStats getJoinOrderStats(const std::string& query) {
+        auto plan = TestRunner::getLogicalPlan("EXPLAIN LOGICAL " + query, *conn);
+        auto op = plan->getLastOperator();
+        EXPECT_EQ(planner::LogicalOperatorType::EXPLAIN, op->getOperatorType());
+        return op->constCast<planner::LogicalExplain>().getJoinOrderStats();
+    }
+};
+
+TEST_F(JoinOrderTest, SmallPatternIsPlannedWithDP) {
+    auto stats =
+        getJoinOrderStats("MATCH " + getPattern(3, true /* cyclic */) + " RETURN COUNT(*)");
+    EXPECT_EQ(1, stats.numQueryGraphsPlannedWithDP);
+    EXPECT_EQ(0, stats.numQueryGraphsPlannedGreedily);
+    EXPECT_GT(stats.numJoinsEnumerated, 0);
+    EXPECT_GE(stats.enumerationTimeMS, 0);
+}
+
+TEST_F(JoinOrderTest, LargePatternIsPlannedGreedily) {
+    // 12 nodes and 12 rels exceed MAX_NUM_VARIABLES_TO_PLAN_WITH_DP.
+    const auto query = "MATCH " + getPattern(12, true /* cyclic */) + " RETURN COUNT(*)";
+    auto stats = getJoinOrderStats(query);
+    EXPECT_EQ(0, stats.numQueryGraphsPlannedWithDP);
+    EXPECT_EQ(1, stats.numQueryGraphsPlannedGreedily);
+    EXPECT_GT(stats.numJoinsEnumerated, 0);
+    EXPECT_GE(stats.enumerationTimeMS, 0);
+    // EXPLAIN reports the same stats after the plan. Planning is deterministic, so the same joins
+    // are enumerated.
+    for (auto explain : {"EXPLAIN ", "EXPLAIN LOGICAL "}) {
+        auto result = conn->query(explain + query);
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto explainStr = result->getNext()->getValue(0)->toString();
+        std::smatch match;
+        ASSERT_TRUE(std::regex_search(explainStr, match,
+            std::regex{"Join order enumeration: 0 query graph\\(s\\) planned with dynamic "
+                       "programming, 1 greedily, (\\d+) join\\(s\\) enumerated in "
+                       "(\\d+\\.\\d{3}) ms\n$"}))
+            << explainStr;
+        EXPECT_EQ(stats.numJoinsEnumerated, std::stoull(match[1].str()));
+        EXPECT_GE(std::stod(match[2].str()), 0);
+    }
+}
+
+} // namespace testing
+} // namespace kuzu